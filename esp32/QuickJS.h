@@ -4,14 +4,46 @@
 #define ENABLE_WIFI
 #endif
 
+#if defined(ENABLE_WIFI) && !defined(ENABLE_FETCH)
+#define ENABLE_FETCH
+#endif
+
 #include <Arduino.h>
 
+#ifdef ARDUINO_ARCH_ESP32
+#include <esp_idf_version.h>
+#if ESP_IDF_VERSION_MAJOR >= 5
+#include <esp_app_desc.h>
+#else
+#include <esp_ota_ops.h>
+#endif
+#endif
+
 #include <algorithm>
+#include <unordered_map>
 #include <vector>
 
+#ifdef ENABLE_FETCH
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <string>
+#ifdef ARDUINO_ARCH_ESP32
+#include <lwip/dns.h>
+#include <lwip/netdb.h>
+#include <lwip/sockets.h>
+#else
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#endif
 #ifdef ENABLE_WIFI
-#include <HTTPClient.h>
-#include <StreamString.h>
+#include <WiFiClientSecure.h>
+#endif
 #endif
 
 #include "../quickjs.h"
@@ -46,97 +78,811 @@ static void qjs_dump_exception(JSContext *ctx, JSValue v) {
   JS_FreeValue(ctx, e);
 }
 
+#ifdef ENABLE_FETCH
+// Non-blocking byte stream used by JSHttpFetcher. None of the calls may
+// wait for the network: they are made from loop().
+class JSHttpSocket {
+ public:
+  virtual ~JSHttpSocket() {}
+  // start connecting, false on immediate failure
+  virtual bool Connect(const char *host, uint16_t port) = 0;
+  // 1: connected, 0: in progress, -1: failed
+  virtual int IsConnected() = 0;
+  // bytes written, 0 if it would block, -1 on error
+  virtual int Write(const uint8_t *buf, size_t len) = 0;
+  // bytes read, 0 if nothing is available yet, -1 at the end of the
+  // stream, -2 on error
+  virtual int Read(uint8_t *buf, size_t len) = 0;
+};
+
+// TCP socket of lwip (ESP32) or of the host in non-blocking mode
+class JSHttpTcpSocket : public JSHttpSocket {
+  int fd = -1;
+  uint16_t port = 0;
+#ifdef ARDUINO_ARCH_ESP32
+  // the DNS callback of lwip may come after the socket is deleted: the
+  // lookup is then freed by the callback
+  struct Lookup {
+    std::atomic<int> state;  // 0: pending, 1: found, -1: failed, 2: dropped
+    uint32_t addr;
+  };
+  Lookup *lookup = nullptr;
+
+  static void DnsFound(const char *name, const ip_addr_t *ipaddr, void *arg) {
+    Lookup *l = (Lookup *)arg;
+    int pending = 0;
+    if (ipaddr) {
+      l->addr = ip_2_ip4(ipaddr)->addr;
+    }
+    if (!l->state.compare_exchange_strong(pending, ipaddr ? 1 : -1)) {
+      delete l;
+    }
+  }
+#endif
+
+  bool Start(uint32_t addr) {
+    fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) {
+      return false;
+    }
+    int one = 1;
+    ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+    struct sockaddr_in sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sin_family = AF_INET;
+    sa.sin_port = htons(port);
+    sa.sin_addr.s_addr = addr;
+    return ::connect(fd, (struct sockaddr *)&sa, sizeof(sa)) == 0 ||
+           errno == EINPROGRESS;
+  }
+
+ public:
+  ~JSHttpTcpSocket() {
+    if (fd >= 0) {
+      ::close(fd);
+    }
+#ifdef ARDUINO_ARCH_ESP32
+    int pending = 0;
+    if (lookup && !lookup->state.compare_exchange_strong(pending, 2)) {
+      delete lookup;
+    }
+#endif
+  }
+
+  bool Connect(const char *host, uint16_t port) override {
+    this->port = port;
+#ifdef ARDUINO_ARCH_ESP32
+    ip_addr_t ipaddr;
+    lookup = new Lookup();
+    lookup->state = 0;
+    err_t err = dns_gethostbyname(host, &ipaddr, DnsFound, lookup);
+    if (err == ERR_OK) {
+      lookup->addr = ip_2_ip4(&ipaddr)->addr;
+      lookup->state = 1;
+    } else if (err != ERR_INPROGRESS) {
+      lookup->state = -1;
+    }
+    return true;
+#else
+    // blocking, but immediate for the numeric addresses and localhost
+    struct addrinfo hints, *res;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    if (getaddrinfo(host, nullptr, &hints, &res) != 0) {
+      return false;
+    }
+    uint32_t addr = ((struct sockaddr_in *)res->ai_addr)->sin_addr.s_addr;
+    freeaddrinfo(res);
+    return Start(addr);
+#endif
+  }
+
+  int IsConnected() override {
+#ifdef ARDUINO_ARCH_ESP32
+    if (lookup) {
+      int state = lookup->state;
+      if (state == 0) {
+        return 0;
+      }
+      uint32_t addr = lookup->addr;
+      delete lookup;
+      lookup = nullptr;
+      if (state < 0 || !Start(addr)) {
+        return -1;
+      }
+    }
+#endif
+    fd_set wfds;
+    struct timeval tv = {0, 0};
+    FD_ZERO(&wfds);
+    FD_SET(fd, &wfds);
+    int n = ::select(fd + 1, nullptr, &wfds, nullptr, &tv);
+    if (n <= 0) {
+      return n < 0 ? -1 : 0;
+    }
+    int err = 0;
+    socklen_t len = sizeof(err);
+    if (::getsockopt(fd, SOL_SOCKET, SO_ERROR, &err, &len) < 0 || err) {
+      return -1;
+    }
+    return 1;
+  }
+
+  int Write(const uint8_t *buf, size_t len) override {
+#ifdef MSG_NOSIGNAL
+    int n = ::send(fd, buf, len, MSG_NOSIGNAL);
+#else
+    int n = ::send(fd, buf, len, 0);
+#endif
+    if (n < 0) {
+      return (errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : -1;
+    }
+    return n;
+  }
+
+  int Read(uint8_t *buf, size_t len) override {
+    int n = ::recv(fd, buf, len, 0);
+    if (n < 0) {
+      return (errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : -2;
+    }
+    return n == 0 ? -1 : n;
+  }
+};
+
 #ifdef ENABLE_WIFI
-class JSHttpFetcher {
-  struct Entry {
-    HTTPClient *client;
-    JSValue resolving_funcs[2];
-    int status;
-    void result(JSContext *ctx, uint32_t func, JSValue body) {
-      delete client;  // dispose connection before invoke;
-      JSValue r = JS_NewObject(ctx);
-      JS_SetPropertyStr(ctx, r, "body", JS_DupValue(ctx, body));
-      JS_SetPropertyStr(ctx, r, "status", JS_NewInt32(ctx, status));
-      JS_Call(ctx, resolving_funcs[func], JS_UNDEFINED, 1, &r);
-      JS_FreeValue(ctx, r);
-      JS_FreeValue(ctx, resolving_funcs[0]);
-      JS_FreeValue(ctx, resolving_funcs[1]);
+// Adapter for the Arduino clients (WiFiClientSecure for https). Connect()
+// blocks during the TLS handshake, the transfer does not.
+template <class C>
+class JSHttpClientSocket : public JSHttpSocket {
+  C client;
+
+ public:
+  bool Connect(const char *host, uint16_t port) override {
+    return client.connect(host, port);
+  }
+
+  int IsConnected() override { return client.connected() ? 1 : -1; }
+
+  int Write(const uint8_t *buf, size_t len) override {
+    return client.write(buf, len);
+  }
+
+  int Read(uint8_t *buf, size_t len) override {
+    int n = client.available();
+    if (n > 0) {
+      return client.read(buf, std::min(len, (size_t)n));
     }
+    return client.connected() ? 0 : -1;
+  }
+};
+#endif
+
+// esp32.fetch(): each request is a state machine advanced by loop(), with
+// at most maxConnections sockets open at once.
+class JSHttpFetcher {
+  enum State {
+    kQueued,
+    kConnecting,
+    kSending,
+    kStatusLine,
+    kHeaders,
+    kBody,       // 'remaining' bytes, or until the end of the stream if < 0
+    kChunkSize,
+    kChunkData,
+    kChunkEnd,   // CRLF after the chunk data
+    kTrailers,
+    kDone,
+    kFailed,
   };
-  std::vector<Entry *> queue;
+
+  struct Request {
+    State state = kQueued;
+    JSHttpSocket *sock = nullptr;
+    std::string host;
+    uint16_t port;
+    bool secure;
+    bool head;    // no body in the response
+    bool stream;  // resolve after the headers, the body is read in chunks
+    bool resolved = false;   // fetch() promise settled
+    bool cancelled = false;  // body cancelled or no longer reachable
+    JSHttpFetcher *fetcher;
+    std::string out;  // request not sent yet
+    size_t outPos = 0;
+    std::string line;  // status, header or chunk size line
+    int status = 0;
+    int64_t remaining = -1;
+    bool chunked = false;
+    std::string data;  // body received and not delivered yet
+    const char *error = nullptr;
+    // fetch() promise, then the pending read() of a streamed body
+    JSValue resolvingFuncs[2] = {JS_UNDEFINED, JS_UNDEFINED};
+    JSValue headers = JS_UNDEFINED;
+    JSValue reader = JS_UNDEFINED;  // not counted: cleared by the finalizer
+    uint32_t lastActivity = 0;
+  };
+  std::vector<Request *> requests;
+
+  static const size_t kMaxLine = 8192;
+  static const size_t kMaxBuffered = 4096;
+  static const int kReadsPerLoop = 8;
+
+  static void Settle(JSContext *ctx, Request *r, int func, JSValue v) {
+    JSValue ret = JS_Call(ctx, r->resolvingFuncs[func], JS_UNDEFINED, 1, &v);
+    JS_FreeValue(ctx, ret);
+    JS_FreeValue(ctx, v);
+    JS_FreeValue(ctx, r->resolvingFuncs[0]);
+    JS_FreeValue(ctx, r->resolvingFuncs[1]);
+    r->resolvingFuncs[0] = JS_UNDEFINED;
+    r->resolvingFuncs[1] = JS_UNDEFINED;
+  }
+
+  static bool IsPending(Request *r) {
+    return !JS_IsUndefined(r->resolvingFuncs[0]);
+  }
+
+  static JSValue NewError(JSContext *ctx, const char *msg) {
+    JSValue e = JS_NewError(ctx);
+    JS_SetPropertyStr(ctx, e, "message", JS_NewString(ctx, msg));
+    return e;
+  }
+
+  void Close(Request *r) {
+    delete r->sock;
+    r->sock = nullptr;
+  }
+
+  void Cancel(Request *r) {
+    Close(r);
+    r->state = kDone;
+    r->error = nullptr;
+    r->data.clear();
+  }
+
+  void Fail(Request *r, const char *msg) {
+    Close(r);
+    r->state = kFailed;
+    r->error = msg;
+  }
+
+  // settle the pending promise if the request has reached a point where
+  // it can be
+  void Deliver(JSContext *ctx, Request *r) {
+    if (!IsPending(r)) {
+      return;
+    }
+    if (r->state == kFailed) {
+      Settle(ctx, r, 1, NewError(ctx, r->error));
+      r->error = nullptr;
+    } else if (!r->resolved) {
+      if (r->state != kDone && !(r->stream && r->state > kHeaders)) {
+        return;
+      }
+      JSValue res = JS_NewObject(ctx);
+      JS_SetPropertyStr(ctx, res, "status", JS_NewInt32(ctx, r->status));
+      JS_SetPropertyStr(ctx, res, "headers", r->headers);
+      r->headers = JS_UNDEFINED;
+      if (r->stream) {
+        JSValue reader = JS_NewObjectClass(ctx, ReaderClassId());
+        JS_SetOpaque(reader, r);
+        r->reader = reader;
+        JS_SetPropertyStr(ctx, res, "body", reader);
+      } else {
+        JS_SetPropertyStr(ctx, res, "body",
+                          JS_NewStringLen(ctx, r->data.data(), r->data.size()));
+        r->data.clear();
+      }
+      r->resolved = true;
+      Settle(ctx, r, 0, res);
+    } else if (!r->data.empty() || r->state == kDone) {
+      // read() of a streamed body
+      JSValue res = JS_NewObject(ctx);
+      if (!r->data.empty()) {
+        JS_SetPropertyStr(
+            ctx, res, "value",
+            JS_NewArrayBufferCopy(ctx, (const uint8_t *)r->data.data(),
+                                  r->data.size()));
+        r->data.clear();
+      }
+      JS_SetPropertyStr(ctx, res, "done", JS_NewBool(ctx, r->state == kDone));
+      Settle(ctx, r, 0, res);
+    }
+  }
+
+  // end of the headers: choose how the body is delimited
+  void EndHeaders(Request *r) {
+    if (r->status >= 100 && r->status < 200) {
+      // interim response (100 Continue)
+      r->state = kStatusLine;
+      r->remaining = -1;
+      r->chunked = false;
+    } else if (r->head || r->status == 204 || r->status == 304) {
+      r->state = kDone;
+    } else if (r->chunked) {
+      r->state = kChunkSize;
+    } else if (r->remaining == 0) {
+      r->state = kDone;
+    } else {
+      r->state = kBody;
+    }
+  }
+
+  void ParseLine(JSContext *ctx, Request *r) {
+    std::string &line = r->line;
+    if (!line.empty() && line.back() == '\r') {
+      line.pop_back();
+    }
+    switch (r->state) {
+      case kStatusLine: {
+        int major, minor, status;
+        if (sscanf(line.c_str(), "HTTP/%d.%d %d", &major, &minor, &status) !=
+            3) {
+          Fail(r, "invalid HTTP response");
+          break;
+        }
+        r->status = status;
+        JS_FreeValue(ctx, r->headers);
+        r->headers = JS_NewObject(ctx);
+        r->state = kHeaders;
+        break;
+      }
+      case kHeaders: {
+        if (line.empty()) {
+          EndHeaders(r);
+          break;
+        }
+        size_t colon = line.find(':');
+        if (colon == std::string::npos) {
+          break;
+        }
+        std::string name = line.substr(0, colon);
+        for (char &c : name) {
+          c = tolower((unsigned char)c);
+        }
+        size_t start = line.find_first_not_of(" \t", colon + 1);
+        std::string value =
+            start == std::string::npos ? std::string() : line.substr(start);
+        while (!value.empty() && (value.back() == ' ' || value.back() == '\t')) {
+          value.pop_back();
+        }
+        if (name == "content-length") {
+          r->remaining = strtoll(value.c_str(), nullptr, 10);
+        } else if (name == "transfer-encoding" &&
+                   strstr(value.c_str(), "chunked")) {
+          r->chunked = true;
+        }
+        JSValue prev = JS_GetPropertyStr(ctx, r->headers, name.c_str());
+        if (JS_IsString(prev)) {
+          // repeated header
+          const char *str = JS_ToCString(ctx, prev);
+          if (str) {
+            value = std::string(str) + ", " + value;
+            JS_FreeCString(ctx, str);
+          }
+        }
+        JS_FreeValue(ctx, prev);
+        JS_SetPropertyStr(ctx, r->headers, name.c_str(),
+                          JS_NewStringLen(ctx, value.data(), value.size()));
+        break;
+      }
+      case kChunkSize: {
+        char *end;
+        r->remaining = strtoll(line.c_str(), &end, 16);
+        if (end == line.c_str() || r->remaining < 0) {
+          Fail(r, "invalid chunk size");
+        } else {
+          r->state = r->remaining == 0 ? kTrailers : kChunkData;
+        }
+        break;
+      }
+      case kChunkEnd:
+        r->state = kChunkSize;
+        break;
+      case kTrailers:
+        if (line.empty()) {
+          r->state = kDone;
+        }
+        break;
+      default:
+        break;
+    }
+    line.clear();
+  }
+
+  void Parse(JSContext *ctx, Request *r, const uint8_t *buf, size_t len) {
+    size_t i = 0;
+    while (i < len && r->state != kDone && r->state != kFailed) {
+      if (r->state == kBody || r->state == kChunkData) {
+        size_t n = len - i;
+        if (r->remaining >= 0 && (int64_t)n > r->remaining) {
+          n = r->remaining;
+        }
+        r->data.append((const char *)buf + i, n);
+        i += n;
+        if (r->remaining >= 0) {
+          r->remaining -= n;
+          if (r->remaining == 0) {
+            r->state = r->state == kBody ? kDone : kChunkEnd;
+          }
+        }
+        continue;
+      }
+      const uint8_t *nl = (const uint8_t *)memchr(buf + i, '\n', len - i);
+      size_t n = nl ? nl - (buf + i) : len - i;
+      r->line.append((const char *)buf + i, n);
+      i += n;
+      if (r->line.size() > kMaxLine) {
+        Fail(r, "HTTP header line too long");
+      } else if (nl) {
+        i++;
+        ParseLine(ctx, r);
+      }
+    }
+  }
+
+  bool Start(Request *r) {
+    r->sock = newSocket(r->secure);
+    if (!r->sock) {
+      Fail(r, "https is not supported");
+      return false;
+    }
+    if (!r->sock->Connect(r->host.c_str(), r->port)) {
+      Fail(r, "connection failed");
+      return false;
+    }
+    r->state = kConnecting;
+    return true;
+  }
+
+  // advance the request as far as possible without waiting
+  void Step(JSContext *ctx, Request *r, uint32_t now) {
+    uint8_t buf[512];
+    int reads = 0;
+    bool active = false;
+
+    while (r->state < kDone) {
+      if (r->state == kConnecting) {
+        int c = r->sock->IsConnected();
+        if (c < 0) {
+          Fail(r, "connection failed");
+        } else if (c > 0) {
+          r->state = kSending;
+          active = true;
+        } else {
+          break;
+        }
+      } else if (r->state == kSending) {
+        int n = r->sock->Write((const uint8_t *)r->out.data() + r->outPos,
+                               r->out.size() - r->outPos);
+        if (n < 0) {
+          Fail(r, "connection failed");
+          break;
+        }
+        r->outPos += n;
+        if (n > 0) {
+          active = true;
+        }
+        if (r->outPos < r->out.size()) {
+          break;
+        }
+        r->out = std::string();
+        r->state = kStatusLine;
+      } else {
+        if (reads++ == kReadsPerLoop) {
+          break;
+        }
+        // a streamed body is not read faster than the script reads it
+        if (r->stream && r->data.size() >= kMaxBuffered) {
+          active = true;
+          break;
+        }
+        int n = r->sock->Read(buf, sizeof(buf));
+        if (n == 0) {
+          break;
+        }
+        active = true;
+        if (n == -1 && r->state == kBody && r->remaining < 0) {
+          r->state = kDone;
+        } else if (n < 0) {
+          Fail(r, "connection closed");
+        } else {
+          Parse(ctx, r, buf, n);
+        }
+      }
+    }
+    if (r->state == kDone) {
+      Close(r);
+    } else if (active) {
+      r->lastActivity = now;
+    } else if (r->state != kFailed && now - r->lastActivity >= timeoutMs) {
+      Fail(r, "timeout");
+    }
+  }
+
+  static JSHttpSocket *NewSocket(bool secure) {
+#ifdef ENABLE_WIFI
+    if (secure) {
+      return new JSHttpClientSocket<WiFiClientSecure>();
+    }
+#endif
+    return secure ? nullptr : new JSHttpTcpSocket();
+  }
+
+  // nothing left to tell the script
+  static bool Finished(Request *r) {
+    if (r->state < kDone || IsPending(r)) {
+      return false;
+    }
+    return JS_IsUndefined(r->reader) || (r->data.empty() && !r->error);
+  }
+
+  static bool ParseUrl(const char *url, Request *r, std::string *path) {
+    const char *p;
+    if (!strncmp(url, "http://", 7)) {
+      r->secure = false;
+      r->port = 80;
+      p = url + 7;
+    } else if (!strncmp(url, "https://", 8)) {
+      r->secure = true;
+      r->port = 443;
+      p = url + 8;
+    } else {
+      return false;
+    }
+    size_t n = strcspn(p, ":/?#");
+    r->host.assign(p, n);
+    p += n;
+    if (*p == ':') {
+      char *end;
+      long port = strtol(p + 1, &end, 10);
+      if (port <= 0 || port > 65535) {
+        return false;
+      }
+      r->port = port;
+      p = end;
+    }
+    *path = *p == '/' ? "" : "/";
+    path->append(p, strcspn(p, "#"));
+    return !r->host.empty();
+  }
+
+  static JSClassID &ReaderClassId() {
+    static JSClassID id;
+    return id;
+  }
+
+  static void ReaderFinalizer(JSRuntime *rt, JSValue val) {
+    Request *r = (Request *)JS_GetOpaque(val, ReaderClassId());
+    if (r) {
+      r->reader = JS_UNDEFINED;
+      r->cancelled = true;
+    }
+  }
+
+  // body.read(): Promise<{value: ArrayBuffer, done: bool}>
+  static JSValue ReaderRead(JSContext *ctx, JSValueConst thisVal, int argc,
+                            JSValueConst *argv) {
+    Request *r = (Request *)JS_GetOpaque(thisVal, ReaderClassId());
+    if (r && IsPending(r)) {
+      return JS_ThrowTypeError(ctx, "read() is already pending");
+    }
+    JSValue funcs[2];
+    JSValue promise = JS_NewPromiseCapability(ctx, r ? r->resolvingFuncs : funcs);
+    if (JS_IsException(promise)) {
+      return promise;
+    }
+    if (r) {
+      r->fetcher->Deliver(ctx, r);
+    } else {
+      // the request is over
+      JSValue res = JS_NewObject(ctx);
+      JS_SetPropertyStr(ctx, res, "done", JS_TRUE);
+      JSValue ret = JS_Call(ctx, funcs[0], JS_UNDEFINED, 1, &res);
+      JS_FreeValue(ctx, ret);
+      JS_FreeValue(ctx, res);
+      JS_FreeValue(ctx, funcs[0]);
+      JS_FreeValue(ctx, funcs[1]);
+    }
+    return promise;
+  }
+
+  // body.cancel(): close the connection, the next read() is done
+  static JSValue ReaderCancel(JSContext *ctx, JSValueConst thisVal, int argc,
+                              JSValueConst *argv) {
+    Request *r = (Request *)JS_GetOpaque(thisVal, ReaderClassId());
+    if (r) {
+      r->cancelled = true;
+      r->fetcher->Cancel(r);
+    }
+    return JS_UNDEFINED;
+  }
+
+  void Free(JSContext *ctx, Request *r) {
+    Close(r);
+    if (!JS_IsUndefined(r->reader)) {
+      JS_SetOpaque(r->reader, nullptr);
+    }
+    JS_FreeValue(ctx, r->resolvingFuncs[0]);
+    JS_FreeValue(ctx, r->resolvingFuncs[1]);
+    JS_FreeValue(ctx, r->headers);
+    delete r;
+  }
 
  public:
+  // transport of the requests (replaced by the host tests)
+  JSHttpSocket *(*newSocket)(bool secure) = NewSocket;
+  // lwip has 10 sockets by default
+  int maxConnections = 8;
+  // a request without network activity for this time fails
+  uint32_t timeoutMs = 30000;
+
+  void init(JSContext *ctx) {
+    JSRuntime *rt = JS_GetRuntime(ctx);
+    JSClassID &id = ReaderClassId();
+    JS_NewClassID(&id);
+    if (!JS_IsRegisteredClass(rt, id)) {
+      JSClassDef def = {};
+      def.class_name = "HttpBody";
+      def.finalizer = ReaderFinalizer;
+      JS_NewClass(rt, id, &def);
+      JSValue proto = JS_NewObject(ctx);
+      JS_SetPropertyStr(ctx, proto, "read",
+                        JS_NewCFunction(ctx, ReaderRead, "read", 0));
+      JS_SetPropertyStr(ctx, proto, "cancel",
+                        JS_NewCFunction(ctx, ReaderCancel, "cancel", 0));
+      JS_SetClassProto(ctx, id, proto);
+    }
+  }
+
+  void end(JSContext *ctx) {
+    for (Request *r : requests) {
+      Free(ctx, r);
+    }
+    requests.clear();
+  }
+
   JSValue fetch(JSContext *ctx, JSValueConst jsUrl, JSValueConst options) {
+#ifdef ENABLE_WIFI
     if (WiFi.status() != WL_CONNECTED) {
-      return JS_EXCEPTION;
+      return JS_ThrowInternalError(ctx, "WiFi is not connected");
     }
+#endif
     const char *url = JS_ToCString(ctx, jsUrl);
     if (!url) {
       return JS_EXCEPTION;
     }
-    const char *method = nullptr, *body = nullptr;
+    Request *r = new Request();
+    r->fetcher = this;
+    std::string path;
+    bool ok = ParseUrl(url, r, &path);
+    JS_FreeCString(ctx, url);
+    if (!ok) {
+      delete r;
+      return JS_ThrowTypeError(ctx, "invalid URL");
+    }
+
+    std::string method = "GET", headers, body;
     if (JS_IsObject(options)) {
       JSValue m = JS_GetPropertyStr(ctx, options, "method");
       if (JS_IsString(m)) {
-        method = JS_ToCString(ctx, m);
+        const char *str = JS_ToCString(ctx, m);
+        if (str) {
+          method = str;
+          JS_FreeCString(ctx, str);
+        }
+      }
+      JS_FreeValue(ctx, m);
+
+      JSValue h = JS_GetPropertyStr(ctx, options, "headers");
+      JSPropertyEnum *tab;
+      uint32_t len;
+      if (JS_IsObject(h) &&
+          JS_GetOwnPropertyNames(ctx, &tab, &len, h,
+                                 JS_GPN_STRING_MASK | JS_GPN_ENUM_ONLY) == 0) {
+        for (uint32_t i = 0; i < len; i++) {
+          const char *name = JS_AtomToCString(ctx, tab[i].atom);
+          JSValue v = JS_GetProperty(ctx, h, tab[i].atom);
+          const char *value = JS_ToCString(ctx, v);
+          if (name && value) {
+            headers = headers + name + ": " + value + "\r\n";
+          }
+          JS_FreeCString(ctx, name);
+          JS_FreeCString(ctx, value);
+          JS_FreeValue(ctx, v);
+          JS_FreeAtom(ctx, tab[i].atom);
+        }
+        js_free(ctx, tab);
       }
+      JS_FreeValue(ctx, h);
+
       JSValue b = JS_GetPropertyStr(ctx, options, "body");
-      if (JS_IsString(m)) {
-        body = JS_ToCString(ctx, b);
+      size_t size;
+      if (JS_IsString(b)) {
+        const char *str = JS_ToCStringLen(ctx, &size, b);
+        if (str) {
+          body.assign(str, size);
+          JS_FreeCString(ctx, str);
+        }
+      } else if (JS_IsObject(b)) {
+        uint8_t *buf = JS_GetArrayBuffer(ctx, &size, b);
+        if (buf) {
+          body.assign((const char *)buf, size);
+        } else {
+          JS_FreeValue(ctx, JS_GetException(ctx));
+        }
       }
-    }
+      JS_FreeValue(ctx, b);
 
-    Entry *ent = new Entry();
-    ent->client = new HTTPClient();
-    ent->client->begin(url);
-    JS_FreeCString(ctx, url);
+      JSValue s = JS_GetPropertyStr(ctx, options, "stream");
+      r->stream = JS_ToBool(ctx, s);
+      JS_FreeValue(ctx, s);
+    }
 
-    // TODO: remove blocking calls.
-    if (method) {
-      ent->status = ent->client->sendRequest(method, (uint8_t *)body,
-                                             body ? strlen(body) : 0);
-    } else {
-      ent->status = ent->client->GET();
+    r->head = method == "HEAD";
+    r->out = method + " " + path + " HTTP/1.1\r\nHost: " + r->host;
+    if (r->port != (r->secure ? 443 : 80)) {
+      r->out += ":" + std::to_string(r->port);
     }
-    queue.push_back(ent);
+    r->out += "\r\nConnection: close\r\n" + headers;
+    if (!body.empty() || (method != "GET" && !r->head)) {
+      r->out += "Content-Length: " + std::to_string(body.size()) + "\r\n";
+    }
+    r->out += "\r\n" + body;
 
-    JS_FreeCString(ctx, method);
-    JS_FreeCString(ctx, body);
-    return JS_NewPromiseCapability(ctx, ent->resolving_funcs);
+    JSValue promise = JS_NewPromiseCapability(ctx, r->resolvingFuncs);
+    if (JS_IsException(promise)) {
+      delete r;
+      return promise;
+    }
+    requests.push_back(r);
+    return promise;
   }
 
   void loop(JSContext *ctx) {
-    int doneCount = 0;
-    for (auto &pent : queue) {
-      WiFiClient *stream = pent->client->getStreamPtr();
-      if (stream == nullptr || pent->status <= 0) {
-        // reject.
-        pent->result(ctx, 1, JS_UNDEFINED);
-        delete pent;
-        pent = nullptr;
-        doneCount++;
-        continue;
+    uint32_t now = millis();
+    int open = 0;
+    for (Request *r : requests) {
+      if (r->sock) {
+        open++;
+      }
+    }
+    for (size_t i = 0; i < requests.size(); i++) {
+      Request *r = requests[i];
+      bool hadSocket = r->sock != nullptr;
+      if (r->cancelled) {
+        Cancel(r);
+      } else if (r->state == kQueued) {
+        if (open >= maxConnections) {
+          continue;
+        }
+        r->lastActivity = now;
+        if (Start(r)) {
+          open++;
+          hadSocket = true;
+        }
       }
-      if (stream->available()) {
-        String body = pent->client->getString();
-        JSValue bodyStr = JS_NewString(ctx, body.c_str());
-        body.clear();
-        pent->result(ctx, 0, bodyStr);
-        JS_FreeValue(ctx, bodyStr);
-        delete pent;
-        pent = nullptr;
-        doneCount++;
+      if (r->state < kDone) {
+        Step(ctx, r, now);
       }
+      if (hadSocket && !r->sock) {
+        open--;
+      }
+      Deliver(ctx, r);
     }
 
-    if (doneCount > 0) {
-      queue.erase(std::remove_if(queue.begin(), queue.end(),
-                                 [](Entry *pent) { return pent == nullptr; }),
-                  queue.end());
+    size_t n = 0;
+    for (Request *r : requests) {
+      if (Finished(r)) {
+        Free(ctx, r);
+      } else {
+        requests[n++] = r;
+      }
     }
+    requests.resize(n);
   }
 };
-#endif  // ENABLE_WIFI
+#endif  // ENABLE_FETCH
 
 class JSTimer {
   // 20 bytes / entry.
@@ -146,59 +892,133 @@ class JSTimer {
     int32_t interval;
     JSValue func;
   };
-  std::vector<TimerEntry> timers;
+  // binary min-heap ordered by timeout: O(1) next timeout, O(log n)
+  // register and remove. 'pos' maps a timer id to its heap index.
+  std::vector<TimerEntry> heap;
+  std::unordered_map<uint32_t, uint32_t> pos;
   uint32_t id_counter = 0;
+  // position of the expired timers during ConsumeTimer()
+  static const uint32_t kExpired = UINT32_MAX;
+
+  // 2^32 wraparound safe as long as the timeouts are less than 2^31 ms
+  // (24 days) apart.
+  static bool Before(const TimerEntry &a, const TimerEntry &b) {
+    return (int32_t)(a.timeout - b.timeout) < 0;
+  }
+  void Place(uint32_t i, const TimerEntry &ent) {
+    heap[i] = ent;
+    pos[ent.id] = i;
+  }
+  void SiftUp(uint32_t i) {
+    TimerEntry ent = heap[i];
+    while (i > 0) {
+      uint32_t parent = (i - 1) / 2;
+      if (!Before(ent, heap[parent])) {
+        break;
+      }
+      Place(i, heap[parent]);
+      i = parent;
+    }
+    Place(i, ent);
+  }
+  void SiftDown(uint32_t i) {
+    TimerEntry ent = heap[i];
+    uint32_t n = heap.size();
+    for (;;) {
+      uint32_t child = 2 * i + 1;
+      if (child >= n) {
+        break;
+      }
+      if (child + 1 < n && Before(heap[child + 1], heap[child])) {
+        child++;
+      }
+      if (!Before(heap[child], ent)) {
+        break;
+      }
+      Place(i, heap[child]);
+      i = child;
+    }
+    Place(i, ent);
+  }
+  void Push(const TimerEntry &ent) {
+    heap.push_back(ent);
+    SiftUp(heap.size() - 1);
+  }
+  TimerEntry RemoveAt(uint32_t i) {
+    TimerEntry ent = heap[i];
+    pos.erase(ent.id);
+    TimerEntry last = heap.back();
+    heap.pop_back();
+    if (i < heap.size()) {
+      Place(i, last);
+      SiftDown(i);
+      SiftUp(i);
+    }
+    return ent;
+  }
 
  public:
   uint32_t RegisterTimer(JSValue f, int32_t time, int32_t interval = -1) {
     uint32_t id = ++id_counter;
-    timers.push_back(TimerEntry{id, time, interval, f});
+    Push(TimerEntry{id, time, interval, f});
     return id;
   }
-  void RemoveTimer(uint32_t id) {
-    timers.erase(std::remove_if(timers.begin(), timers.end(),
-                                [id](TimerEntry &t) { return t.id == id; }),
-                 timers.end());
+  void RemoveTimer(JSContext *ctx, uint32_t id) {
+    auto it = pos.find(id);
+    if (it == pos.end()) {
+      return;
+    }
+    if (it->second == kExpired) {
+      // freed by ConsumeTimer()
+      pos.erase(it);
+    } else {
+      JS_FreeValue(ctx, RemoveAt(it->second).func);
+    }
   }
   void RemoveAll(JSContext *ctx) {
-    for (auto &ent : timers) {
+    for (auto &ent : heap) {
       JS_FreeValue(ctx, ent.func);
     }
-    timers.clear();
+    heap.clear();
+    pos.clear();
   }
   int32_t GetNextTimeout(int32_t now) {
-    if (timers.empty()) {
+    if (heap.empty()) {
       return -1;
     }
-    std::sort(timers.begin(), timers.end(),
-              [now](TimerEntry &a, TimerEntry &b) -> bool {
-                return (a.timeout - now) >
-                       (b.timeout - now);  // 2^32 wraparound
-              });
-    int next = timers.back().timeout - now;
+    int next = heap.front().timeout - now;
     return max(next, 0);
   }
   bool ConsumeTimer(JSContext *ctx, int32_t now) {
     std::vector<TimerEntry> t;
     int32_t eps = 2;
-    while (!timers.empty() && timers.back().timeout - now <= eps) {
-      t.push_back(timers.back());
-      timers.pop_back();
+    while (!heap.empty() && heap.front().timeout - now <= eps) {
+      t.push_back(RemoveAt(0));
+      pos[t.back().id] = kExpired;
     }
     for (auto &ent : t) {
+      auto it = pos.find(ent.id);
+      if (it == pos.end()) {
+        // removed by a previous function
+        JS_FreeValue(ctx, ent.func);
+        continue;
+      }
+      pos.erase(it);
+      // the interval is registered again before the call so that the
+      // function can remove it.
+      JSValue func = ent.func;
+      if (ent.interval >= 0) {
+        ent.timeout = now + ent.interval;
+        Push(ent);
+        func = JS_DupValue(ctx, func);
+      }
       // NOTE: may update timers in this JS_Call().
-      JSValue r = JS_Call(ctx, ent.func, ent.func, 0, nullptr);
+      JSValue r = JS_Call(ctx, func, func, 0, nullptr);
       if (JS_IsException(r)) {
         qjs_dump_exception(ctx, r);
       }
       JS_FreeValue(ctx, r);
-
-      if (ent.interval >= 0) {
-        ent.timeout = now + ent.interval;
-        timers.push_back(ent);
-      } else {
-        JS_FreeValue(ctx, ent.func);
-      }
+      JS_FreeValue(ctx, func);
     }
     return !t.empty();
   }
@@ -208,14 +1028,24 @@ class ESP32QuickJS {
  public:
   JSRuntime *rt;
   JSContext *ctx;
+  JSMallocPool *pool = nullptr;
   JSTimer timer;
   JSValue loop_func = JS_UNDEFINED;
-#ifdef ENABLE_WIFI
+  // time slice given to the cycle collector at each loop() (0: disabled,
+  // the objects are then freed as soon as they are unreferenced)
+  int gcBudgetUs = 500;
+  // compile the functions of eval() at their first call: saves time and
+  // memory for large scripts that only use some of their functions
+  bool lazyFunctions = false;
+#ifdef ENABLE_FETCH
   JSHttpFetcher httpFetcher;
 #endif
 
   void begin() {
-    JSRuntime *rt = JS_NewRuntime();
+    // the small blocks (objects, shapes, short strings) are allocated
+    // from size class pools to limit the heap fragmentation
+    pool = JS_NewMallocPool();
+    JSRuntime *rt = JS_NewRuntime2(JS_GetMallocPoolFunctions(), pool);
     begin(rt, JS_NewContext(rt));
   }
 
@@ -227,15 +1057,87 @@ class ESP32QuickJS {
     }
     JS_SetMemoryLimit(rt, memoryLimit);
     JS_SetGCThreshold(rt, memoryLimit >> 3);
+    // the objects are freed by loop() within gcBudgetUs, so that freeing
+    // a large object graph does not stall a single JS_FreeValue()
+    JS_SetDeferredFree(rt, gcBudgetUs > 0);
     JSValue global = JS_GetGlobalObject(ctx);
     setup(ctx, global);
     JS_FreeValue(ctx, global);
   }
 
+  // Warm start: the whole heap is allocated in 'region', which must
+  // have the same address at each boot (e.g. a static buffer). Once the
+  // scripts are loaded, saveImage() writes the heap (e.g. to a flash
+  // partition) and the next boots call beginFromImage() instead of
+  // creating and initializing the context again.
+  void beginInRegion(void *region, size_t size) {
+    pool = JS_NewMallocPoolRegion(region, size);
+    JSRuntime *rt = JS_NewRuntime2(JS_GetMallocPoolFunctions(), pool);
+    begin(rt, JS_NewContext(rt), size);
+  }
+
+  // The image holds C function pointers: it is tagged with buildId
+  // (by default the SHA-256 of the firmware ELF on ESP32) and
+  // beginFromImage() rejects the images of another build.
+  static void imageBuildId(const void **buildId, size_t *buildIdLen) {
+#ifdef ARDUINO_ARCH_ESP32
+    if (!*buildId) {
+#if ESP_IDF_VERSION_MAJOR >= 5
+      *buildId = esp_app_get_description()->app_elf_sha256;
+#else
+      *buildId = esp_ota_get_app_description()->app_elf_sha256;
+#endif
+      *buildIdLen = 32;
+    }
+#endif
+  }
+
+  // The timers and the loop function are not part of the image: save
+  // it before starting them.
+  bool saveImage(JSHeapImageWriteFunc *write_func, void *opaque,
+                 const void *buildId = nullptr, size_t buildIdLen = 0) {
+    if (timer.GetNextTimeout(millis()) >= 0 || !JS_IsUndefined(loop_func)) {
+      return false;
+    }
+    imageBuildId(&buildId, &buildIdLen);
+    if (JS_SaveHeapImage(ctx, buildId, buildIdLen, write_func, opaque) < 0) {
+      qjs_dump_exception(ctx, JS_UNDEFINED);
+      return false;
+    }
+    return true;
+  }
+
+  bool beginFromImage(void *region, size_t size, const void *image,
+                      size_t imageSize, const void *buildId = nullptr,
+                      size_t buildIdLen = 0) {
+    imageBuildId(&buildId, &buildIdLen);
+    JSContext *ctx = JS_LoadHeapImage(region, size, image, imageSize,
+                                      buildId, buildIdLen);
+    if (!ctx) {
+      return false;
+    }
+    // the pool is in the region: nothing to free in end()
+    pool = nullptr;
+    this->rt = JS_GetRuntime(ctx);
+    this->ctx = ctx;
+    JS_SetContextOpaque(ctx, this);
+#ifdef ENABLE_FETCH
+    httpFetcher.init(ctx);
+#endif
+    return true;
+  }
+
   void end() {
     timer.RemoveAll(ctx);
+#ifdef ENABLE_FETCH
+    httpFetcher.end(ctx);
+#endif
     JS_FreeContext(ctx);
     JS_FreeRuntime(rt);
+    if (pool) {
+      JS_FreeMallocPool(pool);
+      pool = nullptr;
+    }
   }
 
   void loop(bool callLoopFn = true) {
@@ -252,7 +1154,7 @@ class ESP32QuickJS {
       timer.ConsumeTimer(ctx, now);
     }
 
-#ifdef ENABLE_WIFI
+#ifdef ENABLE_FETCH
     httpFetcher.loop(ctx);
 #endif
 
@@ -264,10 +1166,17 @@ class ESP32QuickJS {
       }
       JS_FreeValue(ctx, ret);
     }
+
+    // gc: gcBudgetUs may have changed since begin(). Without budget,
+    // nothing would free the deferred objects.
+    JS_SetDeferredFree(rt, gcBudgetUs > 0);
+    runGCStep(gcBudgetUs);
   }
 
   void runGC() { JS_RunGC(rt); }
 
+  void runGCStep(int budgetUs) { JS_RunGCStep(rt, budgetUs); }
+
   bool exec(const char *code) {
     JSValue result = eval(code);
     bool ret = JS_IsException(result);
@@ -276,14 +1185,37 @@ class ESP32QuickJS {
   }
 
   JSValue eval(const char *code) {
-    JSValue ret =
-        JS_Eval(ctx, code, strlen(code), "<eval>", JS_EVAL_TYPE_MODULE);
+    int flags = JS_EVAL_TYPE_MODULE;
+    if (lazyFunctions) {
+      flags |= JS_EVAL_FLAG_LAZY;
+    }
+    JSValue ret = JS_Eval(ctx, code, strlen(code), "<eval>", flags);
     if (JS_IsException(ret)) {
       qjs_dump_exception(ctx, ret);
     }
     return ret;
   }
 
+  // Run bytecode generated by 'qjsc -c' (or 'qjsc -b') directly from
+  // flash: the buffer is not copied and must stay valid until the
+  // runtime is freed.
+  bool execBinary(const uint8_t *buf, size_t len) {
+    JSValue obj = JS_ReadObject(ctx, buf, len,
+                                JS_READ_OBJ_BYTECODE | JS_READ_OBJ_ROM_DATA);
+    if (!JS_IsException(obj) && JS_VALUE_GET_TAG(obj) == JS_TAG_MODULE &&
+        JS_ResolveModule(ctx, obj) < 0) {
+      JS_FreeValue(ctx, obj);
+      obj = JS_EXCEPTION;
+    }
+    JSValue result = JS_IsException(obj) ? obj : JS_EvalFunction(ctx, obj);
+    bool ret = JS_IsException(result);
+    if (ret) {
+      qjs_dump_exception(ctx, result);
+    }
+    JS_FreeValue(ctx, result);
+    return ret;
+  }
+
   void setLoopFunc(const char *fname) {
     JSValue global = JS_GetGlobalObject(ctx);
     setLoopFunc(JS_GetPropertyStr(ctx, global, fname));
@@ -306,6 +1238,10 @@ class ESP32QuickJS {
     JS_SetPropertyStr(ctx, console, "log",
                       JS_NewCFunction(ctx, console_log, "log", 1));
 
+#ifdef ENABLE_FETCH
+    httpFetcher.init(ctx);
+#endif
+
     // timer
     JS_SetPropertyStr(ctx, global, "setTimeout",
                       JS_NewCFunction(ctx, set_timeout, "setTimeout", 2));
@@ -341,6 +1277,8 @@ class ESP32QuickJS {
         JSCFunctionListEntry{"isWifiConnected", 0, JS_DEF_CFUNC, 0, {
                                func : {0, JS_CFUNC_generic, wifi_is_connected}
                              }},
+#endif
+#ifdef ENABLE_FETCH
         JSCFunctionListEntry{"fetch", 0, JS_DEF_CFUNC, 0, {
                                func : {2, JS_CFUNC_generic, http_fetch}
                              }},
@@ -396,7 +1334,7 @@ class ESP32QuickJS {
     ESP32QuickJS *qjs = (ESP32QuickJS *)JS_GetContextOpaque(ctx);
     uint32_t tid;
     JS_ToUint32(ctx, &tid, argv[0]);
-    qjs->timer.RemoveTimer(tid);
+    qjs->timer.RemoveTimer(ctx, tid);
     return JS_UNDEFINED;
   }
 
@@ -460,7 +1398,9 @@ class ESP32QuickJS {
                                    int argc, JSValueConst *argv) {
     return JS_NewBool(ctx, WiFi.status() == WL_CONNECTED);
   }
+#endif
 
+#ifdef ENABLE_FETCH
   static JSValue http_fetch(JSContext *ctx, JSValueConst jsThis, int argc,
                             JSValueConst *argv) {
     ESP32QuickJS *qjs = (ESP32QuickJS *)JS_GetContextOpaque(ctx);
@@ -0,0 +1,30 @@
+// Minimal stub of the Arduino API used by esp32/QuickJS.h to build it on
+// a host computer. millis() returns host_millis, set by the program.
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+
+using std::max;
+
+static uint32_t host_millis;
+
+static inline uint32_t millis() { return host_millis; }
+
+struct HostSerial {
+  void println(const char *str) { puts(str); }
+};
+static HostSerial Serial;
+
+struct HostESP {
+  uint32_t getFreeHeap() { return 4 * 1024 * 1024; }
+  void deepSleep(uint64_t) {}
+};
+static HostESP ESP;
+
+static inline void pinMode(uint8_t, uint8_t) {}
+static inline int digitalRead(uint8_t) { return 0; }
+static inline void digitalWrite(uint8_t, uint8_t) {}
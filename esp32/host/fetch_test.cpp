@@ -0,0 +1,340 @@
+// Host test of esp32.fetch() (JSHttpFetcher in esp32/QuickJS.h) against a
+// local HTTP server: the Arduino API is stubbed and the requests go
+// through the TCP sockets of the host.
+//
+//   make esp32-fetch-test
+
+#define ENABLE_FETCH
+
+#include <signal.h>
+
+#include <chrono>
+#include <thread>
+
+#include "../QuickJS.h"
+
+static std::atomic<int> open_connections, max_open_connections;
+
+static double GetTimeMs() {
+  using namespace std::chrono;
+  return duration_cast<microseconds>(
+             steady_clock::now().time_since_epoch()).count() / 1000.0;
+}
+
+static void Send(int fd, const std::string &s) {
+  send(fd, s.data(), s.size(), MSG_NOSIGNAL);
+}
+
+static void Sleep(int ms) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+static void Serve(int fd) {
+  int n = ++open_connections;
+  int max = max_open_connections;
+  while (n > max && !max_open_connections.compare_exchange_weak(max, n)) {
+  }
+
+  // request line, headers and body
+  std::string req;
+  char buf[1024];
+  size_t end;
+  while ((end = req.find("\r\n\r\n")) == std::string::npos) {
+    ssize_t len = recv(fd, buf, sizeof(buf), 0);
+    if (len <= 0) {
+      goto done;
+    }
+    req.append(buf, len);
+  }
+  {
+    std::string method = req.substr(0, req.find(' '));
+    size_t p = method.size() + 1;
+    std::string path = req.substr(p, req.find(' ', p) - p);
+    std::string lower = req.substr(0, end);
+    for (char &c : lower) {
+      c = tolower((unsigned char)c);
+    }
+    size_t cl = lower.find("content-length: ");
+    size_t bodyLen = cl == std::string::npos ? 0 : atoi(&lower[cl + 16]);
+    while (req.size() < end + 4 + bodyLen) {
+      ssize_t len = recv(fd, buf, sizeof(buf), 0);
+      if (len <= 0) {
+        goto done;
+      }
+      req.append(buf, len);
+    }
+    std::string body = req.substr(end + 4, bodyLen);
+
+    if (path == "/len") {
+      Send(fd, "HTTP/1.1 200 OK\r\nContent-Length: 5\r\n\r\n");
+      if (method != "HEAD") {
+        Send(fd, "hello");
+      }
+    } else if (path == "/chunked") {
+      Send(fd, "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n");
+      for (const char *s : {"3\r\nabc\r\n", "7;ext=1\r\ndefghij\r\n",
+                            "0\r\nX-Trailer: 1\r\n\r\n"}) {
+        Sleep(5);
+        Send(fd, s);
+      }
+    } else if (path == "/close") {
+      Send(fd, "HTTP/1.0 200 OK\r\nSet-Cookie: a=1\r\nSet-Cookie: b=2\r\n\r\n"
+               "until close");
+    } else if (path == "/slow") {
+      // a blocking client would stall for the whole response
+      for (const char *s : {"HTTP/1.1 200", " OK\r\n", "Content-Length:",
+                            " 4\r\n", "\r", "\n", "s", "l", "o", "w"}) {
+        Sleep(30);
+        Send(fd, s);
+      }
+    } else if (path == "/continue") {
+      Send(fd, "HTTP/1.1 100 Continue\r\n\r\n"
+               "HTTP/1.1 201 Created\r\nContent-Length: 2\r\n\r\nok");
+    } else if (path == "/echo") {
+      size_t h = lower.find("x-test: ");
+      std::string test = h == std::string::npos
+                             ? "-"
+                             : lower.substr(h + 8, lower.find("\r\n", h) - h - 8);
+      std::string res = method + " " + body + " " + test;
+      Send(fd, "HTTP/1.1 200 OK\r\nContent-Length: " +
+                   std::to_string(res.size()) + "\r\n\r\n" + res);
+    } else if (path == "/big") {
+      Send(fd, "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n");
+      std::string chunk = "3e8\r\n" + std::string(1000, 'x') + "\r\n";
+      for (int i = 0; i < 100; i++) {
+        Send(fd, chunk);
+      }
+      Send(fd, "0\r\n\r\n");
+    } else if (path == "/hang") {
+      while (recv(fd, buf, sizeof(buf), 0) > 0) {
+      }
+    } else {
+      Send(fd, "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\n\r\n");
+    }
+  }
+done:
+  open_connections--;
+  close(fd);
+}
+
+static int Listen(uint16_t *port) {
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  struct sockaddr_in sa;
+  socklen_t len = sizeof(sa);
+  memset(&sa, 0, sizeof(sa));
+  sa.sin_family = AF_INET;
+  sa.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if (fd < 0 || bind(fd, (struct sockaddr *)&sa, sizeof(sa)) < 0 ||
+      listen(fd, 64) < 0 ||
+      getsockname(fd, (struct sockaddr *)&sa, &len) < 0) {
+    perror("listen");
+    exit(1);
+  }
+  *port = ntohs(sa.sin_port);
+  return fd;
+}
+
+static void ServerThread(int fd) {
+  for (;;) {
+    int c = accept(fd, nullptr, nullptr);
+    if (c < 0) {
+      break;
+    }
+    std::thread(Serve, c).detach();
+  }
+}
+
+static const char *test_script = R"(
+import * as esp32 from "esp32";
+
+const base = "http://127.0.0.1:" + globalThis.port;
+
+function check(name, cond) {
+  if (!cond) {
+    errors.push(name);
+  }
+}
+
+async function readAll(body) {
+  let size = 0, chunks = 0;
+  for (;;) {
+    const r = await body.read();
+    if (r.value) {
+      size += r.value.byteLength;
+      chunks++;
+    }
+    if (r.done) {
+      return [size, chunks];
+    }
+  }
+}
+
+async function main() {
+  let r = await esp32.fetch(base + "/len");
+  check("content-length", r.status === 200 && r.body === "hello" &&
+        r.headers["content-length"] === "5");
+
+  r = await esp32.fetch(base + "/len", {method: "HEAD"});
+  check("head", r.status === 200 && r.body === "");
+
+  r = await esp32.fetch(base + "/chunked");
+  check("chunked", r.body === "abcdefghij");
+
+  r = await esp32.fetch(base + "/close");
+  check("close", r.body === "until close" &&
+        r.headers["set-cookie"] === "a=1, b=2");
+
+  r = await esp32.fetch(base + "/slow");
+  check("slow", r.body === "slow");
+
+  r = await esp32.fetch(base + "/continue");
+  check("continue", r.status === 201 && r.body === "ok");
+
+  r = await esp32.fetch(base + "/echo",
+                        {method: "POST", body: "data", headers: {"X-Test": 42}});
+  check("post", r.body === "POST data 42");
+
+  r = await esp32.fetch(base + "/echo",
+                        {method: "PUT", body: new Uint8Array([65, 66]).buffer});
+  check("array buffer body", r.body === "PUT AB -");
+
+  r = await esp32.fetch(base + "/missing");
+  check("not found", r.status === 404 && r.body === "");
+
+  r = await esp32.fetch(base + "/big", {stream: true});
+  check("stream headers", r.status === 200 &&
+        r.headers["transfer-encoding"] === "chunked");
+  const [size, chunks] = await readAll(r.body);
+  check("stream body", size === 100000 && chunks > 1);
+  check("stream end", (await r.body.read()).done);
+
+  r = await esp32.fetch(base + "/big", {stream: true});
+  await r.body.read();
+  r.body.cancel();
+  check("cancel", (await r.body.read()).done);
+
+  // the body is never read: the connection is closed when it is freed
+  await esp32.fetch(base + "/big", {stream: true});
+
+  const all = [];
+  for (let i = 0; i < 50; i++) {
+    all.push(esp32.fetch(base + "/echo", {method: "PUT", body: String(i)}));
+  }
+  const res = await Promise.all(all);
+  check("concurrent", res.every((r, i) => r.body === "PUT " + i + " -"));
+
+  try {
+    await esp32.fetch("http://127.0.0.1:" + globalThis.closedPort + "/");
+    check("refused", false);
+  } catch (e) {
+    check("refused", e.message === "connection failed");
+  }
+
+  try {
+    esp32.fetch("ftp://127.0.0.1/");
+    check("invalid url", false);
+  } catch (e) {
+    check("invalid url", e instanceof TypeError);
+  }
+}
+
+globalThis.errors = [];
+main().catch((e) => errors.push(String(e))).finally(() => globalThis.done = true);
+)";
+
+static JSValue GetGlobal(ESP32QuickJS &qjs, const char *name) {
+  JSValue global = JS_GetGlobalObject(qjs.ctx);
+  JSValue v = JS_GetPropertyStr(qjs.ctx, global, name);
+  JS_FreeValue(qjs.ctx, global);
+  return v;
+}
+
+static void SetGlobalInt(ESP32QuickJS &qjs, const char *name, int n) {
+  JSValue global = JS_GetGlobalObject(qjs.ctx);
+  JS_SetPropertyStr(qjs.ctx, global, name, JS_NewInt32(qjs.ctx, n));
+  JS_FreeValue(qjs.ctx, global);
+}
+
+// run loop() until the global 'done' is set, returns the longest loop()
+static double RunUntilDone(ESP32QuickJS &qjs) {
+  double max_ms = 0;
+  double deadline = GetTimeMs() + 10000;
+  for (;;) {
+    JSValue done = GetGlobal(qjs, "done");
+    bool ret = JS_ToBool(qjs.ctx, done);
+    JS_FreeValue(qjs.ctx, done);
+    if (ret || GetTimeMs() > deadline) {
+      return max_ms;
+    }
+    double t0 = GetTimeMs();
+    qjs.loop(false);
+    max_ms = std::max(max_ms, GetTimeMs() - t0);
+    Sleep(1);
+  }
+}
+
+int main() {
+  uint16_t port, closed_port;
+  int ok = 1;
+
+  signal(SIGPIPE, SIG_IGN);
+  std::thread(ServerThread, Listen(&port)).detach();
+  close(Listen(&closed_port));
+
+  ESP32QuickJS qjs;
+  qjs.begin();
+  SetGlobalInt(qjs, "port", port);
+  SetGlobalInt(qjs, "closedPort", closed_port);
+  qjs.exec(test_script);
+  double max_ms = RunUntilDone(qjs);
+
+  JSValue errors = GetGlobal(qjs, "errors");
+  JSValue str = JS_JSONStringify(qjs.ctx, errors, JS_UNDEFINED, JS_UNDEFINED);
+  const char *s = JS_ToCString(qjs.ctx, str);
+  if (!s || strcmp(s, "[]")) {
+    printf("fetch: FAILED %s\n", s ? s : "");
+    ok = 0;
+  }
+  JS_FreeCString(qjs.ctx, s);
+  JS_FreeValue(qjs.ctx, str);
+  JS_FreeValue(qjs.ctx, errors);
+  if (max_open_connections > qjs.httpFetcher.maxConnections) {
+    printf("fetch: %d connections open at once\n",
+           (int)max_open_connections);
+    ok = 0;
+  }
+  // the slow response takes 300 ms
+  if (max_ms > 50) {
+    printf("fetch: loop() blocked for %.1f ms\n", max_ms);
+    ok = 0;
+  }
+
+  // no activity for timeoutMs
+  qjs.httpFetcher.timeoutMs = 1000;
+  SetGlobalInt(qjs, "done", 0);
+  qjs.exec(
+      "import * as esp32 from 'esp32';"
+      "esp32.fetch('http://127.0.0.1:' + globalThis.port + '/hang')"
+      "  .catch((e) => globalThis.timeoutError = e.message)"
+      "  .finally(() => globalThis.done = true);");
+  for (int i = 0; i < 20; i++) {
+    qjs.loop(false);
+    Sleep(1);
+  }
+  host_millis += 1000;
+  RunUntilDone(qjs);
+  JSValue msg = GetGlobal(qjs, "timeoutError");
+  s = JS_ToCString(qjs.ctx, msg);
+  if (!s || strcmp(s, "timeout")) {
+    printf("fetch: no timeout\n");
+    ok = 0;
+  }
+  JS_FreeCString(qjs.ctx, s);
+  JS_FreeValue(qjs.ctx, msg);
+
+  qjs.end();
+  if (ok) {
+    printf("fetch: OK\n");
+  }
+  return !ok;
+}
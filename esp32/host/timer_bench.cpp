@@ -0,0 +1,102 @@
+// Host benchmark of the timer queue of esp32/QuickJS.h: the Arduino API
+// is stubbed and millis() is advanced by the benchmark.
+//
+//   make esp32-timer-bench
+
+#include <chrono>
+
+#include "../QuickJS.h"
+
+static double GetTimeUs() {
+  using namespace std::chrono;
+  return duration_cast<nanoseconds>(
+             steady_clock::now().time_since_epoch()).count() / 1000.0;
+}
+
+static int32_t GetGlobalInt(ESP32QuickJS &qjs, const char *name) {
+  JSValue global = JS_GetGlobalObject(qjs.ctx);
+  JSValue v = JS_GetPropertyStr(qjs.ctx, global, name);
+  int32_t n = 0;
+  JS_ToInt32(qjs.ctx, &n, v);
+  JS_FreeValue(qjs.ctx, v);
+  JS_FreeValue(qjs.ctx, global);
+  return n;
+}
+
+// 'n' intervals (one per sensor channel) with periods of 1 to 10 s
+static void BenchTimers(int n) {
+  const int loops = 20000;
+  const int churn = 20000;
+  char code[256];
+  ESP32QuickJS qjs;
+  double t0, idle_us, churn_us;
+
+  qjs.begin();
+  qjs.gcBudgetUs = 0;
+  host_millis = 0;
+  snprintf(code, sizeof(code),
+           "globalThis.count = 0;"
+           "for (let i = 0; i < %d; i++)"
+           "  setInterval(() => count++, 1000 + (i * 7919) %% 9000);",
+           n);
+  qjs.exec(code);
+
+  // loop() iterations where no timer expires
+  t0 = GetTimeUs();
+  for (int i = 0; i < loops; i++) {
+    qjs.loop(false);
+  }
+  idle_us = GetTimeUs() - t0;
+
+  // register and remove a timeout while the intervals are pending
+  snprintf(code, sizeof(code),
+           "for (let i = 0; i < %d; i++)"
+           "  clearTimeout(setTimeout(() => {}, 500));",
+           churn);
+  t0 = GetTimeUs();
+  qjs.exec(code);
+  churn_us = GetTimeUs() - t0;
+
+  // run 60 s of simulated time, 1 ms per loop()
+  for (int i = 0; i < 60000; i++) {
+    host_millis++;
+    qjs.loop(false);
+  }
+  printf("%6d %12.1f %12.1f %10d\n", n, idle_us * 1000 / loops,
+         churn_us * 1000 / churn, GetGlobalInt(qjs, "count"));
+  qjs.end();
+}
+
+// the timers must expire in order when millis() wraps around
+static bool CheckWraparound() {
+  ESP32QuickJS qjs;
+  qjs.begin();
+  host_millis = UINT32_MAX - 50;
+  qjs.exec(
+      "globalThis.order = 0;"
+      "setTimeout(() => order = order * 10 + 3, 150);"
+      "setTimeout(() => order = order * 10 + 1, 10);"
+      "setTimeout(() => order = order * 10 + 2, 100);"
+      "let id = setTimeout(() => order = order * 10 + 9, 120);"
+      "clearTimeout(id);");
+  for (int i = 0; i < 200; i++) {
+    host_millis++;
+    qjs.loop(false);
+  }
+  bool ok = GetGlobalInt(qjs, "order") == 123;
+  qjs.end();
+  return ok;
+}
+
+int main() {
+  if (!CheckWraparound()) {
+    printf("wraparound: FAILED\n");
+    return 1;
+  }
+  printf("%6s %12s %12s %10s\n", "timers", "idle ns/loop", "set+clear ns",
+         "calls/60s");
+  for (int n : {10, 100, 500, 2000}) {
+    BenchTimers(n);
+  }
+  return 0;
+}
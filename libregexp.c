@@ -103,8 +103,34 @@ static const REOpCode reopcode_info[REOP_COUNT] = {
 #define RE_HEADER_FLAGS         0
 #define RE_HEADER_CAPTURE_COUNT 1
 #define RE_HEADER_STACK_SIZE    2
+#define RE_HEADER_ENGINE        7
 
-#define RE_HEADER_LEN 7
+#define RE_HEADER_LEN 8
+
+/* engine used by lre_exec() */
+#define RE_ENGINE_BACKTRACK 0
+#define RE_ENGINE_PIKE      1 /* lock step execution of the threads */
+
+/* maximum bytecode length of the regexps run by the Pike VM */
+#define RE_PIKE_LEN_MAX 4096
+/* maximum nesting of the loops whose body may not advance */
+#define RE_PIKE_LOOP_DEPTH_MAX 4
+
+/* the backtracking is tried first for the Pike VM bytecode because it
+   is faster when it does not explode. Maximum number of states: */
+#define RE_BACKTRACK_STATES_MIN      256
+#define RE_BACKTRACK_STATES_PER_CHAR 4
+
+/* prefilter stored after the bytecode if LRE_FLAG_PREFILTER is set:
+   length (u8), type (u8), data */
+#define RE_PREFILTER_ANCHORED 0 /* can only match at position 0 */
+#define RE_PREFILTER_LITERAL  1 /* count (u8), UTF-16 code units (u16) */
+#define RE_PREFILTER_CHARSET  2 /* others (u8), bitmap of the first chars < 256 */
+
+#define RE_PREFILTER_LITERAL_MAX 16
+
+/* size of the loop over the start positions of the non sticky regexps */
+#define RE_START_LOOP_LEN (5 + 1 + 5)
 
 static inline int is_digit(int c) {
     return c >= '0' && c <= '9';
@@ -282,11 +308,11 @@ static __maybe_unused void lre_dump_bytecode(const uint8_t *buf,
     re_flags=  buf[0];
     bc_len = get_u32(buf + 3);
     assert(bc_len + RE_HEADER_LEN <= buf_len);
-    printf("flags: 0x%x capture_count=%d stack_size=%d\n",
-           re_flags, buf[1], buf[2]);
+    printf("flags: 0x%x capture_count=%d stack_size=%d engine=%d\n",
+           re_flags, buf[1], buf[2], buf[RE_HEADER_ENGINE]);
     if (re_flags & LRE_FLAG_NAMED_GROUPS) {
         const char *p;
-        p = (char *)buf + RE_HEADER_LEN + bc_len;
+        p = lre_get_groupnames(buf);
         printf("named groups: ");
         for(i = 1; i < buf[1]; i++) {
             if (i != 1)
@@ -1814,6 +1840,451 @@ static int compute_stack_size(const uint8_t *bc_buf, int bc_buf_len)
     return stack_size_max;
 }
 
+typedef struct {
+    uint8_t bitmap[32]; /* characters < 256 which can start a match */
+    BOOL others; /* TRUE if characters >= 256 can start a match */
+    BOOL ignore_case;
+    BOOL is_utf16;
+    int fuel; /* limits the number of visited opcodes */
+} REFirstChars;
+
+static void re_first_chars_add(REFirstChars *fc, uint32_t low, uint32_t high)
+{
+    uint32_t c, c1;
+
+    if (fc->ignore_case) {
+        /* the input characters are canonicalized before the test */
+        for(c = 0; c < 256; c++) {
+            c1 = lre_canonicalize(c, fc->is_utf16);
+            if (c1 >= low && c1 <= high)
+                fc->bitmap[c >> 3] |= 1 << (c & 7);
+        }
+        fc->others = TRUE;
+    } else {
+        for(c = low; c <= high && c < 256; c++)
+            fc->bitmap[c >> 3] |= 1 << (c & 7);
+        if (high >= 256)
+            fc->others = TRUE;
+    }
+}
+
+/* add to 'fc' the characters which can be read first by the bytecode
+   at 'pos'. Return -1 if it can be any character or if the bytecode
+   can match without reading a character. */
+static int re_first_chars(REFirstChars *fc, const uint8_t *bc_buf, int pos)
+{
+    int opcode, len, n, i;
+    uint32_t val;
+
+    for(;;) {
+        if (--fc->fuel < 0)
+            return -1;
+        opcode = bc_buf[pos];
+        len = reopcode_info[opcode].size;
+        switch(opcode) {
+        case REOP_char:
+            val = get_u16(bc_buf + pos + 1);
+            re_first_chars_add(fc, val, val);
+            return 0;
+        case REOP_char32:
+            val = get_u32(bc_buf + pos + 1);
+            re_first_chars_add(fc, val, val);
+            return 0;
+        case REOP_range:
+            n = get_u16(bc_buf + pos + 1);
+            for(i = 0; i < n; i++) {
+                re_first_chars_add(fc, get_u16(bc_buf + pos + 3 + i * 4),
+                                   get_u16(bc_buf + pos + 3 + i * 4 + 2));
+            }
+            return 0;
+        case REOP_range32:
+            n = get_u16(bc_buf + pos + 1);
+            for(i = 0; i < n; i++) {
+                re_first_chars_add(fc, get_u32(bc_buf + pos + 3 + i * 8),
+                                   get_u32(bc_buf + pos + 3 + i * 8 + 4));
+            }
+            return 0;
+        case REOP_save_start:
+        case REOP_save_end:
+        case REOP_save_reset:
+        case REOP_line_start:
+        case REOP_line_end:
+        case REOP_word_boundary:
+        case REOP_not_word_boundary:
+            break;
+        case REOP_goto:
+            pos += len + (int)get_u32(bc_buf + pos + 1);
+            continue;
+        case REOP_split_goto_first:
+        case REOP_split_next_first:
+            if (re_first_chars(fc, bc_buf,
+                               pos + len + (int)get_u32(bc_buf + pos + 1)))
+                return -1;
+            break;
+        case REOP_simple_greedy_quant:
+            if (re_first_chars(fc, bc_buf, pos + len))
+                return -1;
+            if (get_u32(bc_buf + pos + 5) != 0)
+                return 0;
+            pos += len + (int)get_u32(bc_buf + pos + 1);
+            continue;
+        default:
+            return -1;
+        }
+        pos += len;
+    }
+}
+
+/* Append to the bytecode what a match must start with, so that
+   lre_exec() does not try the positions where it would fail at
+   once. Only used if the regexp is not sticky. */
+static void re_emit_prefilter(REParseState *s)
+{
+    const uint8_t *bc_buf = s->byte_code.buf + RE_HEADER_LEN;
+    uint8_t buf[3 + 32]; /* >= 3 + RE_PREFILTER_LITERAL_MAX * 2 */
+    uint16_t lit[RE_PREFILTER_LITERAL_MAX];
+    REFirstChars fc;
+    int pos, opcode, n, i;
+    uint32_t val;
+    BOOL anchored;
+
+    pos = RE_START_LOOP_LEN;
+    n = 0;
+    anchored = FALSE;
+    for(;;) {
+        opcode = bc_buf[pos];
+        switch(opcode) {
+        case REOP_line_start:
+            if (!(s->re_flags & LRE_FLAG_MULTILINE) && n == 0)
+                anchored = TRUE;
+            break;
+        case REOP_save_start:
+        case REOP_save_end:
+        case REOP_save_reset:
+        case REOP_line_end:
+        case REOP_word_boundary:
+        case REOP_not_word_boundary:
+            break;
+        case REOP_char:
+            if (s->ignore_case || n >= RE_PREFILTER_LITERAL_MAX)
+                goto done;
+            lit[n++] = get_u16(bc_buf + pos + 1);
+            break;
+        case REOP_char32:
+            if (s->ignore_case || n + 2 > RE_PREFILTER_LITERAL_MAX)
+                goto done;
+            /* surrogate pair */
+            val = get_u32(bc_buf + pos + 1) - 0x10000;
+            lit[n++] = 0xd800 | (val >> 10);
+            lit[n++] = 0xdc00 | (val & 0x3ff);
+            break;
+        default:
+            goto done;
+        }
+        pos += reopcode_info[opcode].size;
+    }
+ done:
+    if (anchored) {
+        buf[0] = 2;
+        buf[1] = RE_PREFILTER_ANCHORED;
+    } else if (n > 0) {
+        buf[0] = 3 + n * 2;
+        buf[1] = RE_PREFILTER_LITERAL;
+        buf[2] = n;
+        for(i = 0; i < n; i++)
+            put_u16(buf + 3 + i * 2, lit[i]);
+    } else {
+        memset(&fc, 0, sizeof(fc));
+        fc.ignore_case = s->ignore_case;
+        fc.is_utf16 = s->is_utf16;
+        fc.fuel = 64;
+        if (re_first_chars(&fc, bc_buf, RE_START_LOOP_LEN))
+            return;
+        if (fc.others) {
+            for(i = 0; i < 32; i++) {
+                if (fc.bitmap[i] != 0xff)
+                    break;
+            }
+            if (i == 32)
+                return; /* no character is excluded */
+        }
+        buf[0] = 3 + 32;
+        buf[1] = RE_PREFILTER_CHARSET;
+        buf[2] = fc.others;
+        memcpy(buf + 3, fc.bitmap, 32);
+    }
+    dbuf_put(&s->byte_code, buf, buf[0]);
+    s->byte_code.buf[RE_HEADER_FLAGS] |= LRE_FLAG_PREFILTER;
+}
+
+/* the body of REOP_simple_greedy_quant is included */
+static int re_get_op_len(const uint8_t *pc)
+{
+    int len;
+    len = reopcode_info[*pc].size;
+    if (*pc == REOP_range)
+        len += get_u16(pc + 1) * 4;
+    else if (*pc == REOP_range32)
+        len += get_u16(pc + 1) * 8;
+    else if (*pc == REOP_simple_greedy_quant)
+        len += get_u32(pc + 1);
+    return len;
+}
+
+/* Return TRUE if all the paths from 'start' read a character before
+   reaching 'end'. The backward jumps are ignored because they close
+   loops on paths already tested. 'adv' has 'end' - 'start' + 1
+   elements. */
+static BOOL re_always_advances(const uint8_t *bc_buf, int start, int end,
+                               uint8_t *adv)
+{
+    int pos, len, target, next;
+    BOOL ret;
+
+    /* mark the opcode positions */
+    memset(adv, 0, end - start + 1);
+    for(pos = start; pos < end; pos += re_get_op_len(bc_buf + pos))
+        adv[pos - start] = 2;
+    adv[end - start] = FALSE;
+    /* the forward jumps are computed first */
+    for(pos = end - 1; pos >= start; pos--) {
+        if (adv[pos - start] != 2)
+            continue;
+        len = re_get_op_len(bc_buf + pos);
+        next = pos + len;
+        switch(bc_buf[pos]) {
+        case REOP_char:
+        case REOP_char32:
+        case REOP_dot:
+        case REOP_any:
+        case REOP_range:
+        case REOP_range32:
+            ret = TRUE;
+            break;
+        case REOP_simple_greedy_quant:
+            ret = (get_u32(bc_buf + pos + 5) > 0 || adv[next - start]);
+            break;
+        case REOP_goto:
+        case REOP_split_goto_first:
+        case REOP_split_next_first:
+        case REOP_bne_char_pos:
+            target = next + (int)get_u32(bc_buf + pos + 1);
+            if (target > end)
+                return FALSE;
+            ret = (target <= pos || adv[target - start]);
+            if (bc_buf[pos] != REOP_goto)
+                ret &= adv[next - start];
+            break;
+        case REOP_save_start:
+        case REOP_save_end:
+        case REOP_save_reset:
+        case REOP_line_start:
+        case REOP_line_end:
+        case REOP_word_boundary:
+        case REOP_not_word_boundary:
+        case REOP_push_char_pos:
+            ret = adv[next - start];
+            break;
+        default:
+            return FALSE;
+        }
+        adv[pos - start] = ret;
+    }
+    return adv[0];
+}
+
+/* Return the position of the REOP_bne_char_pos closing the loop whose
+   REOP_push_char_pos is at 'pos' or -1 if not found. */
+static int re_find_loop_end(const uint8_t *bc_buf, int bc_buf_len, int pos)
+{
+    int end;
+
+    for(end = pos + 1; end < bc_buf_len; end += re_get_op_len(bc_buf + end)) {
+        if (bc_buf[end] == REOP_bne_char_pos &&
+            end + 5 + (int)get_u32(bc_buf + end + 1) == pos - 5)
+            return end;
+    }
+    return -1;
+}
+
+/* Return TRUE if the bytecode can be run by the Pike VM (no back
+   reference, lookaround or counter) and if it contains a loop whose
+   body has an alternative or another loop, for which the backtracking
+   can take an exponential time. */
+static BOOL re_need_pike(REParseState *s, const uint8_t *bc_buf,
+                         int bc_buf_len)
+{
+    int pos, pos1, opcode, target, end;
+    BOOL ambiguous;
+
+    bc_buf += RE_HEADER_LEN;
+    bc_buf_len -= RE_HEADER_LEN;
+    if (bc_buf_len > RE_PIKE_LEN_MAX)
+        return FALSE;
+    ambiguous = FALSE;
+    for(pos = 0; pos < bc_buf_len; pos += re_get_op_len(bc_buf + pos)) {
+        opcode = bc_buf[pos];
+        switch(opcode) {
+        case REOP_back_reference:
+        case REOP_backward_back_reference:
+        case REOP_lookahead:
+        case REOP_negative_lookahead:
+        case REOP_prev:
+        case REOP_push_i32:
+        case REOP_loop:
+        case REOP_drop:
+            goto fail;
+        case REOP_push_char_pos:
+            if (re_find_loop_end(bc_buf, bc_buf_len, pos) < 0)
+                goto fail;
+            break;
+        case REOP_goto:
+        case REOP_split_goto_first:
+        case REOP_split_next_first:
+        case REOP_bne_char_pos:
+            target = pos + 5 + (int)get_u32(bc_buf + pos + 1);
+            /* backward jump, except the loop over the start positions */
+            if (target >= pos || target == 0 || ambiguous)
+                break;
+            end = pos;
+            pos1 = target;
+            /* skip the split exiting the loop */
+            if ((bc_buf[pos1] == REOP_split_goto_first ||
+                 bc_buf[pos1] == REOP_split_next_first) &&
+                pos1 + 5 + (int)get_u32(bc_buf + pos1 + 1) > end)
+                pos1 += 5;
+            while (pos1 < end) {
+                switch(bc_buf[pos1]) {
+                case REOP_split_goto_first:
+                case REOP_split_next_first:
+                case REOP_simple_greedy_quant:
+                    ambiguous = TRUE;
+                    break;
+                }
+                pos1 += re_get_op_len(bc_buf + pos1);
+            }
+            break;
+        }
+    }
+    return ambiguous;
+ fail:
+    return FALSE;
+}
+
+static int64_t re_quant_len(int body_len, int quant_min, int quant_max)
+{
+    int64_t len;
+    len = (int64_t)quant_min * body_len;
+    if (quant_max == INT32_MAX)
+        len += 5 + body_len + 5;
+    else
+        len += (int64_t)(quant_max - quant_min) * (5 + body_len);
+    return len;
+}
+
+/* Replace the simple greedy quantifiers with copies of their body and
+   splits so that the Pike VM does not need a counter. The checks that
+   the loop bodies advance are removed when they cannot fail. Return -1
+   if the bytecode would be too long or if not enough memory. */
+static int re_expand_quantifiers(REParseState *s)
+{
+    const uint8_t *bc_buf = s->byte_code.buf + RE_HEADER_LEN;
+    int bc_len = s->byte_code.size - RE_HEADER_LEN;
+    int pos, len, opcode, target, body_len, quant_min, quant_max, i, n, end;
+    int64_t new_len;
+    int *new_pos;
+    uint8_t *adv, *keep_check;
+    DynBuf dbuf;
+
+    new_pos = lre_realloc(s->opaque, NULL, sizeof(new_pos[0]) * (bc_len + 1) +
+                          2 * (bc_len + 1));
+    if (!new_pos)
+        return -1;
+    adv = (uint8_t *)(new_pos + bc_len + 1);
+    keep_check = adv + bc_len + 1;
+    memset(keep_check, 0, bc_len + 1);
+    /* compute the new position of each opcode */
+    new_len = 0;
+    for(pos = 0; pos < bc_len; pos += len) {
+        new_pos[pos] = new_len;
+        len = re_get_op_len(bc_buf + pos);
+        if (bc_buf[pos] == REOP_simple_greedy_quant) {
+            body_len = get_u32(bc_buf + pos + 1) - 1; /* without REOP_match */
+            new_len += re_quant_len(body_len, get_u32(bc_buf + pos + 5),
+                                    get_u32(bc_buf + pos + 9));
+        } else if (bc_buf[pos] == REOP_push_char_pos) {
+            end = re_find_loop_end(bc_buf, bc_len, pos);
+            if (!re_always_advances(bc_buf, pos + 1, end, adv)) {
+                keep_check[pos] = keep_check[end] = TRUE;
+                new_len += len;
+            }
+        } else {
+            new_len += len;
+        }
+        if (new_len > RE_PIKE_LEN_MAX) {
+            lre_realloc(s->opaque, new_pos, 0);
+            return -1;
+        }
+    }
+    new_pos[bc_len] = new_len;
+
+    dbuf_init2(&dbuf, s->opaque, lre_realloc);
+    dbuf_put(&dbuf, s->byte_code.buf, RE_HEADER_LEN);
+    for(pos = 0; pos < bc_len; pos += len) {
+        opcode = bc_buf[pos];
+        len = re_get_op_len(bc_buf + pos);
+        switch(opcode) {
+        case REOP_push_char_pos:
+            if (keep_check[pos])
+                dbuf_putc(&dbuf, opcode);
+            break;
+        case REOP_bne_char_pos:
+            if (!keep_check[pos])
+                opcode = REOP_goto;
+            /* fall thru */
+        case REOP_goto:
+        case REOP_split_goto_first:
+        case REOP_split_next_first:
+            target = pos + 5 + (int)get_u32(bc_buf + pos + 1);
+            dbuf_putc(&dbuf, opcode);
+            dbuf_put_u32(&dbuf, new_pos[target] - (new_pos[pos] + 5));
+            break;
+        case REOP_simple_greedy_quant:
+            body_len = get_u32(bc_buf + pos + 1) - 1;
+            quant_min = get_u32(bc_buf + pos + 5);
+            quant_max = get_u32(bc_buf + pos + 9);
+            for(i = 0; i < quant_min; i++)
+                dbuf_put(&dbuf, bc_buf + pos + 17, body_len);
+            if (quant_max == INT32_MAX) {
+                dbuf_putc(&dbuf, REOP_split_next_first);
+                dbuf_put_u32(&dbuf, body_len + 5);
+                dbuf_put(&dbuf, bc_buf + pos + 17, body_len);
+                dbuf_putc(&dbuf, REOP_goto);
+                dbuf_put_u32(&dbuf, -(body_len + 5 + 5));
+            } else {
+                n = quant_max - quant_min;
+                for(i = 0; i < n; i++) {
+                    dbuf_putc(&dbuf, REOP_split_next_first);
+                    dbuf_put_u32(&dbuf, (n - i) * (5 + body_len) - 5);
+                    dbuf_put(&dbuf, bc_buf + pos + 17, body_len);
+                }
+            }
+            break;
+        default:
+            dbuf_put(&dbuf, bc_buf + pos, len);
+            break;
+        }
+    }
+    lre_realloc(s->opaque, new_pos, 0);
+    if (dbuf_error(&dbuf)) {
+        dbuf_free(&dbuf);
+        return -1;
+    }
+    dbuf_free(&s->byte_code);
+    s->byte_code = dbuf;
+    return 0;
+}
+
 /* 'buf' must be a zero terminated UTF-8 string of length buf_len.
    Return NULL if error and allocate an error message in *perror_msg,
    otherwise the compiled bytecode and its length in plen.
@@ -1847,6 +2318,7 @@ uint8_t *lre_compile(int *plen, char *error_msg, int error_msg_size,
     dbuf_putc(&s->byte_code, 0); /* second element is the number of captures */
     dbuf_putc(&s->byte_code, 0); /* stack size */
     dbuf_put_u32(&s->byte_code, 0); /* bytecode length */
+    dbuf_putc(&s->byte_code, RE_ENGINE_BACKTRACK); /* engine */
     
     if (!is_sticky) {
         /* iterate thru all positions (about the same as .*?( ... ) )
@@ -1890,8 +2362,19 @@ uint8_t *lre_compile(int *plen, char *error_msg, int error_msg_size,
     
     s->byte_code.buf[RE_HEADER_CAPTURE_COUNT] = s->capture_count;
     s->byte_code.buf[RE_HEADER_STACK_SIZE] = stack_size;
+    if (stack_size <= RE_PIKE_LOOP_DEPTH_MAX &&
+        re_need_pike(s, s->byte_code.buf, s->byte_code.size) &&
+        re_expand_quantifiers(s) == 0) {
+        /* only the remaining advance checks use the stack */
+        s->byte_code.buf[RE_HEADER_STACK_SIZE] =
+            compute_stack_size(s->byte_code.buf, s->byte_code.size);
+        s->byte_code.buf[RE_HEADER_ENGINE] = RE_ENGINE_PIKE;
+    }
     put_u32(s->byte_code.buf + 3, s->byte_code.size - RE_HEADER_LEN);
 
+    if (!is_sticky)
+        re_emit_prefilter(s);
+    
     /* add the named groups if needed */
     if (s->group_names.size > (s->capture_count - 1)) {
         dbuf_put(&s->byte_code, s->group_names.buf, s->group_names.size);
@@ -2045,6 +2528,7 @@ typedef struct {
     uint8_t *state_stack;
     size_t state_stack_size;
     size_t state_stack_len;
+    size_t state_budget; /* maximum number of pushed states */
 } REExecContext;
 
 static int push_state(REExecContext *s,
@@ -2058,6 +2542,9 @@ static int push_state(REExecContext *s,
     size_t new_size, i, n;
     StackInt *stack_buf;
 
+    if (unlikely(s->state_budget == 0))
+        return -1;
+    s->state_budget--;
     if (unlikely((s->state_stack_len + 1) > s->state_stack_size)) {
         /* reallocate the stack */
         new_size = s->state_stack_size * 3 / 2;
@@ -2493,6 +2980,734 @@ static intptr_t lre_exec_backtrack(REExecContext *s, uint8_t **capture,
     }
 }
 
+static inline BOOL is_pair_end(const uint16_t *p, int i)
+{
+    return (p[i] >= 0xdc00 && p[i] < 0xe000 &&
+            p[i - 1] >= 0xd800 && p[i - 1] < 0xdc00);
+}
+
+/* Return the first position >= cindex where a match may start or -1
+   if none. In UTF-16 mode, the positions inside a surrogate pair
+   after 'start' are never tried. */
+static int lre_find_start(const uint8_t *pf, const uint8_t *cbuf,
+                          int start, int cindex, int clen, int cbuf_type)
+{
+    const uint16_t *cbuf16 = (const uint16_t *)cbuf;
+    const uint8_t *p, *p_end, *bitmap;
+    uint16_t lit[RE_PREFILTER_LITERAL_MAX];
+    uint8_t lit8[RE_PREFILTER_LITERAL_MAX];
+    int n, i;
+    uint32_t c;
+    BOOL others;
+
+    switch(pf[1]) {
+    case RE_PREFILTER_ANCHORED:
+        return cindex == 0 ? 0 : -1;
+    case RE_PREFILTER_LITERAL:
+        n = pf[2];
+        if (clen - cindex < n)
+            return -1;
+        if (cbuf_type == 0) {
+            for(i = 0; i < n; i++) {
+                c = get_u16(pf + 3 + i * 2);
+                if (c > 0xff)
+                    return -1;
+                lit8[i] = c;
+            }
+            p = cbuf + cindex;
+            p_end = cbuf + clen - n + 1;
+            for(;;) {
+                p = memchr(p, lit8[0], p_end - p);
+                if (!p)
+                    return -1;
+                if (!memcmp(p + 1, lit8 + 1, n - 1))
+                    return p - cbuf;
+                p++;
+            }
+        } else {
+            for(i = 0; i < n; i++)
+                lit[i] = get_u16(pf + 3 + i * 2);
+            for(i = cindex; i <= clen - n; i++) {
+                if (cbuf16[i] == lit[0] &&
+                    !memcmp(cbuf16 + i + 1, lit + 1, (n - 1) * 2) &&
+                    !(cbuf_type == 2 && i > start && is_pair_end(cbuf16, i)))
+                    return i;
+            }
+        }
+        break;
+    case RE_PREFILTER_CHARSET:
+        others = pf[2];
+        bitmap = pf + 3;
+        if (cbuf_type == 0) {
+            for(i = cindex; i < clen; i++) {
+                c = cbuf[i];
+                if ((bitmap[c >> 3] >> (c & 7)) & 1)
+                    return i;
+            }
+        } else {
+            for(i = cindex; i < clen; i++) {
+                c = cbuf16[i];
+                if (c < 256 ? (bitmap[c >> 3] >> (c & 7)) & 1 : others) {
+                    if (!(cbuf_type == 2 && i > start && is_pair_end(cbuf16, i)))
+                        return i;
+                }
+            }
+        }
+        break;
+    }
+    return -1;
+}
+
+/* Pike VM: all the threads are run in lock step, so the execution
+   time is linear in the input length instead of exponential for
+   some regexps. It is only used for the bytecode selected by
+   re_need_pike(), which has no back reference, lookaround or
+   counter. The position saved by each REOP_push_char_pos is kept
+   with the captures of the thread, after them. A thread inside a loop
+   whose body did not advance yet behaves differently at the
+   REOP_bne_char_pos, so the opcodes are visited once per number of
+   such loops. */
+
+typedef struct {
+    const uint8_t *pc; /* consuming opcode or REOP_match */
+    uint8_t **capture;
+} REThread;
+
+typedef struct {
+    int count;
+    REThread *threads; /* by order of priority */
+} REThreadList;
+
+typedef struct {
+    const uint8_t *pc; /* NULL if capture[index] must be restored to val */
+    int index;
+    uint8_t *val;
+} REPikeJob;
+
+typedef struct {
+    int pos; /* offset of the REOP_push_char_pos */
+    int end; /* offset of the REOP_bne_char_pos closing the loop */
+    int parent; /* index of the enclosing loop, -1 if none */
+} REPikeLoop;
+
+typedef struct {
+    REExecContext *s;
+    const uint8_t *bc_buf;
+    int state_len; /* 2 * capture_count + loop_count */
+    int loop_count;
+    int loop_depth; /* maximum nesting level of the loops */
+    REPikeLoop *loops; /* sorted by position */
+    uint32_t gen; /* incremented for each character */
+    uint32_t *visited; /* last generation at which each opcode was reached,
+                          for each number of loops which did not advance */
+    REPikeJob *jobs;
+    uint8_t **capture; /* captures of the thread being followed */
+} REPikeState;
+
+/* lazy DFA used to reject quickly the long inputs without match */
+#define RE_DFA_STATES_MAX  32
+#define RE_DFA_THREADS_MAX 64
+#define RE_DFA_LEN_MIN     256 /* minimum input length */
+
+typedef struct {
+    uint8_t next[256]; /* 0 if not computed yet, otherwise state index + 1 */
+    BOOL is_match;
+    int count;
+    int *pcs; /* sorted offsets of the consuming opcodes */
+} REDFAState;
+
+static BOOL re_range16_match(const uint8_t *p, int n, uint32_t c)
+{
+    int idx_min, idx_max, idx;
+
+    /* 0xffff in for last value means +infinity */
+    if (c >= 0xffff && get_u16(p + (n - 1) * 4 + 2) == 0xffff)
+        return TRUE;
+    idx_min = 0;
+    idx_max = n - 1;
+    while (idx_min <= idx_max) {
+        idx = (idx_min + idx_max) / 2;
+        if (c < get_u16(p + idx * 4))
+            idx_max = idx - 1;
+        else if (c > get_u16(p + idx * 4 + 2))
+            idx_min = idx + 1;
+        else
+            return TRUE;
+    }
+    return FALSE;
+}
+
+static BOOL re_range32_match(const uint8_t *p, int n, uint32_t c)
+{
+    int idx_min, idx_max, idx;
+
+    idx_min = 0;
+    idx_max = n - 1;
+    while (idx_min <= idx_max) {
+        idx = (idx_min + idx_max) / 2;
+        if (c < get_u32(p + idx * 8))
+            idx_max = idx - 1;
+        else if (c > get_u32(p + idx * 8 + 4))
+            idx_min = idx + 1;
+        else
+            return TRUE;
+    }
+    return FALSE;
+}
+
+/* Return the length of the consuming opcode at 'pc' if it accepts the
+   character 'c' ('c1' is 'c' canonicalized if ignore case), 0
+   otherwise. */
+static int re_pike_step(const uint8_t *pc, uint32_t c, uint32_t c1)
+{
+    int n;
+
+    switch(pc[0]) {
+    case REOP_char:
+        return get_u16(pc + 1) == c1 ? 3 : 0;
+    case REOP_char32:
+        return get_u32(pc + 1) == c1 ? 5 : 0;
+    case REOP_dot:
+        return !is_line_terminator(c);
+    case REOP_any:
+        return 1;
+    case REOP_range:
+        n = get_u16(pc + 1);
+        return re_range16_match(pc + 3, n, c1) ? 3 + n * 4 : 0;
+    case REOP_range32:
+        n = get_u16(pc + 1);
+        return re_range32_match(pc + 3, n, c1) ? 3 + n * 8 : 0;
+    default: /* REOP_match */
+        return 0;
+    }
+}
+
+/* Return the index of the last loop starting before 'pos' or -1 */
+static int re_pike_find_loop(REPikeState *ps, int pos)
+{
+    int idx_min, idx_max, idx;
+
+    idx_min = 0;
+    idx_max = ps->loop_count - 1;
+    while (idx_min <= idx_max) {
+        idx = (idx_min + idx_max) / 2;
+        if (ps->loops[idx].pos < pos)
+            idx_min = idx + 1;
+        else
+            idx_max = idx - 1;
+    }
+    return idx_max;
+}
+
+/* Return the index in the thread captures of the position saved by
+   the REOP_push_char_pos at offset 'pos'. */
+static inline int re_pike_loop_index(REPikeState *ps, int pos)
+{
+    return 2 * ps->s->capture_count + re_pike_find_loop(ps, pos + 1);
+}
+
+/* Return the index in ps->visited of the opcode at offset 'pos' for
+   the thread whose captures are ps->capture. The loops whose body did
+   not advance since 'cptr' are the innermost ones containing 'pos'.
+   They do not matter once a character is read, so there is at most
+   one thread per consuming opcode. */
+static int re_pike_state_index(REPikeState *ps, int pos, const uint8_t *cptr)
+{
+    int i, n, base;
+
+    if (ps->loop_count == 0)
+        return pos;
+    switch(ps->bc_buf[pos]) {
+    case REOP_char:
+    case REOP_char32:
+    case REOP_dot:
+    case REOP_any:
+    case REOP_range:
+    case REOP_range32:
+    case REOP_match:
+        return pos * (ps->loop_depth + 1);
+    }
+    i = re_pike_find_loop(ps, pos);
+    while (i >= 0 && ps->loops[i].end < pos)
+        i = ps->loops[i].parent;
+    base = 2 * ps->s->capture_count;
+    n = 0;
+    while (i >= 0 && ps->capture[base + i] == cptr) {
+        n++;
+        i = ps->loops[i].parent;
+    }
+    return pos * (ps->loop_depth + 1) + n;
+}
+
+/* Add to 'list' by order of priority the threads reached from 'pc'
+   without reading a character at 'cptr'. ps->capture contains the
+   captures of the thread and is restored on return. */
+static void re_pike_add(REPikeState *ps, REThreadList *list,
+                        const uint8_t *pc, const uint8_t *cptr)
+{
+    REExecContext *s = ps->s;
+    int cbuf_type = s->cbuf_type;
+    REPikeJob *job;
+    REThread *th;
+    int njobs, idx, i, opcode;
+    uint32_t c;
+    BOOL v1, v2;
+
+    njobs = 0;
+    for(;;) {
+        idx = pc - ps->bc_buf;
+        i = re_pike_state_index(ps, idx, cptr);
+        if (ps->visited[i] == ps->gen)
+            goto next_job;
+        ps->visited[i] = ps->gen;
+        opcode = pc[0];
+        switch(opcode) {
+        case REOP_goto:
+            pc += 5 + (int)get_u32(pc + 1);
+            break;
+        case REOP_split_goto_first:
+        case REOP_split_next_first:
+            job = &ps->jobs[njobs++];
+            if (opcode == REOP_split_next_first) {
+                job->pc = pc + 5 + (int)get_u32(pc + 1);
+                pc += 5;
+            } else {
+                job->pc = pc + 5;
+                pc += 5 + (int)get_u32(pc + 1);
+            }
+            break;
+        case REOP_save_start:
+        case REOP_save_end:
+            i = 2 * pc[1] + opcode - REOP_save_start;
+            job = &ps->jobs[njobs++];
+            job->pc = NULL;
+            job->index = i;
+            job->val = ps->capture[i];
+            ps->capture[i] = (uint8_t *)cptr;
+            pc += 2;
+            break;
+        case REOP_save_reset:
+            for(i = 2 * pc[1]; i < 2 * pc[2] + 2; i++) {
+                job = &ps->jobs[njobs++];
+                job->pc = NULL;
+                job->index = i;
+                job->val = ps->capture[i];
+                ps->capture[i] = NULL;
+            }
+            pc += 3;
+            break;
+        case REOP_push_char_pos:
+            i = re_pike_loop_index(ps, idx);
+            job = &ps->jobs[njobs++];
+            job->pc = NULL;
+            job->index = i;
+            job->val = ps->capture[i];
+            ps->capture[i] = (uint8_t *)cptr;
+            pc++;
+            break;
+        case REOP_bne_char_pos:
+            /* leave the loop if its body did not advance */
+            i = re_pike_loop_index(ps, idx + 5 + (int)get_u32(pc + 1) + 5);
+            if (ps->capture[i] != cptr)
+                pc += 5 + (int)get_u32(pc + 1);
+            else
+                pc += 5;
+            break;
+        case REOP_line_start:
+            if (cptr != s->cbuf) {
+                if (!s->multi_line)
+                    goto next_job;
+                PEEK_PREV_CHAR(c, cptr, s->cbuf);
+                if (!is_line_terminator(c))
+                    goto next_job;
+            }
+            pc++;
+            break;
+        case REOP_line_end:
+            if (cptr != s->cbuf_end) {
+                if (!s->multi_line)
+                    goto next_job;
+                PEEK_CHAR(c, cptr, s->cbuf_end);
+                if (!is_line_terminator(c))
+                    goto next_job;
+            }
+            pc++;
+            break;
+        case REOP_word_boundary:
+        case REOP_not_word_boundary:
+            if (cptr == s->cbuf) {
+                v1 = FALSE;
+            } else {
+                PEEK_PREV_CHAR(c, cptr, s->cbuf);
+                v1 = is_word_char(c);
+            }
+            if (cptr >= s->cbuf_end) {
+                v2 = FALSE;
+            } else {
+                PEEK_CHAR(c, cptr, s->cbuf_end);
+                v2 = is_word_char(c);
+            }
+            if (v1 ^ v2 ^ (REOP_not_word_boundary - opcode))
+                goto next_job;
+            pc++;
+            break;
+        default:
+            /* consuming opcode or REOP_match */
+            th = &list->threads[list->count++];
+            th->pc = pc;
+            memcpy(th->capture, ps->capture,
+                   sizeof(ps->capture[0]) * ps->state_len);
+        next_job:
+            for(;;) {
+                if (njobs == 0)
+                    return;
+                job = &ps->jobs[--njobs];
+                if (job->pc)
+                    break;
+                ps->capture[job->index] = job->val;
+            }
+            pc = job->pc;
+            break;
+        }
+    }
+}
+
+/* Add to 'pcs' the offsets of the consuming opcodes reached from
+   'pc'. Return the new count. */
+static int re_dfa_add(REPikeState *ps, int *pcs, int count,
+                      const uint8_t *pc)
+{
+    int njobs, idx;
+
+    njobs = 0;
+    for(;;) {
+        idx = pc - ps->bc_buf;
+        if (ps->visited[idx] != ps->gen) {
+            ps->visited[idx] = ps->gen;
+            switch(pc[0]) {
+            case REOP_goto:
+                pc += 5 + (int)get_u32(pc + 1);
+                continue;
+            case REOP_split_goto_first:
+            case REOP_split_next_first:
+                ps->jobs[njobs++].pc = pc + 5 + (int)get_u32(pc + 1);
+                pc += 5;
+                continue;
+            case REOP_save_start:
+            case REOP_save_end:
+                pc += 2;
+                continue;
+            case REOP_save_reset:
+                pc += 3;
+                continue;
+            case REOP_push_char_pos:
+                pc++;
+                continue;
+            case REOP_bne_char_pos:
+                /* both exits are followed: the DFA only proves that
+                   there is no match */
+                ps->jobs[njobs++].pc = pc + 5 + (int)get_u32(pc + 1);
+                pc += 5;
+                continue;
+            default:
+                pcs[count++] = idx;
+                break;
+            }
+        }
+        if (njobs == 0)
+            break;
+        pc = ps->jobs[--njobs].pc;
+    }
+    return count;
+}
+
+/* Return the index of the state containing the opcodes pcs[0 .. count
+   - 1] after creating it if needed, or -1 if too many states. */
+static int re_dfa_find_state(REPikeState *ps, REDFAState *states,
+                             int *pstate_count, int *pcs, int count)
+{
+    REDFAState *st;
+    int i, j, tmp;
+
+    /* insertion sort: the states are small */
+    for(i = 1; i < count; i++) {
+        tmp = pcs[i];
+        for(j = i; j > 0 && pcs[j - 1] > tmp; j--)
+            pcs[j] = pcs[j - 1];
+        pcs[j] = tmp;
+    }
+    for(i = 0; i < *pstate_count; i++) {
+        st = &states[i];
+        if (st->count == count &&
+            !memcmp(st->pcs, pcs, sizeof(pcs[0]) * count))
+            return i;
+    }
+    if (*pstate_count >= RE_DFA_STATES_MAX)
+        return -1;
+    st = &states[*pstate_count];
+    memset(st->next, 0, sizeof(st->next));
+    st->count = count;
+    memcpy(st->pcs, pcs, sizeof(pcs[0]) * count);
+    st->is_match = FALSE;
+    for(i = 0; i < count; i++) {
+        if (ps->bc_buf[pcs[i]] == REOP_match)
+            st->is_match = TRUE;
+    }
+    return (*pstate_count)++;
+}
+
+/* Return 0 if the regexp cannot match from 'cptr', 1 if it may match
+   or -1 if the DFA is too large or not enough memory. The states are
+   computed when they are first reached. */
+static int re_dfa_run(REPikeState *ps, int n_threads, const uint8_t *cptr)
+{
+    REExecContext *s = ps->s;
+    int cbuf_type = s->cbuf_type;
+    REDFAState *states, *st;
+    int *tmp_pcs, state_count, state, i, len, count, ret;
+    const uint8_t *pc;
+    uint32_t c, c1;
+
+    states = lre_realloc(s->opaque, NULL,
+                         (sizeof(REDFAState) + sizeof(int) * n_threads) *
+                         RE_DFA_STATES_MAX + sizeof(int) * n_threads);
+    if (!states)
+        return -1;
+    tmp_pcs = (int *)(states + RE_DFA_STATES_MAX);
+    for(i = 0; i < RE_DFA_STATES_MAX; i++)
+        states[i].pcs = tmp_pcs + (i + 1) * n_threads;
+    state_count = 0;
+
+    ps->gen++;
+    count = re_dfa_add(ps, tmp_pcs, 0, ps->bc_buf);
+    state = re_dfa_find_state(ps, states, &state_count, tmp_pcs, count);
+    for(;;) {
+        st = &states[state];
+        if (st->is_match) {
+            ret = 1;
+            break;
+        }
+        if (st->count == 0 || cptr >= s->cbuf_end) {
+            ret = 0;
+            break;
+        }
+        GET_CHAR(c, cptr, s->cbuf_end);
+        if (c < 256 && st->next[c] != 0) {
+            state = st->next[c] - 1;
+            continue;
+        }
+        c1 = c;
+        if (s->ignore_case)
+            c1 = lre_canonicalize(c, s->is_utf16);
+        ps->gen++;
+        count = 0;
+        for(i = 0; i < st->count; i++) {
+            pc = ps->bc_buf + st->pcs[i];
+            len = re_pike_step(pc, c, c1);
+            if (len)
+                count = re_dfa_add(ps, tmp_pcs, count, pc + len);
+        }
+        state = re_dfa_find_state(ps, states, &state_count, tmp_pcs, count);
+        if (state < 0) {
+            ret = -1;
+            break;
+        }
+        if (c < 256)
+            st->next[c] = state + 1;
+    }
+    lre_realloc(s->opaque, states, 0);
+    return ret;
+}
+
+/* Same as lre_exec_backtrack() for the bytecode 'bc_buf' of length
+   'bc_len' starting at 'cindex'. 'pf' is the prefilter or NULL. If
+   'dfa_check' is TRUE, only return 0 if the lazy DFA proves that
+   there is no match, 1 otherwise. */
+static int lre_exec_pike(REExecContext *s, uint8_t **capture,
+                         const uint8_t *bc_buf, int bc_len,
+                         const uint8_t *pf, int cindex, int clen,
+                         BOOL dfa_check)
+{
+    REPikeState ps_s, *ps = &ps_s;
+    REThreadList lists[2], *clist, *nlist, *tmp;
+    REThread *th;
+    int cbuf_type = s->cbuf_type;
+    int shift = (cbuf_type != 0);
+    int pos, n_threads, n_jobs, capture_len, state_len, loop_count;
+    int i, j, len, start, ret;
+    REPikeLoop *lp;
+    const uint8_t *cptr, *cptr1;
+    uint8_t *buf, **caps;
+    uint32_t c, c1;
+    BOOL matched, has_assertions;
+
+    /* count the threads and the jobs of a closure */
+    n_threads = 0;
+    n_jobs = 1;
+    loop_count = 0;
+    has_assertions = FALSE;
+    for(pos = 0; pos < bc_len; pos += re_get_op_len(bc_buf + pos)) {
+        switch(bc_buf[pos]) {
+        case REOP_char:
+        case REOP_char32:
+        case REOP_dot:
+        case REOP_any:
+        case REOP_range:
+        case REOP_range32:
+        case REOP_match:
+            n_threads++;
+            break;
+        case REOP_split_goto_first:
+        case REOP_split_next_first:
+        case REOP_save_start:
+        case REOP_save_end:
+            n_jobs++;
+            break;
+        case REOP_save_reset:
+            n_jobs += 2 * (bc_buf[pos + 2] - bc_buf[pos + 1] + 1);
+            break;
+        case REOP_push_char_pos:
+            loop_count++;
+            /* fall thru */
+        case REOP_bne_char_pos:
+            n_jobs++;
+            break;
+        case REOP_line_start:
+        case REOP_line_end:
+        case REOP_word_boundary:
+        case REOP_not_word_boundary:
+            has_assertions = TRUE;
+            break;
+        }
+    }
+    if (dfa_check && (has_assertions || n_threads > RE_DFA_THREADS_MAX ||
+                      clen - cindex < RE_DFA_LEN_MIN))
+        return 1;
+    capture_len = 2 * s->capture_count;
+    state_len = capture_len + loop_count;
+    /* the nesting of the loops is bounded by the stack size */
+    ps->loop_depth = s->stack_size_max;
+    buf = lre_realloc(s->opaque, NULL,
+                      sizeof(ps->jobs[0]) * n_jobs +
+                      sizeof(REThread) * 2 * n_threads +
+                      sizeof(capture[0]) * state_len * (2 * n_threads + 1) +
+                      sizeof(ps->loops[0]) * loop_count +
+                      sizeof(ps->visited[0]) * bc_len * (ps->loop_depth + 1));
+    if (!buf)
+        return -1;
+    ps->s = s;
+    ps->bc_buf = bc_buf;
+    ps->state_len = state_len;
+    ps->loop_count = loop_count;
+    ps->gen = 0;
+    ps->jobs = (REPikeJob *)buf;
+    lists[0].threads = (REThread *)(ps->jobs + n_jobs);
+    lists[1].threads = lists[0].threads + n_threads;
+    caps = (uint8_t **)(lists[1].threads + n_threads);
+    for(i = 0; i < 2 * n_threads; i++) {
+        lists[0].threads[i].capture = caps;
+        caps += state_len;
+    }
+    ps->capture = caps;
+    ps->loops = (REPikeLoop *)(caps + state_len);
+    ps->visited = (uint32_t *)(ps->loops + loop_count);
+    memset(ps->visited, 0,
+           sizeof(ps->visited[0]) * bc_len * (ps->loop_depth + 1));
+    loop_count = 0;
+    for(pos = 0; pos < bc_len; pos += re_get_op_len(bc_buf + pos)) {
+        if (bc_buf[pos] == REOP_push_char_pos) {
+            lp = &ps->loops[loop_count];
+            lp->pos = pos;
+            lp->end = re_find_loop_end(bc_buf, bc_len, pos);
+            j = loop_count - 1;
+            while (j >= 0 && ps->loops[j].end < pos)
+                j = ps->loops[j].parent;
+            lp->parent = j;
+            loop_count++;
+        }
+    }
+
+    cptr = s->cbuf + (cindex << shift);
+    if (dfa_check) {
+        ret = (re_dfa_run(ps, n_threads, cptr) != 0);
+        goto done;
+    }
+    start = cindex;
+    if (pf) {
+        cindex = lre_find_start(pf, s->cbuf, start, cindex, clen, cbuf_type);
+        if (cindex < 0) {
+            ret = 0;
+            goto done;
+        }
+        cptr = s->cbuf + (cindex << shift);
+    }
+
+    for(i = 0; i < state_len; i++)
+        ps->capture[i] = NULL;
+    clist = &lists[0];
+    nlist = &lists[1];
+    clist->count = 0;
+    ps->gen++;
+    re_pike_add(ps, clist, bc_buf, cptr);
+    matched = FALSE;
+    for(;;) {
+        if (pf && !matched && clist->count == 1 &&
+            clist->threads[0].pc == bc_buf + 5 && cptr < s->cbuf_end) {
+            /* only the loop over the start positions is left */
+            cindex = lre_find_start(pf, s->cbuf, start,
+                                    ((cptr - s->cbuf) >> shift) + 1, clen,
+                                    cbuf_type);
+            if (cindex < 0)
+                break;
+            cptr = s->cbuf + (cindex << shift);
+            clist->count = 0;
+            ps->gen++;
+            re_pike_add(ps, clist, bc_buf, cptr);
+        }
+        if (clist->count == 0)
+            break;
+        if (cptr < s->cbuf_end) {
+            cptr1 = cptr;
+            GET_CHAR(c, cptr1, s->cbuf_end);
+            c1 = c;
+            if (s->ignore_case)
+                c1 = lre_canonicalize(c, s->is_utf16);
+        } else {
+            cptr1 = NULL;
+            c = c1 = 0;
+        }
+        ps->gen++;
+        nlist->count = 0;
+        for(i = 0; i < clist->count; i++) {
+            th = &clist->threads[i];
+            if (th->pc[0] == REOP_match) {
+                /* the next threads have a lower priority */
+                memcpy(capture, th->capture, sizeof(capture[0]) * capture_len);
+                matched = TRUE;
+                break;
+            }
+            if (cptr1) {
+                len = re_pike_step(th->pc, c, c1);
+                if (len) {
+                    memcpy(ps->capture, th->capture,
+                           sizeof(capture[0]) * state_len);
+                    re_pike_add(ps, nlist, th->pc + len, cptr1);
+                }
+            }
+        }
+        if (!cptr1)
+            break;
+        tmp = clist;
+        clist = nlist;
+        nlist = tmp;
+        cptr = cptr1;
+    }
+    ret = matched;
+ done:
+    lre_realloc(s->opaque, buf, 0);
+    return ret;
+}
+
 /* Return 1 if match, 0 if not match or -1 if error. cindex is the
    starting position of the match and must be such as 0 <= cindex <=
    clen. */
@@ -2501,8 +3716,9 @@ int lre_exec(uint8_t **capture,
              int cbuf_type, void *opaque)
 {
     REExecContext s_s, *s = &s_s;
-    int re_flags, i, alloca_size, ret;
+    int re_flags, i, alloca_size, ret, start;
     StackInt *stack_buf;
+    const uint8_t *pf;
     
     re_flags = bc_buf[RE_HEADER_FLAGS];
     s->multi_line = (re_flags & LRE_FLAG_MULTILINE) != 0;
@@ -2528,8 +3744,49 @@ int lre_exec(uint8_t **capture,
         capture[i] = NULL;
     alloca_size = s->stack_size_max * sizeof(stack_buf[0]);
     stack_buf = alloca(alloca_size);
-    ret = lre_exec_backtrack(s, capture, stack_buf, 0, bc_buf + RE_HEADER_LEN,
-                             cbuf + (cindex << cbuf_type), FALSE);
+    pf = NULL;
+    if (re_flags & LRE_FLAG_PREFILTER)
+        pf = bc_buf + RE_HEADER_LEN + get_u32(bc_buf + 3);
+    start = cindex;
+    s->state_budget = SIZE_MAX;
+    if (bc_buf[RE_HEADER_ENGINE] == RE_ENGINE_PIKE) {
+        ret = lre_exec_pike(s, capture, bc_buf + RE_HEADER_LEN,
+                            get_u32(bc_buf + 3), pf, cindex, clen, TRUE);
+        if (ret <= 0)
+            goto done;
+        s->state_budget = RE_BACKTRACK_STATES_MIN +
+            (size_t)(clen - cindex) * RE_BACKTRACK_STATES_PER_CHAR;
+    }
+    if (pf) {
+        /* the loop over the start positions is done here */
+        for(;;) {
+            cindex = lre_find_start(pf, cbuf, start, cindex, clen,
+                                    s->cbuf_type);
+            if (cindex < 0) {
+                ret = 0;
+                break;
+            }
+            ret = lre_exec_backtrack(s, capture, stack_buf, 0,
+                                     bc_buf + RE_HEADER_LEN + RE_START_LOOP_LEN,
+                                     cbuf + (cindex << cbuf_type), FALSE);
+            if (ret != 0)
+                break;
+            for(i = 0; i < s->capture_count * 2; i++)
+                capture[i] = NULL;
+            cindex++;
+        }
+    } else {
+        ret = lre_exec_backtrack(s, capture, stack_buf, 0,
+                                 bc_buf + RE_HEADER_LEN,
+                                 cbuf + (cindex << cbuf_type), FALSE);
+    }
+    if (ret < 0 && s->state_budget == 0) {
+        for(i = 0; i < s->capture_count * 2; i++)
+            capture[i] = NULL;
+        ret = lre_exec_pike(s, capture, bc_buf + RE_HEADER_LEN,
+                            get_u32(bc_buf + 3), pf, start, clen, FALSE);
+    }
+ done:
     lre_realloc(s->opaque, s->state_stack, 0);
     return ret;
 }
@@ -2552,7 +3809,9 @@ const char *lre_get_groupnames(const uint8_t *bc_buf)
     if ((lre_get_flags(bc_buf) & LRE_FLAG_NAMED_GROUPS) == 0)
         return NULL;
     re_bytecode_len = get_u32(bc_buf + 3);
-    return (const char *)(bc_buf + 7 + re_bytecode_len);
+    if (lre_get_flags(bc_buf) & LRE_FLAG_PREFILTER)
+        re_bytecode_len += bc_buf[RE_HEADER_LEN + re_bytecode_len];
+    return (const char *)(bc_buf + RE_HEADER_LEN + re_bytecode_len);
 }
 
 #ifdef TEST
@@ -32,6 +32,10 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <time.h>
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 #if defined(__APPLE__)
 #include <malloc/malloc.h>
 #elif defined(__linux__)
@@ -48,6 +52,7 @@ extern const uint8_t qjsc_qjscalc[];
 extern const uint32_t qjsc_qjscalc_size;
 static int bignum_ext;
 #endif
+static int lazy_functions;
 
 static int eval_buf(JSContext *ctx, const void *buf, int buf_len,
                     const char *filename, int eval_flags)
@@ -97,11 +102,62 @@ static int eval_file(JSContext *ctx, const char *filename, int module)
         eval_flags = JS_EVAL_TYPE_MODULE;
     else
         eval_flags = JS_EVAL_TYPE_GLOBAL;
+    if (lazy_functions)
+        eval_flags |= JS_EVAL_FLAG_LAZY;
     ret = eval_buf(ctx, buf, buf_len, filename, eval_flags);
     js_free(ctx, buf);
     return ret;
 }
 
+#if !defined(_WIN32)
+/* Map a file generated by 'qjsc -b' read-only and execute its
+   bytecode in place. The mapping must outlive the runtime. */
+static int eval_binary_file(JSContext *ctx, const char *filename,
+                            void **pmap, size_t *pmap_len)
+{
+    struct stat st;
+    void *map;
+    JSValue obj, val;
+    int fd, ret;
+
+    fd = open(filename, O_RDONLY);
+    if (fd < 0 || fstat(fd, &st) < 0) {
+        perror(filename);
+        exit(1);
+    }
+    map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        perror(filename);
+        exit(1);
+    }
+    *pmap = map;
+    *pmap_len = st.st_size;
+
+    obj = JS_ReadObject(ctx, map, st.st_size,
+                        JS_READ_OBJ_BYTECODE | JS_READ_OBJ_ROM_DATA);
+    if (JS_IsException(obj))
+        goto exception;
+    if (JS_VALUE_GET_TAG(obj) == JS_TAG_MODULE) {
+        if (JS_ResolveModule(ctx, obj) < 0) {
+            JS_FreeValue(ctx, obj);
+            goto exception;
+        }
+        js_module_set_import_meta(ctx, obj, FALSE, TRUE);
+    }
+    val = JS_EvalFunction(ctx, obj);
+    if (JS_IsException(val)) {
+    exception:
+        js_std_dump_error(ctx);
+        ret = -1;
+    } else {
+        JS_FreeValue(ctx, val);
+        ret = 0;
+    }
+    return ret;
+}
+#endif
+
 /* also used to initialize the worker context */
 static JSContext *JS_NewCustomContext(JSRuntime *rt)
 {
@@ -272,8 +328,156 @@ static const JSMallocFunctions trace_mf = {
 #endif
 };
 
+static int heap_image_write(void *opaque, const void *buf, size_t len)
+{
+    return dbuf_put(opaque, buf, len);
+}
+
+/* the image can only be loaded by the executable which saved it */
+static const char heap_image_build_id[] = CONFIG_VERSION " " __DATE__ " " __TIME__;
+
+/* measure the warm start from a heap image against JS_NewContext() */
+static int heap_image_test(void)
+{
+    const size_t region_size = 4 << 20;
+    const char *str = "[1, 2, 3].map(x => x * 2).join()";
+    void *region;
+    JSRuntime *rt;
+    JSContext *ctx;
+    DynBuf dbuf;
+    JSValue val;
+    const char *res;
+    clock_t t0;
+    double ms, best;
+    int i, ret = -1;
+
+    region = malloc(region_size);
+    if (!region)
+        return -1;
+    rt = JS_NewRuntime2(JS_GetMallocPoolFunctions(),
+                        JS_NewMallocPoolRegion(region, region_size));
+    ctx = JS_NewContext(rt);
+    dbuf_init(&dbuf);
+    if (JS_SaveHeapImage(ctx, heap_image_build_id,
+                         strlen(heap_image_build_id),
+                         heap_image_write, &dbuf) < 0)
+        goto fail;
+    JS_FreeContext(ctx);
+    JS_FreeRuntime(rt);
+
+    /* an image of another build is rejected */
+    if (JS_LoadHeapImage(region, region_size, dbuf.buf, dbuf.size,
+                         "other", 5))
+        goto fail;
+
+    best = 0;
+    for (i = 0; i < 100; i++) {
+        t0 = clock();
+        ctx = JS_LoadHeapImage(region, region_size, dbuf.buf, dbuf.size,
+                               heap_image_build_id,
+                               strlen(heap_image_build_id));
+        ms = 1000.0 * (clock() - t0) / CLOCKS_PER_SEC;
+        if (!ctx)
+            goto fail;
+        if (i == 0 || best > ms)
+            best = ms;
+    }
+    printf("Heap image load time (ms): %.3f (%u bytes)\n",
+           best, (unsigned int)dbuf.size);
+
+    /* the loaded context must be usable and freed without leak */
+    val = JS_Eval(ctx, str, strlen(str), "<image>", JS_EVAL_TYPE_GLOBAL);
+    res = JS_ToCString(ctx, val);
+    if (res && !strcmp(res, "2,4,6"))
+        ret = 0;
+    JS_FreeCString(ctx, res);
+    JS_FreeValue(ctx, val);
+    rt = JS_GetRuntime(ctx);
+    JS_FreeContext(ctx);
+    JS_FreeRuntime(rt);
+ fail:
+    if (ret)
+        fprintf(stderr, "qjs: heap image test failed\n");
+    dbuf_free(&dbuf);
+    free(region);
+    return ret;
+}
+
 #define PROG_NAME "qjs"
 
+static int profile_write(void *opaque, const void *buf, size_t len)
+{
+    return fwrite(buf, 1, len, opaque) == len ? 0 : -1;
+}
+
+/* '.cpuprofile' files are in the Chrome DevTools format, the others
+   in the folded stack format of flamegraph.pl */
+static void write_profile(JSRuntime *rt, const char *filename)
+{
+    FILE *f;
+    size_t len;
+    int format, ret;
+
+    len = strlen(filename);
+    format = JS_PROFILE_FOLDED;
+    if (len >= 11 && !strcmp(filename + len - 11, ".cpuprofile"))
+        format = JS_PROFILE_CPUPROFILE;
+    JS_StopProfiler(rt);
+    f = fopen(filename, "wb");
+    if (!f) {
+        perror(filename);
+        return;
+    }
+    ret = JS_WriteProfile(rt, format, profile_write, f);
+    if (fclose(f) != 0 || ret < 0)
+        fprintf(stderr, "qjs: could not write the profile to '%s'\n", filename);
+}
+
+/* memory still allocated by each site */
+static void write_alloc_profile(JSRuntime *rt, const char *filename)
+{
+    FILE *f;
+    int ret;
+
+    JS_StopAllocationProfiler(rt);
+    f = fopen(filename, "wb");
+    if (!f) {
+        perror(filename);
+        return;
+    }
+    ret = JS_WriteAllocationProfile(rt, -1, -1, profile_write, f);
+    if (fclose(f) != 0 || ret < 0)
+        fprintf(stderr, "qjs: could not write the allocation profile to '%s'\n",
+                filename);
+}
+
+static void write_heap_snapshot(JSRuntime *rt, const char *filename)
+{
+    FILE *f;
+    int ret;
+
+    f = fopen(filename, "wb");
+    if (!f) {
+        perror(filename);
+        return;
+    }
+    ret = JS_WriteHeapSnapshot(rt, f);
+    if (fclose(f) != 0 || ret < 0)
+        fprintf(stderr, "qjs: could not write the heap snapshot to '%s'\n",
+                filename);
+}
+
+/* with --deferred-free, the objects whose reference count drops to
+   zero are queued and freed in small steps, as done by the ESP32 main
+   loop */
+#define DEFERRED_FREE_BUDGET_US 100
+
+static int deferred_free_interrupt_handler(JSRuntime *rt, void *opaque)
+{
+    JS_RunGCStep(rt, DEFERRED_FREE_BUDGET_US);
+    return 0;
+}
+
 void help(void)
 {
     printf("QuickJS version " CONFIG_VERSION "\n"
@@ -282,7 +486,11 @@ void help(void)
            "-e  --eval EXPR    evaluate EXPR\n"
            "-i  --interactive  go to interactive mode\n"
            "-m  --module       load as ES6 module (default=autodetect)\n"
+#if !defined(_WIN32)
+           "-b  --bytecode     execute a file compiled with 'qjsc -b' in place\n"
+#endif
            "    --script       load as ES6 script (default=autodetect)\n"
+           "    --lazy         compile the functions when they are first called\n"
            "-I  --include file include an additional file\n"
            "    --std          make 'std' and 'os' available to the loaded script\n"
 #ifdef CONFIG_BIGNUM
@@ -290,10 +498,19 @@ void help(void)
            "    --qjscalc      load the QJSCalc runtime (default if invoked as qjscalc)\n"
 #endif
            "-T  --trace        trace memory allocation\n"
+           "    --pool         use the size class pool allocator\n"
+           "    --deferred-free  free the unreferenced objects in JS_RunGCStep()\n"
            "-d  --dump         dump the memory usage stats\n"
            "    --memory-limit n       limit the memory usage to 'n' bytes\n"
            "    --stack-size n         limit the stack size to 'n' bytes\n"
            "    --unhandled-rejection  dump unhandled promise rejections\n"
+           "    --profile file         write a CPU profile to 'file' (folded stacks or\n"
+           "                           '.cpuprofile')\n"
+           "    --profile-interval n   sample the stack every 'n' microseconds\n"
+           "    --alloc-profile file   write the memory left allocated at exit by\n"
+           "                           each JS function and line to 'file'\n"
+           "    --alloc-profile-interval n  sample an allocation every 'n' bytes\n"
+           "    --heap-snapshot file   write a '.heapsnapshot' of the memory at exit\n"
            "-q  --quit         just instantiate the interpreter and quit\n");
     exit(1);
 }
@@ -308,9 +525,15 @@ int main(int argc, char **argv)
     int interactive = 0;
     int dump_memory = 0;
     int trace_memory = 0;
+    int use_pool = 0;
+    JSMallocPool *pool = NULL;
+    int deferred_free = 0;
     int empty_run = 0;
     int module = -1;
     int load_std = 0;
+    int bytecode = 0;
+    void *bytecode_map = NULL;
+    size_t bytecode_map_len = 0;
     int dump_unhandled_promise_rejection = 0;
     size_t memory_limit = 0;
     char *include_list[32];
@@ -319,6 +542,11 @@ int main(int argc, char **argv)
     int load_jscalc;
 #endif
     size_t stack_size = 0;
+    const char *profile_file = NULL;
+    int profile_interval = 1000;
+    const char *alloc_profile_file = NULL;
+    size_t alloc_profile_interval = 4096;
+    const char *heap_snapshot_file = NULL;
     
 #ifdef CONFIG_BIGNUM
     /* load jscalc runtime if invoked as 'qjscalc' */
@@ -393,6 +621,16 @@ int main(int argc, char **argv)
                 module = 0;
                 continue;
             }
+            if (!strcmp(longopt, "lazy")) {
+                lazy_functions = 1;
+                continue;
+            }
+#if !defined(_WIN32)
+            if (opt == 'b' || !strcmp(longopt, "bytecode")) {
+                bytecode = 1;
+                continue;
+            }
+#endif
             if (opt == 'd' || !strcmp(longopt, "dump")) {
                 dump_memory++;
                 continue;
@@ -401,6 +639,14 @@ int main(int argc, char **argv)
                 trace_memory++;
                 continue;
             }
+            if (!strcmp(longopt, "pool")) {
+                use_pool++;
+                continue;
+            }
+            if (!strcmp(longopt, "deferred-free")) {
+                deferred_free = 1;
+                continue;
+            }
             if (!strcmp(longopt, "std")) {
                 load_std = 1;
                 continue;
@@ -439,6 +685,46 @@ int main(int argc, char **argv)
                 stack_size = (size_t)strtod(argv[optind++], NULL);
                 continue;
             }
+            if (!strcmp(longopt, "profile")) {
+                if (optind >= argc) {
+                    fprintf(stderr, "expecting filename");
+                    exit(1);
+                }
+                profile_file = argv[optind++];
+                continue;
+            }
+            if (!strcmp(longopt, "profile-interval")) {
+                if (optind >= argc) {
+                    fprintf(stderr, "expecting profile interval");
+                    exit(1);
+                }
+                profile_interval = atoi(argv[optind++]);
+                continue;
+            }
+            if (!strcmp(longopt, "alloc-profile")) {
+                if (optind >= argc) {
+                    fprintf(stderr, "expecting filename");
+                    exit(1);
+                }
+                alloc_profile_file = argv[optind++];
+                continue;
+            }
+            if (!strcmp(longopt, "alloc-profile-interval")) {
+                if (optind >= argc) {
+                    fprintf(stderr, "expecting allocation profile interval");
+                    exit(1);
+                }
+                alloc_profile_interval = (size_t)strtod(argv[optind++], NULL);
+                continue;
+            }
+            if (!strcmp(longopt, "heap-snapshot")) {
+                if (optind >= argc) {
+                    fprintf(stderr, "expecting filename");
+                    exit(1);
+                }
+                heap_snapshot_file = argv[optind++];
+                continue;
+            }
             if (opt) {
                 fprintf(stderr, "qjs: unknown option '-%c'\n", opt);
             } else {
@@ -454,6 +740,9 @@ int main(int argc, char **argv)
     if (trace_memory) {
         js_trace_malloc_init(&trace_data);
         rt = JS_NewRuntime2(&trace_mf, &trace_data);
+    } else if (use_pool) {
+        pool = JS_NewMallocPool();
+        rt = pool ? JS_NewRuntime2(JS_GetMallocPoolFunctions(), pool) : NULL;
     } else {
         rt = JS_NewRuntime();
     }
@@ -465,6 +754,10 @@ int main(int argc, char **argv)
         JS_SetMemoryLimit(rt, memory_limit);
     if (stack_size != 0)
         JS_SetMaxStackSize(rt, stack_size);
+    if (deferred_free) {
+        JS_SetDeferredFree(rt, TRUE);
+        JS_SetInterruptHandler(rt, deferred_free_interrupt_handler, NULL);
+    }
     js_std_set_worker_new_context_func(JS_NewCustomContext);
     js_std_init_handlers(rt);
     ctx = JS_NewCustomContext(rt);
@@ -480,6 +773,16 @@ int main(int argc, char **argv)
         JS_SetHostPromiseRejectionTracker(rt, js_std_promise_rejection_tracker,
                                           NULL);
     }
+
+    if (profile_file && JS_StartProfiler(rt, profile_interval)) {
+        fprintf(stderr, "qjs: cannot start the profiler\n");
+        exit(2);
+    }
+    if (alloc_profile_file &&
+        JS_StartAllocationProfiler(rt, alloc_profile_interval)) {
+        fprintf(stderr, "qjs: cannot start the allocation profiler\n");
+        exit(2);
+    }
     
     if (!empty_run) {
 #ifdef CONFIG_BIGNUM
@@ -513,6 +816,13 @@ int main(int argc, char **argv)
         } else {
             const char *filename;
             filename = argv[optind];
+#if !defined(_WIN32)
+            if (bytecode) {
+                if (eval_binary_file(ctx, filename, &bytecode_map,
+                                     &bytecode_map_len))
+                    goto fail;
+            } else
+#endif
             if (eval_file(ctx, filename, module))
                 goto fail;
         }
@@ -520,8 +830,19 @@ int main(int argc, char **argv)
             js_std_eval_binary(ctx, qjsc_repl, qjsc_repl_size, 0);
         }
         js_std_loop(ctx);
+        if (deferred_free)
+            JS_RunGCStep(rt, DEFERRED_FREE_BUDGET_US);
     }
     
+    if (profile_file)
+        write_profile(rt, profile_file);
+    if (alloc_profile_file)
+        write_alloc_profile(rt, alloc_profile_file);
+    if (heap_snapshot_file)
+        write_heap_snapshot(rt, heap_snapshot_file);
+#ifdef CONFIG_OPCODE_STATS
+    JS_DumpOpcodeStats(stderr, rt);
+#endif
     if (dump_memory) {
         JSMemoryUsage stats;
         JS_ComputeMemoryUsage(rt, &stats);
@@ -530,6 +851,12 @@ int main(int argc, char **argv)
     js_std_free_handlers(rt);
     JS_FreeContext(ctx);
     JS_FreeRuntime(rt);
+    if (pool)
+        JS_FreeMallocPool(pool);
+#if !defined(_WIN32)
+    if (bytecode_map)
+        munmap(bytecode_map, bytecode_map_len);
+#endif
 
     if (empty_run && dump_memory) {
         clock_t t[5];
@@ -554,11 +881,25 @@ int main(int argc, char **argv)
         printf("\nInstantiation times (ms): %.3f = %.3f+%.3f+%.3f+%.3f\n",
                best[1] + best[2] + best[3] + best[4],
                best[1], best[2], best[3], best[4]);
+        if (heap_image_test())
+            return 1;
     }
     return 0;
  fail:
+    if (profile_file)
+        write_profile(rt, profile_file);
+    if (alloc_profile_file)
+        write_alloc_profile(rt, alloc_profile_file);
+    if (heap_snapshot_file)
+        write_heap_snapshot(rt, heap_snapshot_file);
     js_std_free_handlers(rt);
     JS_FreeContext(ctx);
     JS_FreeRuntime(rt);
+    if (pool)
+        JS_FreeMallocPool(pool);
+#if !defined(_WIN32)
+    if (bytecode_map)
+        munmap(bytecode_map, bytecode_map_len);
+#endif
     return 1;
 }
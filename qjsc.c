@@ -60,6 +60,7 @@ static uint64_t feature_bitmap;
 static FILE *outfile;
 static BOOL byte_swap;
 static BOOL dynamic_export;
+static BOOL binary_output;
 static const char *c_ident_prefix = "qjsc_";
 
 #define FE_ALL (-1)
@@ -188,6 +189,23 @@ static void output_object_code(JSContext *ctx,
         exit(1);
     }
 
+    if (binary_output) {
+        /* raw bytecode of a single object, loadable with
+           JS_ReadObject() */
+        if (cname_list.count != 0) {
+            fprintf(stderr, "Binary output supports a single object: cannot add '%s'\n",
+                    c_name);
+            exit(1);
+        }
+        if (fwrite(out_buf, 1, out_buf_len, fo) != out_buf_len) {
+            perror("fwrite");
+            exit(1);
+        }
+        namelist_add(&cname_list, c_name, NULL, load_only);
+        js_free(ctx, out_buf);
+        return;
+    }
+
     namelist_add(&cname_list, c_name, NULL, load_only);
     
     fprintf(fo, "const uint32_t %s_size = %u;\n\n", 
@@ -347,6 +365,7 @@ void help(void)
            "options are:\n"
            "-c          only output bytecode in a C file\n"
            "-e          output main() and bytecode in a C file (default = executable output)\n"
+           "-b          only output the raw bytecode in a binary file\n"
            "-o output   set the output filename\n"
            "-N cname    set the C name of the generated data\n"
            "-m          compile as Javascript module (default=autodetect)\n"
@@ -479,6 +498,7 @@ typedef enum {
     OUTPUT_C,
     OUTPUT_C_MAIN,
     OUTPUT_EXECUTABLE,
+    OUTPUT_BINARY,
 } OutputTypeEnum;
 
 int main(int argc, char **argv)
@@ -514,7 +534,7 @@ int main(int argc, char **argv)
     namelist_add(&cmodule_list, "os", "os", 0);
 
     for(;;) {
-        c = getopt(argc, argv, "ho:cN:f:mxevM:p:S:D:");
+        c = getopt(argc, argv, "ho:cN:f:mxebvM:p:S:D:");
         if (c == -1)
             break;
         switch(c) {
@@ -529,6 +549,9 @@ int main(int argc, char **argv)
         case 'e':
             output_type = OUTPUT_C_MAIN;
             break;
+        case 'b':
+            output_type = OUTPUT_BINARY;
+            break;
         case 'N':
             cname = optarg;
             break;
@@ -606,6 +629,8 @@ int main(int argc, char **argv)
     if (!out_filename) {
         if (output_type == OUTPUT_EXECUTABLE) {
             out_filename = "a.out";
+        } else if (output_type == OUTPUT_BINARY) {
+            out_filename = "out.bin";
         } else {
             out_filename = "out.c";
         }
@@ -622,7 +647,8 @@ int main(int argc, char **argv)
         pstrcpy(cfilename, sizeof(cfilename), out_filename);
     }
     
-    fo = fopen(cfilename, "w");
+    binary_output = (output_type == OUTPUT_BINARY);
+    fo = fopen(cfilename, binary_output ? "wb" : "w");
     if (!fo) {
         perror(cfilename);
         exit(1);
@@ -643,15 +669,18 @@ int main(int argc, char **argv)
     /* loader for ES6 modules */
     JS_SetModuleLoaderFunc(rt, NULL, jsc_module_loader, NULL);
 
-    fprintf(fo, "/* File generated automatically by the QuickJS compiler. */\n"
-            "\n"
-            );
-    
-    if (output_type != OUTPUT_C) {
-        fprintf(fo, "#include \"quickjs-libc.h\"\n"
+    if (binary_output) {
+        /* no C header */
+    } else if (output_type != OUTPUT_C) {
+        fprintf(fo, "/* File generated automatically by the QuickJS compiler. */\n"
+                "\n"
+                "#include \"quickjs-libc.h\"\n"
                 "\n"
                 );
     } else {
+        fprintf(fo, "/* File generated automatically by the QuickJS compiler. */\n"
+                "\n"
+                );
         fprintf(fo, "#include <inttypes.h>\n"
                 "\n"
                 );
@@ -671,7 +700,7 @@ int main(int argc, char **argv)
         }
     }
     
-    if (output_type != OUTPUT_C) {
+    if (output_type == OUTPUT_C_MAIN || output_type == OUTPUT_EXECUTABLE) {
         fprintf(fo,
                 "static JSContext *JS_NewCustomContext(JSRuntime *rt)\n"
                 "{\n"
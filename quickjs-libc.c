@@ -717,7 +717,14 @@ static JSValue js_std_getenviron(JSContext *ctx, JSValueConst this_val,
 static JSValue js_std_gc(JSContext *ctx, JSValueConst this_val,
                          int argc, JSValueConst *argv)
 {
-    JS_RunGC(JS_GetRuntime(ctx));
+    int32_t budget_us;
+    if (argc >= 1 && !JS_IsUndefined(argv[0])) {
+        if (JS_ToInt32(ctx, &budget_us, argv[0]))
+            return JS_EXCEPTION;
+        JS_RunGCStep(JS_GetRuntime(ctx), budget_us);
+    } else {
+        JS_RunGC(JS_GetRuntime(ctx));
+    }
     return JS_UNDEFINED;
 }
 
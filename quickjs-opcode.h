@@ -53,6 +53,7 @@ FMT(atom_u16)
 FMT(atom_label_u8)
 FMT(atom_label_u16)
 FMT(label_u16)
+FMT(ic)
 #undef FMT
 #endif /* FMT */
 
@@ -138,6 +139,9 @@ DEF(    define_func, 6, 1, 0, atom_u8)
 DEF(      get_field, 5, 1, 1, atom)
 DEF(     get_field2, 5, 1, 2, atom)
 DEF(      put_field, 5, 2, 0, atom)
+DEF(   get_field_ic, 5, 1, 1, ic) /* get_field with an inline cache index */
+DEF(  get_field2_ic, 5, 1, 2, ic) /* get_field2 with an inline cache index */
+DEF(   put_field_ic, 5, 2, 0, ic) /* put_field with an inline cache index */
 DEF( get_private_field, 1, 2, 1, none) /* obj prop -> value */
 DEF( put_private_field, 1, 3, 0, none) /* obj value prop -> */
 DEF(define_private_field, 1, 3, 1, none) /* obj prop value -> obj */
@@ -358,8 +362,28 @@ DEF(   is_undefined, 1, 1, 1, none)
 DEF(        is_null, 1, 1, 1, none)
 DEF(typeof_is_undefined, 1, 1, 1, none)
 DEF( typeof_is_function, 1, 1, 1, none)
+
+/* superinstructions: they replace the first opcode of a pair listed
+   in FUSE() and have the same size and format. The second opcode is
+   left in place and skipped. */
+DEF(   lt_if_false8, 1, 2, 1, none)
+DEF(  lte_if_false8, 1, 2, 1, none)
+DEF(   gt_if_false8, 1, 2, 1, none)
+DEF(  gte_if_false8, 1, 2, 1, none)
+DEF(  inc_loc_goto8, 2, 0, 0, loc8)
 #endif
 
 #undef DEF
 #undef def
 #endif  /* DEF */
+
+#ifdef FUSE
+/* FUSE(fused opcode, first opcode, second opcode): most frequent pairs
+   in the opcode statistics of CONFIG_OPCODE_STATS */
+FUSE(   lt_if_false8,      lt, if_false8)
+FUSE(  lte_if_false8,     lte, if_false8)
+FUSE(   gt_if_false8,      gt, if_false8)
+FUSE(  gte_if_false8,     gte, if_false8)
+FUSE(  inc_loc_goto8, inc_loc,     goto8)
+#undef FUSE
+#endif  /* FUSE */
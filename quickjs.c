@@ -32,6 +32,7 @@
 #include <time.h>
 #include <fenv.h>
 #include <math.h>
+#include <float.h>
 #if defined(__APPLE__)
 #include <malloc/malloc.h>
 #elif defined(__linux__)
@@ -201,6 +202,10 @@ typedef enum JSErrorEnum {
 #define JS_MAX_LOCAL_VARS 65536
 #define JS_STACK_SIZE_MAX 65534
 #define JS_STRING_LEN_MAX ((1 << 30) - 1)
+/* shorter concatenations give flat strings */
+#define JS_STRING_ROPE_SHORT_LEN 512
+/* maximum depth of a rope tree before rebalancing */
+#define JS_STRING_ROPE_MAX_DEPTH 48
 
 #define __exception __attribute__((warn_unused_result))
 
@@ -256,11 +261,22 @@ struct JSRuntime {
     /* list of JSGCObjectHeader.link. List of allocated GC objects (used
        by the garbage collector) */
     struct list_head gc_obj_list;
+    /* list of JSGCObjectHeader.link. GC objects created since the last
+       GC, moved to gc_obj_list when they survive it */
+    struct list_head gc_young_list;
     /* list of JSGCObjectHeader.link. Used during JS_FreeValueRT() */
     struct list_head gc_zero_ref_count_list; 
     struct list_head tmp_obj_list; /* used during GC */
     JSGCPhaseEnum gc_phase : 8;
+    /* if TRUE, the objects whose refcount reaches zero stay in
+       gc_zero_ref_count_list until JS_RunGCStep() or the next GC */
+    BOOL deferred_free : 8;
     size_t malloc_gc_threshold;
+    /* above, js_trigger_gc() collects all the GC objects instead of
+       only the young ones */
+    size_t malloc_full_gc_threshold;
+    /* estimated cost of JS_RunGCStep() per GC object, in ns */
+    int gc_step_ns_per_object;
 #ifdef DUMP_LEAKS
     struct list_head string_list; /* list of JSString.link */
 #endif
@@ -276,6 +292,12 @@ struct JSRuntime {
 
     JSInterruptHandler *interrupt_handler;
     void *interrupt_opaque;
+#ifdef CONFIG_OPCODE_STATS
+    struct JSOpcodeStats *opcode_stats;
+#endif
+    struct JSProfiler *profiler;
+    struct JSAllocProfiler *alloc_profiler;
+    struct JSHeapSnapshot *heap_snapshot; /* used by JS_WriteHeapSnapshot() */
 
     JSHostPromiseRejectionTracker *host_promise_rejection_tracker;
     void *host_promise_rejection_tracker_opaque;
@@ -295,6 +317,14 @@ struct JSRuntime {
     int shape_hash_size;
     int shape_hash_count; /* number of hashed shapes */
     JSShape **shape_hash;
+    uint32_t shape_ic_id; /* last JSShape.ic_id allocated */
+    /* incremented each time a prototype object is modified */
+    uint32_t proto_epoch;
+
+    /* compiled regexps, see js_compile_regexp() */
+    struct list_head regexp_cache_list; /* LRU order, most recent first */
+    struct JSRegExpCacheEntry **regexp_cache_hash; /* allocated on first use */
+    size_t regexp_cache_size; /* in bytes */
 #ifdef CONFIG_BIGNUM
     bf_context_t bf_ctx;
     JSNumericOperations bigint_ops;
@@ -407,6 +437,8 @@ typedef enum {
    enough to call the interrupt callback often. */
 #define JS_INTERRUPT_COUNTER_INIT 10000
 
+#define JSON_PLAIN_SHAPE_CACHE_SIZE 16
+
 struct JSContext {
     JSGCObjectHeader header; /* must come first */
     JSRuntime *rt;
@@ -416,6 +448,11 @@ struct JSContext {
     int binary_object_size;
 
     JSShape *array_shape;   /* initial shape for Array objects */
+    /* shape transitions of JSON.parse(), allocated on first use */
+    struct JSONShapeCacheEntry *json_shape_cache;
+    /* JSShape.ic_id of shapes checked by js_json_is_plain() */
+    uint32_t json_plain_shapes[JSON_PLAIN_SHAPE_CACHE_SIZE];
+    uint32_t json_plain_epoch; /* JSRuntime.proto_epoch of json_plain_shapes */
 
     JSValue *class_proto;
     JSValue function_proto;
@@ -501,6 +538,18 @@ struct JSString {
     } u;
 };
 
+/* concatenation of 'left' and 'right' (strings or ropes). The
+   characters are only copied when they are needed (see
+   js_linearize_rope()). */
+typedef struct JSStringRope {
+    JSRefCountHeader header; /* must come first, 32-bit */
+    uint32_t len : 31;
+    uint8_t is_wide_char : 1;
+    uint8_t depth; /* 1 + maximum depth of the children */
+    JSValue left;
+    JSValue right; /* empty string once the rope is linearized */
+} JSStringRope;
+
 typedef struct JSClosureVar {
     uint8_t is_local : 1;
     uint8_t is_arg : 1;
@@ -579,6 +628,35 @@ typedef enum JSFunctionKindEnum {
     JS_FUNC_ASYNC_GENERATOR = (JS_FUNC_GENERATOR | JS_FUNC_ASYNC),
 } JSFunctionKindEnum;
 
+#define JS_IC_WAYS 4
+
+typedef struct JSInlineCacheEntry {
+    uint32_t shape_id; /* JSShape.ic_id of the object, 0 if unused */
+    uint16_t prop_idx; /* index in JSObject.prop of the holder */
+    uint16_t depth; /* 0 if own property, otherwise the holder is
+                       the depth-th prototype of the object */
+} JSInlineCacheEntry;
+
+/* Cache of the get_field/get_field2/put_field opcodes. JSShape.ic_id
+   changes whenever a shape is modified, so a matching shape_id always
+   designates the same property layout. The entries with depth != 0
+   are only valid if proto_epoch == JSRuntime.proto_epoch. */
+typedef struct JSInlineCache {
+    JSAtom atom;
+    uint32_t proto_epoch;
+    JSInlineCacheEntry entries[JS_IC_WAYS]; /* most recent first */
+} JSInlineCache;
+
+/* atoms of read-only bytecode which could not be kept at their index
+   in the input buffer. It is shared by the functions of a
+   JS_ReadObject() call. */
+typedef struct JSBytecodeAtomMap {
+    int ref_count;
+    uint32_t first_atom; /* the smaller indexes are not translated */
+    uint32_t count;
+    JSAtom atoms[0];
+} JSBytecodeAtomMap;
+
 typedef struct JSFunctionBytecode {
     JSGCObjectHeader header; /* must come first */
     uint8_t js_mode;
@@ -595,7 +673,10 @@ typedef struct JSFunctionBytecode {
     uint8_t has_debug : 1;
     uint8_t backtrace_barrier : 1; /* stop backtrace on this function */
     uint8_t read_only_bytecode : 1;
-    /* XXX: 4 bits available */
+    /* the body is compiled at the first call, cpool[0] is the result */
+    uint8_t is_lazy : 1;
+    uint8_t is_func_expr : 1; /* only used if is_lazy is true */
+    /* XXX: 2 bits available */
     uint8_t *byte_code_buf; /* (self pointer) */
     int byte_code_len;
     JSAtom func_name;
@@ -609,6 +690,10 @@ typedef struct JSFunctionBytecode {
     JSValue *cpool; /* constant pool (self pointer) */
     int cpool_count;
     int closure_var_count;
+    JSInlineCache *ic; /* indexed by the OP_FMT_ic opcodes */
+    int ic_count;
+    /* if not NULL, translates the atoms of the read-only bytecode */
+    JSBytecodeAtomMap *atom_map;
     struct {
         /* debug info, move to separate structure to save memory? */
         JSAtom filename;
@@ -850,7 +935,12 @@ struct JSShape {
        <= n <= 2^31-1. If false, the shape is guaranteed not to have
        small array index properties */
     uint8_t has_small_array_index;
+    /* true if the object owning the shape is used as a prototype. Such
+       a shape is never hashed nor shared and any modification of it
+       increments JSRuntime.proto_epoch */
+    uint8_t is_prototype;
     uint32_t hash; /* current hash value */
+    uint32_t ic_id; /* unique among the live shapes, changed on update */
     uint32_t prop_hash_mask;
     int prop_size; /* allocated properties */
     int prop_count; /* include deleted properties */
@@ -882,7 +972,7 @@ struct JSObject {
     JSShape *shape; /* prototype and property names + flag */
     JSProperty *prop; /* array of properties */
     /* byte offsets: 24/40 */
-    struct JSMapRecord *first_weak_ref; /* XXX: use a bit and an external hash table? */
+    struct JSMapWeakRef *first_weak_ref; /* XXX: use a bit and an external hash table? */
     /* byte offsets: 28/48 */
     union {
         void *opaque;
@@ -992,11 +1082,28 @@ enum OPCodeEnum {
     OP_TEMP_END,
 };
 
+#ifdef CONFIG_OPCODE_STATS
+typedef struct JSOpcodeStats {
+    /* the cycles between two dispatches are accounted to 'last_opcode'
+       (OP_invalid outside of the bytecode functions) */
+    int last_opcode;
+    uint64_t last_cycles;
+    uint64_t count[256];
+    uint64_t cycles[256];
+    /* pairs of consecutive opcodes in the same function */
+    uint64_t pair_count[256][256];
+} JSOpcodeStats;
+#endif
+
 static int JS_InitAtoms(JSRuntime *rt);
 static JSAtom __JS_NewAtomInit(JSRuntime *rt, const char *str, int len,
                                int atom_type);
 static void JS_FreeAtomStruct(JSRuntime *rt, JSAtomStruct *p);
 static void free_function_bytecode(JSRuntime *rt, JSFunctionBytecode *b);
+static void js_free_profiler(JSRuntime *rt, struct JSProfiler *prof);
+static void js_alloc_profiler_update(JSRuntime *rt, void *old_ptr,
+                                     void *new_ptr, size_t size);
+static void js_random_init(JSContext *ctx);
 static JSValue js_call_c_function(JSContext *ctx, JSValueConst func_obj,
                                   JSValueConst this_obj,
                                   int argc, JSValueConst *argv, int flags);
@@ -1006,6 +1113,8 @@ static JSValue js_call_bound_function(JSContext *ctx, JSValueConst func_obj,
 static JSValue JS_CallInternal(JSContext *ctx, JSValueConst func_obj,
                                JSValueConst this_obj, JSValueConst new_target,
                                int argc, JSValue *argv, int flags);
+static JSValue js_compile_lazy_function(JSContext *ctx, JSFunctionBytecode *b);
+static JSFunctionBytecode *js_get_lazy_function(JSContext *ctx, JSObject *p);
 static JSValue JS_CallConstructorInternal(JSContext *ctx,
                                           JSValueConst func_obj,
                                           JSValueConst new_target,
@@ -1093,6 +1202,7 @@ static int JS_ToFloat64Free(JSContext *ctx, double *pres, JSValue val);
 static int JS_ToUint8ClampFree(JSContext *ctx, int32_t *pres, JSValue val);
 static JSValue js_compile_regexp(JSContext *ctx, JSValueConst pattern,
                                  JSValueConst flags);
+static void js_regexp_cache_free(JSRuntime *rt);
 static JSValue js_regexp_constructor_internal(JSContext *ctx, JSValueConst ctor,
                                               JSValue pattern, JSValue bc);
 static void gc_decref(JSRuntime *rt);
@@ -1239,6 +1349,12 @@ static JSValue js_c_function_data_call(JSContext *ctx, JSValueConst func_obj,
 static JSAtom js_symbol_to_atom(JSContext *ctx, JSValue val);
 static void add_gc_object(JSRuntime *rt, JSGCObjectHeader *h,
                           JSGCObjectTypeEnum type);
+static void relink_gc_object(JSRuntime *rt, JSGCObjectHeader *h);
+static void gc_promote_young(JSRuntime *rt);
+static void gc_run_young(JSRuntime *rt);
+static void json_shape_cache_mark(JSRuntime *rt, JSContext *ctx,
+                                  JS_MarkFunc *mark_func);
+static void json_shape_cache_free(JSRuntime *rt, JSContext *ctx);
 static void remove_gc_object(JSGCObjectHeader *h);
 static void js_async_function_free0(JSRuntime *rt, JSAsyncFunctionData *s);
 static JSValue js_instantiate_prototype(JSContext *ctx, JSObject *p, JSAtom atom, void *opaque);
@@ -1268,7 +1384,15 @@ static void js_trigger_gc(JSRuntime *rt, size_t size)
         printf("GC: size=%" PRIu64 "\n",
                (uint64_t)rt->malloc_state.malloc_size);
 #endif
-        JS_RunGC(rt);
+        /* the old objects are only scanned when the memory has doubled
+           since the last full GC */
+        if (rt->malloc_state.malloc_size + size >
+            rt->malloc_full_gc_threshold) {
+            JS_RunGC(rt);
+            rt->malloc_full_gc_threshold = rt->malloc_state.malloc_size * 2;
+        } else {
+            gc_run_young(rt);
+        }
         rt->malloc_gc_threshold = rt->malloc_state.malloc_size +
             (rt->malloc_state.malloc_size >> 1);
     }
@@ -1281,17 +1405,28 @@ static size_t js_malloc_usable_size_unknown(const void *ptr)
 
 void *js_malloc_rt(JSRuntime *rt, size_t size)
 {
-    return rt->mf.js_malloc(&rt->malloc_state, size);
+    void *ptr;
+    ptr = rt->mf.js_malloc(&rt->malloc_state, size);
+    if (unlikely(rt->alloc_profiler) && ptr)
+        js_alloc_profiler_update(rt, NULL, ptr, size);
+    return ptr;
 }
 
 void js_free_rt(JSRuntime *rt, void *ptr)
 {
+    if (unlikely(rt->alloc_profiler) && ptr)
+        js_alloc_profiler_update(rt, ptr, NULL, 0);
     rt->mf.js_free(&rt->malloc_state, ptr);
 }
 
 void *js_realloc_rt(JSRuntime *rt, void *ptr, size_t size)
 {
-    return rt->mf.js_realloc(&rt->malloc_state, ptr, size);
+    void *new_ptr;
+    new_ptr = rt->mf.js_realloc(&rt->malloc_state, ptr, size);
+    /* the block is left unchanged if the reallocation fails */
+    if (unlikely(rt->alloc_profiler) && (new_ptr || size == 0))
+        js_alloc_profiler_update(rt, ptr, new_ptr, size);
+    return new_ptr;
 }
 
 size_t js_malloc_usable_size_rt(JSRuntime *rt, const void *ptr)
@@ -1623,13 +1758,16 @@ JSRuntime *JS_NewRuntime2(const JSMallocFunctions *mf, void *opaque)
 
     init_list_head(&rt->context_list);
     init_list_head(&rt->gc_obj_list);
+    init_list_head(&rt->gc_young_list);
     init_list_head(&rt->gc_zero_ref_count_list);
     rt->gc_phase = JS_GC_PHASE_NONE;
+    rt->gc_step_ns_per_object = 1000;
     
 #ifdef DUMP_LEAKS
     init_list_head(&rt->string_list);
 #endif
     init_list_head(&rt->job_list);
+    init_list_head(&rt->regexp_cache_list);
 
     if (JS_InitAtoms(rt))
         goto fail;
@@ -1653,6 +1791,11 @@ JSRuntime *JS_NewRuntime2(const JSMallocFunctions *mf, void *opaque)
     rt->stack_size = JS_DEFAULT_STACK_SIZE;
     rt->current_exception = JS_NULL;
 
+#ifdef CONFIG_OPCODE_STATS
+    rt->opcode_stats = js_mallocz_rt(rt, sizeof(*rt->opcode_stats));
+    if (!rt->opcode_stats)
+        goto fail;
+#endif
     return rt;
  fail:
     JS_FreeRuntime(rt);
@@ -1765,6 +1908,706 @@ JSRuntime *JS_NewRuntime(void)
     return JS_NewRuntime2(&def_malloc_funcs, NULL);
 }
 
+/* Size class pool allocator: the blocks of at most JS_POOL_MAX_SIZE
+   bytes are allocated in chunks holding blocks of the same size, which
+   avoids the malloc overhead and the heap fragmentation for the
+   objects, shapes and short strings. The larger blocks use the default
+   allocator. */
+#if defined(ESP32)
+#define JS_POOL_CHUNK_SIZE 1024
+#else
+#define JS_POOL_CHUNK_SIZE 4096
+#endif
+#define JS_POOL_MAX_SIZE 256
+
+/* the multiples of 8 up to 128 cover sizeof(JSObject), the initial
+   JSShape allocations and the short JSStrings in 32 and 64 bit mode */
+static const uint16_t js_pool_class_size[JS_MALLOC_POOL_CLASS_COUNT] = {
+    16, 24, 32, 40, 48, 56, 64, 72, 80, 88, 96, 104, 112, 120, 128,
+    144, 160, 176, 192, 224, 256,
+};
+
+typedef struct JSPoolChunk {
+    /* in JSPoolClass.free_chunks if the chunk has free blocks */
+    struct list_head link;
+    void *free_list; /* list of the free blocks */
+    uint8_t class_idx;
+    uint16_t used_count;
+    uint16_t block_count;
+} JSPoolChunk;
+
+#define JS_POOL_CHUNK_HEADER_SIZE ((sizeof(JSPoolChunk) + 7) & ~7)
+
+typedef struct JSPoolClass {
+    struct list_head free_chunks; /* list of JSPoolChunk.link */
+    int chunk_count;
+    int64_t used_count;
+} JSPoolClass;
+
+/* Fixed memory region: the pool, its chunks and the larger blocks are
+   allocated in a memory area given by the user so that the whole heap
+   of a runtime can be saved and loaded again (heap image). The blocks
+   have boundary tags and the free blocks are kept in segregated lists
+   and coalesced. The used part of the region is shrunk when its last
+   block is freed so that the saved image stays small. */
+typedef struct JSRegionBlock {
+    size_t prev_size; /* size of the previous block if it is free */
+    size_t size; /* block size including the header | JS_REGION_x flags */
+    /* the free blocks are followed by a struct list_head */
+} JSRegionBlock;
+
+#define JS_REGION_ALIGN       sizeof(JSRegionBlock)
+#define JS_REGION_USED        1
+#define JS_REGION_PREV_FREE   2
+#define JS_REGION_MIN_SIZE    ((sizeof(JSRegionBlock) + sizeof(struct list_head) + \
+                                JS_REGION_ALIGN - 1) & ~(JS_REGION_ALIGN - 1))
+#define JS_REGION_BIN_COUNT   24
+
+typedef struct JSMallocRegion {
+    uint8_t *top; /* end of the used part */
+    uint8_t *end; /* NULL if the pool is not in a region */
+    /* bin i contains the free blocks of size [2^(i+4), 2^(i+5)) */
+    struct list_head bins[JS_REGION_BIN_COUNT];
+} JSMallocRegion;
+
+struct JSMallocPool {
+    uint8_t class_index[JS_POOL_MAX_SIZE / 8 + 1]; /* (size + 7) / 8 -> class */
+    JSPoolClass classes[JS_MALLOC_POOL_CLASS_COUNT];
+    JSPoolChunk **chunks; /* sorted by increasing address */
+    int chunk_count;
+    int chunk_size;
+    JSMallocRegion region;
+};
+
+static inline size_t js_region_block_size(const JSRegionBlock *b)
+{
+    return b->size & ~(JS_REGION_ALIGN - 1);
+}
+
+static inline JSRegionBlock *js_region_block(void *ptr)
+{
+    return (JSRegionBlock *)ptr - 1;
+}
+
+static inline JSRegionBlock *js_region_offset(JSRegionBlock *b, size_t offset)
+{
+    return (JSRegionBlock *)((uint8_t *)b + offset);
+}
+
+static inline struct list_head *js_region_link(JSRegionBlock *b)
+{
+    return (struct list_head *)(b + 1);
+}
+
+static int js_region_bin(size_t size)
+{
+    if (size >= ((size_t)1 << (JS_REGION_BIN_COUNT + 4)))
+        return JS_REGION_BIN_COUNT - 1;
+    return 31 - clz32(size) - 4;
+}
+
+/* 'b' must be followed by a used block */
+static void js_region_add_free(JSMallocRegion *r, JSRegionBlock *b,
+                               size_t size)
+{
+    JSRegionBlock *next;
+
+    b->size = size;
+    next = js_region_offset(b, size);
+    next->prev_size = size;
+    next->size |= JS_REGION_PREV_FREE;
+    list_add(js_region_link(b), &r->bins[js_region_bin(size)]);
+}
+
+static void js_region_free(JSMallocRegion *r, void *ptr)
+{
+    JSRegionBlock *b, *prev, *next;
+    size_t size;
+
+    b = js_region_block(ptr);
+    size = js_region_block_size(b);
+    if (b->size & JS_REGION_PREV_FREE) {
+        prev = js_region_offset(b, -b->prev_size);
+        list_del(js_region_link(prev));
+        size += b->prev_size;
+        b = prev;
+    }
+    next = js_region_offset(b, size);
+    if ((uint8_t *)next == r->top) {
+        r->top = (uint8_t *)b;
+        return;
+    }
+    if (!(next->size & JS_REGION_USED)) {
+        list_del(js_region_link(next));
+        size += js_region_block_size(next);
+    }
+    js_region_add_free(r, b, size);
+}
+
+static size_t js_region_alloc_size(size_t size)
+{
+    if (size > SIZE_MAX / 2)
+        return SIZE_MAX / 2; /* cannot be allocated */
+    size = (size + sizeof(JSRegionBlock) + JS_REGION_ALIGN - 1) &
+        ~(JS_REGION_ALIGN - 1);
+    if (size < JS_REGION_MIN_SIZE)
+        size = JS_REGION_MIN_SIZE;
+    return size;
+}
+
+/* 'size' must be returned by js_region_alloc_size() */
+static void *js_region_malloc(JSMallocRegion *r, size_t size)
+{
+    JSRegionBlock *b, *b1, *next;
+    struct list_head *el;
+    size_t bsize;
+    int i;
+
+    /* first fit in the bin of 'size', then any block of a larger bin */
+    b = NULL;
+    i = js_region_bin(size);
+    list_for_each(el, &r->bins[i]) {
+        b1 = (JSRegionBlock *)el - 1;
+        if (js_region_block_size(b1) >= size) {
+            b = b1;
+            break;
+        }
+    }
+    while (!b && ++i < JS_REGION_BIN_COUNT) {
+        if (!list_empty(&r->bins[i]))
+            b = (JSRegionBlock *)r->bins[i].next - 1;
+    }
+    if (b) {
+        list_del(js_region_link(b));
+        bsize = js_region_block_size(b);
+        if (bsize - size >= JS_REGION_MIN_SIZE) {
+            js_region_add_free(r, js_region_offset(b, size), bsize - size);
+            bsize = size;
+        } else {
+            next = js_region_offset(b, bsize);
+            next->size &= ~JS_REGION_PREV_FREE;
+        }
+        b->size = bsize | JS_REGION_USED;
+    } else {
+        if ((size_t)(r->end - r->top) < size)
+            return NULL;
+        b = (JSRegionBlock *)r->top;
+        r->top += size;
+        b->size = size | JS_REGION_USED;
+    }
+    return b + 1;
+}
+
+/* 'size' must be returned by js_region_alloc_size() */
+static void *js_region_realloc(JSMallocRegion *r, void *ptr, size_t size)
+{
+    JSRegionBlock *b, *next;
+    size_t bsize, flags;
+    void *new_ptr;
+
+    b = js_region_block(ptr);
+    bsize = js_region_block_size(b);
+    flags = b->size & (JS_REGION_ALIGN - 1);
+    next = js_region_offset(b, bsize);
+    if (size > bsize) {
+        /* try to grow in place */
+        if ((uint8_t *)next == r->top) {
+            if ((size_t)(r->end - (uint8_t *)b) < size)
+                goto move;
+            r->top = (uint8_t *)b + size;
+            b->size = size | flags;
+            return ptr;
+        }
+        if ((next->size & JS_REGION_USED) ||
+            bsize + js_region_block_size(next) < size)
+            goto move;
+        list_del(js_region_link(next));
+        bsize += js_region_block_size(next);
+        next = js_region_offset(b, bsize);
+        next->size &= ~JS_REGION_PREV_FREE;
+        b->size = bsize | flags;
+    }
+    if (bsize - size >= JS_REGION_MIN_SIZE) {
+        /* free the end of the block */
+        b->size = size | flags;
+        next = js_region_offset(b, size);
+        next->size = (bsize - size) | JS_REGION_USED;
+        js_region_free(r, next + 1);
+    }
+    return ptr;
+ move:
+    new_ptr = js_region_malloc(r, size);
+    if (!new_ptr)
+        return NULL;
+    memcpy(new_ptr, ptr, bsize - sizeof(JSRegionBlock));
+    js_region_free(r, ptr);
+    return new_ptr;
+}
+
+static void js_pool_init(JSMallocPool *pool)
+{
+    int i, c;
+
+    memset(pool, 0, sizeof(*pool));
+    c = 0;
+    for(i = 0; i <= JS_POOL_MAX_SIZE / 8; i++) {
+        if (i * 8 > js_pool_class_size[c])
+            c++;
+        pool->class_index[i] = c;
+    }
+    for(i = 0; i < JS_MALLOC_POOL_CLASS_COUNT; i++)
+        init_list_head(&pool->classes[i].free_chunks);
+    for(i = 0; i < JS_REGION_BIN_COUNT; i++)
+        init_list_head(&pool->region.bins[i]);
+}
+
+JSMallocPool *JS_NewMallocPool(void)
+{
+    JSMallocPool *pool;
+
+    pool = malloc(sizeof(*pool));
+    if (!pool)
+        return NULL;
+    js_pool_init(pool);
+    return pool;
+}
+
+/* all the memory of the pool, including the pool itself, is allocated
+   in [base, base + size). 'base' must be aligned on 2 words. */
+JSMallocPool *JS_NewMallocPoolRegion(void *base, size_t size)
+{
+    JSMallocPool *pool = base;
+    size_t pool_size;
+
+    pool_size = (sizeof(*pool) + JS_REGION_ALIGN - 1) & ~(JS_REGION_ALIGN - 1);
+    if (((uintptr_t)base & (JS_REGION_ALIGN - 1)) != 0 || size < pool_size)
+        return NULL;
+    js_pool_init(pool);
+    pool->region.top = (uint8_t *)base + pool_size;
+    pool->region.end = (uint8_t *)base + size;
+    return pool;
+}
+
+/* must be called after JS_FreeRuntime() */
+void JS_FreeMallocPool(JSMallocPool *pool)
+{
+    int i;
+    if (pool->region.end)
+        return; /* the region belongs to the caller */
+    for(i = 0; i < pool->chunk_count; i++)
+        free(pool->chunks[i]);
+    free(pool->chunks);
+    free(pool);
+}
+
+/* allocation of the chunks and of the chunk array */
+static void *js_pool_sys_malloc(JSMallocPool *pool, size_t size)
+{
+    if (pool->region.end)
+        return js_region_malloc(&pool->region, js_region_alloc_size(size));
+    return malloc(size);
+}
+
+static void js_pool_sys_free(JSMallocPool *pool, void *ptr)
+{
+    if (pool->region.end)
+        js_region_free(&pool->region, ptr);
+    else
+        free(ptr);
+}
+
+static void *js_pool_sys_realloc(JSMallocPool *pool, void *ptr, size_t size)
+{
+    if (pool->region.end) {
+        if (!ptr)
+            return js_pool_sys_malloc(pool, size);
+        return js_region_realloc(&pool->region, ptr, js_region_alloc_size(size));
+    }
+    return realloc(ptr, size);
+}
+
+/* allocation of the blocks larger than JS_POOL_MAX_SIZE */
+static void *js_pool_large_malloc(JSMallocState *s, JSMallocPool *pool,
+                                  size_t size)
+{
+    void *ptr;
+
+    if (!pool->region.end)
+        return js_def_malloc(s, size);
+    size = js_region_alloc_size(size);
+    if (unlikely(s->malloc_size + size > s->malloc_limit))
+        return NULL;
+    ptr = js_region_malloc(&pool->region, size);
+    if (!ptr)
+        return NULL;
+    s->malloc_count++;
+    s->malloc_size += js_region_block_size(js_region_block(ptr));
+    return ptr;
+}
+
+static void js_pool_large_free(JSMallocState *s, JSMallocPool *pool,
+                               void *ptr)
+{
+    if (!pool->region.end) {
+        js_def_free(s, ptr);
+        return;
+    }
+    s->malloc_count--;
+    s->malloc_size -= js_region_block_size(js_region_block(ptr));
+    js_region_free(&pool->region, ptr);
+}
+
+static void *js_pool_large_realloc(JSMallocState *s, JSMallocPool *pool,
+                                   void *ptr, size_t size)
+{
+    size_t old_size;
+
+    if (!pool->region.end)
+        return js_def_realloc(s, ptr, size);
+    if (size == 0) {
+        js_pool_large_free(s, pool, ptr);
+        return NULL;
+    }
+    old_size = js_region_block_size(js_region_block(ptr));
+    size = js_region_alloc_size(size);
+    if (s->malloc_size + size - old_size > s->malloc_limit)
+        return NULL;
+    ptr = js_region_realloc(&pool->region, ptr, size);
+    if (!ptr)
+        return NULL;
+    s->malloc_size += js_region_block_size(js_region_block(ptr)) - old_size;
+    return ptr;
+}
+
+/* return the index of the first chunk whose address is > ptr */
+static int js_pool_chunk_pos(JSMallocPool *pool, const void *ptr)
+{
+    int a, b, m;
+    a = 0;
+    b = pool->chunk_count;
+    while (a < b) {
+        m = (a + b) >> 1;
+        if ((uintptr_t)pool->chunks[m] <= (uintptr_t)ptr)
+            a = m + 1;
+        else
+            b = m;
+    }
+    return a;
+}
+
+static JSPoolChunk *js_pool_find_chunk(JSMallocPool *pool, const void *ptr)
+{
+    JSPoolChunk *ch;
+    int pos;
+
+    pos = js_pool_chunk_pos(pool, ptr);
+    if (pos == 0)
+        return NULL;
+    ch = pool->chunks[pos - 1];
+    if ((uintptr_t)ptr >= (uintptr_t)ch + JS_POOL_CHUNK_SIZE)
+        return NULL;
+    return ch;
+}
+
+static JSPoolChunk *js_pool_new_chunk(JSMallocState *s, JSMallocPool *pool,
+                                      int class_idx)
+{
+    JSPoolClass *cls = &pool->classes[class_idx];
+    JSPoolChunk *ch;
+    uint8_t *ptr;
+    int i, pos, block_size;
+
+    if (unlikely(s->malloc_size + JS_POOL_CHUNK_SIZE > s->malloc_limit))
+        return NULL;
+    if (pool->chunk_count >= pool->chunk_size) {
+        int new_size;
+        JSPoolChunk **new_chunks;
+        new_size = max_int(pool->chunk_size * 3 / 2, 16);
+        new_chunks = js_pool_sys_realloc(pool, pool->chunks,
+                                         sizeof(pool->chunks[0]) * new_size);
+        if (!new_chunks)
+            return NULL;
+        pool->chunks = new_chunks;
+        pool->chunk_size = new_size;
+    }
+    ch = js_pool_sys_malloc(pool, JS_POOL_CHUNK_SIZE);
+    if (!ch)
+        return NULL;
+    s->malloc_size += JS_POOL_CHUNK_SIZE + MALLOC_OVERHEAD;
+
+    block_size = js_pool_class_size[class_idx];
+    ch->class_idx = class_idx;
+    ch->used_count = 0;
+    ch->block_count = (JS_POOL_CHUNK_SIZE - JS_POOL_CHUNK_HEADER_SIZE) / block_size;
+    ch->free_list = NULL;
+    ptr = (uint8_t *)ch + JS_POOL_CHUNK_HEADER_SIZE +
+        (ch->block_count - 1) * block_size;
+    for(i = 0; i < ch->block_count; i++) {
+        *(void **)ptr = ch->free_list;
+        ch->free_list = ptr;
+        ptr -= block_size;
+    }
+    list_add(&ch->link, &cls->free_chunks);
+    cls->chunk_count++;
+
+    pos = js_pool_chunk_pos(pool, ch);
+    memmove(pool->chunks + pos + 1, pool->chunks + pos,
+            sizeof(pool->chunks[0]) * (pool->chunk_count - pos));
+    pool->chunks[pos] = ch;
+    pool->chunk_count++;
+    return ch;
+}
+
+static void js_pool_free_chunk(JSMallocState *s, JSMallocPool *pool,
+                               JSPoolChunk *ch)
+{
+    int pos;
+
+    pos = js_pool_chunk_pos(pool, ch) - 1;
+    assert(pool->chunks[pos] == ch);
+    memmove(pool->chunks + pos, pool->chunks + pos + 1,
+            sizeof(pool->chunks[0]) * (pool->chunk_count - pos - 1));
+    pool->chunk_count--;
+    pool->classes[ch->class_idx].chunk_count--;
+    list_del(&ch->link);
+    s->malloc_size -= JS_POOL_CHUNK_SIZE + MALLOC_OVERHEAD;
+    js_pool_sys_free(pool, ch);
+}
+
+static void *js_pool_malloc(JSMallocState *s, size_t size)
+{
+    JSMallocPool *pool = s->opaque;
+    JSPoolClass *cls;
+    JSPoolChunk *ch;
+    void *ptr;
+    int class_idx;
+
+    if (size > JS_POOL_MAX_SIZE)
+        return js_pool_large_malloc(s, pool, size);
+    assert(size != 0);
+    class_idx = pool->class_index[(size + 7) >> 3];
+    cls = &pool->classes[class_idx];
+    if (unlikely(list_empty(&cls->free_chunks))) {
+        if (!js_pool_new_chunk(s, pool, class_idx))
+            return NULL;
+    }
+    ch = list_entry(cls->free_chunks.next, JSPoolChunk, link);
+    ptr = ch->free_list;
+    ch->free_list = *(void **)ptr;
+    if (++ch->used_count == ch->block_count)
+        list_del(&ch->link);
+    cls->used_count++;
+    s->malloc_count++;
+    return ptr;
+}
+
+static void js_pool_free_block(JSMallocState *s, JSMallocPool *pool,
+                               JSPoolChunk *ch, void *ptr)
+{
+    JSPoolClass *cls = &pool->classes[ch->class_idx];
+
+    *(void **)ptr = ch->free_list;
+    ch->free_list = ptr;
+    if (ch->used_count-- == ch->block_count)
+        list_add(&ch->link, &cls->free_chunks);
+    cls->used_count--;
+    s->malloc_count--;
+    /* keep one chunk per class to avoid allocating a new chunk at
+       each allocation */
+    if (ch->used_count == 0 && cls->chunk_count > 1)
+        js_pool_free_chunk(s, pool, ch);
+}
+
+static void js_pool_free(JSMallocState *s, void *ptr)
+{
+    JSMallocPool *pool = s->opaque;
+    JSPoolChunk *ch;
+
+    if (!ptr)
+        return;
+    ch = js_pool_find_chunk(pool, ptr);
+    if (ch)
+        js_pool_free_block(s, pool, ch, ptr);
+    else
+        js_pool_large_free(s, pool, ptr);
+}
+
+static void *js_pool_realloc(JSMallocState *s, void *ptr, size_t size)
+{
+    JSMallocPool *pool = s->opaque;
+    JSPoolChunk *ch;
+    size_t old_size;
+    void *new_ptr;
+
+    if (!ptr) {
+        if (size == 0)
+            return NULL;
+        return js_pool_malloc(s, size);
+    }
+    ch = js_pool_find_chunk(pool, ptr);
+    if (!ch)
+        return js_pool_large_realloc(s, pool, ptr, size);
+    if (size == 0) {
+        js_pool_free_block(s, pool, ch, ptr);
+        return NULL;
+    }
+    old_size = js_pool_class_size[ch->class_idx];
+    /* nothing to do if the size class does not change */
+    if (size <= old_size &&
+        (ch->class_idx == 0 || size > js_pool_class_size[ch->class_idx - 1]))
+        return ptr;
+    new_ptr = js_pool_malloc(s, size);
+    if (!new_ptr) {
+        /* the block can still be used if it is shrunk */
+        if (size <= old_size)
+            return ptr;
+        return NULL;
+    }
+    memcpy(new_ptr, ptr, size < old_size ? size : old_size);
+    js_pool_free_block(s, pool, ch, ptr);
+    return new_ptr;
+}
+
+static const JSMallocFunctions pool_malloc_funcs = {
+    js_pool_malloc,
+    js_pool_free,
+    js_pool_realloc,
+    NULL,
+};
+
+/* use with JS_NewRuntime2(JS_GetMallocPoolFunctions(), pool) */
+const JSMallocFunctions *JS_GetMallocPoolFunctions(void)
+{
+    return &pool_malloc_funcs;
+}
+
+/* Heap image: the used part of a memory region is saved as is. It
+   can only be loaded at the same address by the same executable, so
+   no pointer needs to be relocated. */
+#define JS_HEAP_IMAGE_MAGIC   0x49534a51 /* "QJSI" */
+#define JS_HEAP_IMAGE_VERSION 2
+
+typedef struct JSHeapImageHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t class_id_alloc;
+    /* layout of the main structures */
+    uint32_t runtime_size;
+    uint32_t context_size;
+    uint32_t object_size;
+    uint32_t shape_size;
+    /* identify the executable */
+    uint64_t code_addr;
+    uint64_t data_addr;
+    uint64_t base; /* address of the region */
+    uint64_t data_size; /* size of the data following the header */
+    uint64_t ctx;
+    /* the addresses above do not change with every build: the C
+       function pointers stored in the heap are only valid for the
+       executable identified by build_id */
+    uint32_t build_id_len;
+    uint8_t build_id[JS_HEAP_IMAGE_BUILD_ID_MAX];
+} JSHeapImageHeader;
+
+static void js_heap_image_header_init(JSHeapImageHeader *h,
+                                      const void *build_id,
+                                      size_t build_id_len)
+{
+    memset(h, 0, sizeof(*h));
+    h->magic = JS_HEAP_IMAGE_MAGIC;
+    h->version = JS_HEAP_IMAGE_VERSION;
+    h->runtime_size = sizeof(JSRuntime);
+    h->context_size = sizeof(JSContext);
+    h->object_size = sizeof(JSObject);
+    h->shape_size = sizeof(JSShape);
+    h->code_addr = (uintptr_t)JS_LoadHeapImage;
+    h->data_addr = (uintptr_t)&js_class_id_alloc;
+    h->build_id_len = build_id_len;
+    memcpy(h->build_id, build_id, build_id_len);
+}
+
+/* The runtime of 'ctx' must be allocated with the pool functions and
+   JS_NewMallocPoolRegion(). 'build_id' identifies the executable (at
+   most JS_HEAP_IMAGE_BUILD_ID_MAX bytes). 'write_func' is called with
+   the header and with the content of the region. No JS code may be
+   running. */
+int JS_SaveHeapImage(JSContext *ctx, const void *build_id,
+                     size_t build_id_len, JSHeapImageWriteFunc *write_func,
+                     void *opaque)
+{
+    JSRuntime *rt = ctx->rt;
+    JSMallocPool *pool = rt->malloc_state.opaque;
+    JSHeapImageHeader h;
+
+    if (rt->mf.js_malloc != js_pool_malloc || !pool->region.end) {
+        JS_ThrowTypeError(ctx, "the runtime is not allocated in a memory region");
+        return -1;
+    }
+    if (rt->current_stack_frame) {
+        JS_ThrowTypeError(ctx, "cannot save the heap image of a running runtime");
+        return -1;
+    }
+    if (build_id_len > JS_HEAP_IMAGE_BUILD_ID_MAX) {
+        JS_ThrowRangeError(ctx, "build ID is too long");
+        return -1;
+    }
+    /* the cycles are not worth saving */
+    JS_RunGC(rt);
+
+    js_heap_image_header_init(&h, build_id, build_id_len);
+    h.class_id_alloc = js_class_id_alloc;
+    h.base = (uintptr_t)pool;
+    h.data_size = pool->region.top - (uint8_t *)pool;
+    h.ctx = (uintptr_t)ctx;
+    if (write_func(opaque, &h, sizeof(h)) < 0 ||
+        write_func(opaque, pool, h.data_size) < 0)
+        return -1;
+    return 0;
+}
+
+/* Load an image saved by JS_SaveHeapImage() in the region [base, base
+   + size), which must be at the same address as the saved region. The
+   C classes must be registered with JS_NewClassID() in the same order
+   before loading the image. The host data referenced by the heap
+   (opaque pointers, interrupt handler) must also be set again. Return
+   the saved context or NULL if the image is not compatible, in
+   particular if it was saved with another 'build_id'. */
+JSContext *JS_LoadHeapImage(void *base, size_t size,
+                            const void *buf, size_t buf_len,
+                            const void *build_id, size_t build_id_len)
+{
+    JSHeapImageHeader h, h1;
+    JSMallocPool *pool = base;
+    JSRuntime *rt;
+    JSContext *ctx;
+    struct list_head *el;
+
+    if (buf_len < sizeof(h) || build_id_len > JS_HEAP_IMAGE_BUILD_ID_MAX)
+        return NULL;
+    memcpy(&h, buf, sizeof(h));
+    js_heap_image_header_init(&h1, build_id, build_id_len);
+    h1.class_id_alloc = h.class_id_alloc;
+    h1.base = (uintptr_t)base;
+    h1.data_size = h.data_size;
+    h1.ctx = h.ctx;
+    if (memcmp(&h, &h1, sizeof(h)) != 0 ||
+        h.data_size > size || h.data_size > buf_len - sizeof(h))
+        return NULL;
+    memcpy(base, (const uint8_t *)buf + sizeof(h), h.data_size);
+
+    /* fix the state which depends on the process */
+    pool->region.end = (uint8_t *)base + size;
+    if (js_class_id_alloc < h.class_id_alloc)
+        js_class_id_alloc = h.class_id_alloc;
+    ctx = (JSContext *)(uintptr_t)h.ctx;
+    rt = ctx->rt;
+    rt->stack_top = js_get_stack_pointer();
+    list_for_each(el, &rt->context_list) {
+        js_random_init(list_entry(el, JSContext, link));
+    }
+    return ctx;
+}
+
 void JS_SetMemoryLimit(JSRuntime *rt, size_t limit)
 {
     rt->malloc_state.malloc_limit = limit;
@@ -1927,6 +2770,16 @@ void JS_FreeRuntime(JSRuntime *rt)
 
     JS_FreeValueRT(rt, rt->current_exception);
 
+    JS_FreeAllocationProfiler(rt);
+    if (rt->profiler) {
+        js_free_profiler(rt, rt->profiler);
+        rt->profiler = NULL;
+    }
+#ifdef CONFIG_OPCODE_STATS
+    js_free_rt(rt, rt->opcode_stats);
+    rt->opcode_stats = NULL;
+#endif
+
     list_for_each_safe(el, el1, &rt->job_list) {
         JSJobEntry *e = list_entry(el, JSJobEntry, link);
         for(i = 0; i < e->argc; i++)
@@ -1935,6 +2788,9 @@ void JS_FreeRuntime(JSRuntime *rt)
     }
     init_list_head(&rt->job_list);
 
+    js_regexp_cache_free(rt);
+
+    rt->deferred_free = FALSE;
     JS_RunGC(rt);
 
 #ifdef DUMP_LEAKS
@@ -1946,6 +2802,7 @@ void JS_FreeRuntime(JSRuntime *rt)
 
         /* remove the internal refcounts to display only the object
            referenced externally */
+        gc_promote_young(rt);
         list_for_each(el, &rt->gc_obj_list) {
             p = list_entry(el, JSGCObjectHeader, link);
             p->mark = 0;
@@ -1977,6 +2834,7 @@ void JS_FreeRuntime(JSRuntime *rt)
     }
 #endif
     assert(list_empty(&rt->gc_obj_list));
+    assert(list_empty(&rt->gc_young_list));
 
     /* free the classes */
     for(i = 0; i < rt->class_count; i++) {
@@ -2264,6 +3122,7 @@ static void JS_MarkContext(JSRuntime *rt, JSContext *ctx,
 
     if (ctx->array_shape)
         mark_func(rt, &ctx->array_shape->header);
+    json_shape_cache_mark(rt, ctx, mark_func);
 }
 
 void JS_FreeContext(JSContext *ctx)
@@ -2287,6 +3146,7 @@ void JS_FreeContext(JSContext *ctx)
         JSGCObjectHeader *p;
         printf("JSObjects: {\n");
         JS_DumpObjectHeader(ctx->rt);
+        gc_promote_young(rt);
         list_for_each(el, &rt->gc_obj_list) {
             p = list_entry(el, JSGCObjectHeader, link);
             JS_DumpGCObject(rt, p);
@@ -2327,6 +3187,7 @@ void JS_FreeContext(JSContext *ctx)
     JS_FreeValue(ctx, ctx->function_proto);
 
     js_free_shape_null(ctx->rt, ctx->array_shape);
+    json_shape_cache_free(rt, ctx);
 
     list_del(&ctx->link);
     remove_gc_object(&ctx->header);
@@ -2380,6 +3241,15 @@ static inline BOOL __JS_AtomIsTaggedInt(JSAtom v)
     return (v & JS_ATOM_TAG_INT) != 0;
 }
 
+/* return the atom of the operand 'idx' of an opcode of 'b' */
+static inline JSAtom js_bytecode_atom(const JSFunctionBytecode *b, JSAtom idx)
+{
+    const JSBytecodeAtomMap *map = b->atom_map;
+    if (likely(!map) || __JS_AtomIsTaggedInt(idx) || idx < map->first_atom)
+        return idx;
+    return map->atoms[idx - map->first_atom];
+}
+
 static inline JSAtom __JS_AtomFromUInt32(uint32_t v)
 {
     return v | JS_ATOM_TAG_INT;
@@ -4152,6 +5022,400 @@ static JSValue JS_ConcatString1(JSContext *ctx,
     return JS_MKPTR(JS_TAG_STRING, p);
 }
 
+static inline BOOL tag_is_string(uint32_t tag)
+{
+    return tag == JS_TAG_STRING || tag == JS_TAG_STRING_ROPE;
+}
+
+/* 'v' is a string or a rope */
+static inline uint32_t js_string_value_len(JSValueConst v)
+{
+    if (JS_VALUE_GET_TAG(v) == JS_TAG_STRING_ROPE)
+        return ((JSStringRope *)JS_VALUE_GET_PTR(v))->len;
+    else
+        return JS_VALUE_GET_STRING(v)->len;
+}
+
+static inline int js_string_value_is_wide_char(JSValueConst v)
+{
+    if (JS_VALUE_GET_TAG(v) == JS_TAG_STRING_ROPE)
+        return ((JSStringRope *)JS_VALUE_GET_PTR(v))->is_wide_char;
+    else
+        return JS_VALUE_GET_STRING(v)->is_wide_char;
+}
+
+static inline int js_string_value_depth(JSValueConst v)
+{
+    if (JS_VALUE_GET_TAG(v) == JS_TAG_STRING_ROPE)
+        return ((JSStringRope *)JS_VALUE_GET_PTR(v))->depth;
+    else
+        return 0;
+}
+
+/* return the flat string of a linearized rope, otherwise 'v' */
+static inline JSValueConst js_rope_unwrap(JSValueConst v)
+{
+    if (JS_VALUE_GET_TAG(v) == JS_TAG_STRING_ROPE) {
+        JSStringRope *r = JS_VALUE_GET_PTR(v);
+        if (JS_VALUE_GET_TAG(r->right) == JS_TAG_STRING &&
+            JS_VALUE_GET_STRING(r->right)->len == 0)
+            return r->left;
+    }
+    return v;
+}
+
+/* the ropes are freed */
+static JSValue js_new_rope(JSContext *ctx, JSValue left, JSValue right)
+{
+    JSStringRope *r;
+
+    r = js_malloc(ctx, sizeof(*r));
+    if (!r) {
+        JS_FreeValue(ctx, left);
+        JS_FreeValue(ctx, right);
+        return JS_EXCEPTION;
+    }
+    r->header.ref_count = 1;
+    r->len = js_string_value_len(left) + js_string_value_len(right);
+    r->is_wide_char = js_string_value_is_wide_char(left) |
+        js_string_value_is_wide_char(right);
+    r->depth = max_int(js_string_value_depth(left),
+                       js_string_value_depth(right)) + 1;
+    r->left = left;
+    r->right = right;
+    return JS_MKPTR(JS_TAG_STRING_ROPE, r);
+}
+
+static void js_rope_copy(JSString *p, uint32_t pos, JSValueConst v)
+{
+    JSString *p1;
+
+    while (JS_VALUE_GET_TAG(v) == JS_TAG_STRING_ROPE) {
+        JSStringRope *r = JS_VALUE_GET_PTR(v);
+        js_rope_copy(p, pos, r->left);
+        pos += js_string_value_len(r->left);
+        v = r->right;
+    }
+    p1 = JS_VALUE_GET_STRING(v);
+    if (p->is_wide_char)
+        copy_str16(p->u.str16 + pos, p1, 0, p1->len);
+    else
+        memcpy(p->u.str8 + pos, p1->u.str8, p1->len);
+}
+
+/* return a flat string with the content of the rope 'v'. The result
+   is kept in the rope so that the characters are copied only once. */
+static JSValue js_linearize_rope(JSContext *ctx, JSValueConst v)
+{
+    JSStringRope *r = JS_VALUE_GET_PTR(v);
+    JSValueConst v1;
+    JSString *p;
+    JSValue str;
+
+    v1 = js_rope_unwrap(v);
+    if (JS_VALUE_GET_TAG(v1) == JS_TAG_STRING)
+        return JS_DupValue(ctx, v1);
+    p = js_alloc_string(ctx, r->len, r->is_wide_char);
+    if (!p)
+        return JS_EXCEPTION;
+    js_rope_copy(p, 0, v);
+    if (!p->is_wide_char)
+        p->u.str8[r->len] = '\0';
+    str = JS_MKPTR(JS_TAG_STRING, p);
+    JS_FreeValue(ctx, r->left);
+    JS_FreeValue(ctx, r->right);
+    r->left = JS_DupValue(ctx, str);
+    r->right = JS_AtomToString(ctx, JS_ATOM_empty_string);
+    r->depth = 1;
+    return str;
+}
+
+static int js_rope_get_leaves(JSValueConst *tab, int n, JSValueConst v)
+{
+    v = js_rope_unwrap(v);
+    while (JS_VALUE_GET_TAG(v) == JS_TAG_STRING_ROPE) {
+        JSStringRope *r = JS_VALUE_GET_PTR(v);
+        n = js_rope_get_leaves(tab, n, r->left);
+        v = js_rope_unwrap(r->right);
+    }
+    if (tab)
+        tab[n] = v;
+    return n + 1;
+}
+
+static JSValue js_rope_build(JSContext *ctx, JSValueConst *tab, int n)
+{
+    JSValue left, right;
+
+    if (n == 1)
+        return JS_DupValue(ctx, tab[0]);
+    left = js_rope_build(ctx, tab, n / 2);
+    if (JS_IsException(left))
+        return left;
+    right = js_rope_build(ctx, tab + n / 2, n - n / 2);
+    if (JS_IsException(right)) {
+        JS_FreeValue(ctx, left);
+        return right;
+    }
+    return js_new_rope(ctx, left, right);
+}
+
+/* return a balanced rope with the same leaves. 'v' is freed. */
+static JSValue js_rebalance_rope(JSContext *ctx, JSValue v)
+{
+    JSValueConst *tab;
+    JSValue ret;
+    int n;
+
+    n = js_rope_get_leaves(NULL, 0, v);
+    tab = js_malloc(ctx, sizeof(tab[0]) * n);
+    if (!tab) {
+        JS_FreeValue(ctx, v);
+        return JS_EXCEPTION;
+    }
+    js_rope_get_leaves(tab, 0, v);
+    ret = js_rope_build(ctx, tab, n);
+    js_free(ctx, tab);
+    JS_FreeValue(ctx, v);
+    return ret;
+}
+
+/* op1 and op2 are strings or ropes and are freed */
+static JSValue js_concat_rope(JSContext *ctx, JSValue op1, JSValue op2)
+{
+    JSValueConst v1, v2;
+    JSValue left, right, ret;
+    JSStringRope *r;
+
+    if (js_string_value_len(op1) + js_string_value_len(op2) >
+        JS_STRING_LEN_MAX) {
+        JS_FreeValue(ctx, op1);
+        JS_FreeValue(ctx, op2);
+        return JS_ThrowInternalError(ctx, "string too long");
+    }
+    v1 = js_rope_unwrap(op1);
+    v2 = js_rope_unwrap(op2);
+    /* a short string is merged with the adjacent leaf of the rope if
+       it is short too, so that the tree only grows when a leaf is full */
+    if (JS_VALUE_GET_TAG(v1) == JS_TAG_STRING_ROPE &&
+        JS_VALUE_GET_TAG(v2) == JS_TAG_STRING) {
+        r = JS_VALUE_GET_PTR(v1);
+        if (JS_VALUE_GET_TAG(r->right) == JS_TAG_STRING &&
+            js_string_value_len(r->right) + js_string_value_len(v2) <
+            JS_STRING_ROPE_SHORT_LEN) {
+            left = JS_DupValue(ctx, r->left);
+            right = JS_ConcatString1(ctx, JS_VALUE_GET_STRING(r->right),
+                                     JS_VALUE_GET_STRING(v2));
+            goto merge;
+        }
+    } else if (JS_VALUE_GET_TAG(v1) == JS_TAG_STRING &&
+               JS_VALUE_GET_TAG(v2) == JS_TAG_STRING_ROPE) {
+        r = JS_VALUE_GET_PTR(v2);
+        if (JS_VALUE_GET_TAG(r->left) == JS_TAG_STRING &&
+            js_string_value_len(r->left) + js_string_value_len(v1) <
+            JS_STRING_ROPE_SHORT_LEN) {
+            left = JS_ConcatString1(ctx, JS_VALUE_GET_STRING(v1),
+                                    JS_VALUE_GET_STRING(r->left));
+            right = JS_DupValue(ctx, r->right);
+            goto merge;
+        }
+    }
+    ret = js_new_rope(ctx, JS_DupValue(ctx, v1), JS_DupValue(ctx, v2));
+    JS_FreeValue(ctx, op1);
+    JS_FreeValue(ctx, op2);
+    goto done;
+ merge:
+    JS_FreeValue(ctx, op1);
+    JS_FreeValue(ctx, op2);
+    if (JS_IsException(left) || JS_IsException(right)) {
+        JS_FreeValue(ctx, left);
+        JS_FreeValue(ctx, right);
+        return JS_EXCEPTION;
+    }
+    ret = js_new_rope(ctx, left, right);
+ done:
+    if (!JS_IsException(ret) &&
+        js_string_value_depth(ret) > JS_STRING_ROPE_MAX_DEPTH)
+        ret = js_rebalance_rope(ctx, ret);
+    return ret;
+}
+
+/* append the string 'op2' to the last leaf of the rope 'op1' when
+   neither of them is shared. Return FALSE if it is not possible. */
+static BOOL js_rope_append_in_place(JSContext *ctx, JSValueConst op1,
+                                    JSValueConst op2)
+{
+    JSStringRope *r;
+    JSString *p1, *p2;
+    size_t size;
+
+    if (JS_VALUE_GET_TAG(op1) != JS_TAG_STRING_ROPE ||
+        JS_VALUE_GET_TAG(op2) != JS_TAG_STRING)
+        return FALSE;
+    r = JS_VALUE_GET_PTR(op1);
+    if (r->header.ref_count != 1 ||
+        JS_VALUE_GET_TAG(r->right) != JS_TAG_STRING)
+        return FALSE;
+    p1 = JS_VALUE_GET_STRING(r->right);
+    p2 = JS_VALUE_GET_STRING(op2);
+    if (p1->header.ref_count != 1 || p1->atom_type != 0 ||
+        p1->is_wide_char != p2->is_wide_char ||
+        p1->len + p2->len >= JS_STRING_ROPE_SHORT_LEN)
+        return FALSE;
+    size = sizeof(JSString) + ((p1->len + p2->len) << p1->is_wide_char) +
+        1 - p1->is_wide_char;
+    if (js_malloc_usable_size(ctx, p1) < size) {
+        /* grow the leaf to its maximum size so that the next
+           appends are done in place too */
+#ifdef DUMP_LEAKS
+        list_del(&p1->link);
+#endif
+        p1 = js_realloc_rt(ctx->rt, p1, sizeof(JSString) +
+                           (JS_STRING_ROPE_SHORT_LEN << p1->is_wide_char));
+        if (!p1)
+            p1 = JS_VALUE_GET_STRING(r->right);
+#ifdef DUMP_LEAKS
+        list_add_tail(&p1->link, &ctx->rt->string_list);
+#endif
+        r->right = JS_MKPTR(JS_TAG_STRING, p1);
+        if (js_malloc_usable_size(ctx, p1) < size)
+            return FALSE;
+    }
+    if (p1->is_wide_char) {
+        memcpy(p1->u.str16 + p1->len, p2->u.str16, p2->len << 1);
+    } else {
+        memcpy(p1->u.str8 + p1->len, p2->u.str8, p2->len);
+        p1->u.str8[p1->len + p2->len] = '\0';
+    }
+    p1->len += p2->len;
+    r->len += p2->len;
+    return TRUE;
+}
+
+/* the leaves of a rope from left to right, without memory allocation */
+typedef struct JSRopeIter {
+    int sp;
+    JSValueConst stack[JS_STRING_ROPE_MAX_DEPTH + 1];
+} JSRopeIter;
+
+static void js_rope_iter_init(JSRopeIter *it, JSValueConst v)
+{
+    it->stack[0] = v;
+    it->sp = 1;
+}
+
+/* return NULL at the end */
+static JSString *js_rope_iter_next(JSRopeIter *it)
+{
+    JSValueConst v;
+    JSString *p;
+
+    while (it->sp > 0) {
+        v = it->stack[--it->sp];
+        while (JS_VALUE_GET_TAG(v) == JS_TAG_STRING_ROPE) {
+            JSStringRope *r = JS_VALUE_GET_PTR(v);
+            it->stack[it->sp++] = r->right;
+            v = r->left;
+        }
+        p = JS_VALUE_GET_STRING(v);
+        if (p->len != 0)
+            return p;
+    }
+    return NULL;
+}
+
+/* return the character at position 'idx' of a string or rope */
+static int js_string_value_get(JSValueConst v, uint32_t idx)
+{
+    uint32_t len;
+
+    while (JS_VALUE_GET_TAG(v) == JS_TAG_STRING_ROPE) {
+        JSStringRope *r = JS_VALUE_GET_PTR(v);
+        len = js_string_value_len(r->left);
+        if (idx < len) {
+            v = r->left;
+        } else {
+            idx -= len;
+            v = r->right;
+        }
+    }
+    return string_get(JS_VALUE_GET_STRING(v), idx);
+}
+
+static int js_string_memcmp2(const JSString *p1, uint32_t pos1,
+                             const JSString *p2, uint32_t pos2, uint32_t len)
+{
+    uint32_t i;
+    int c1, c2;
+
+    if (!p1->is_wide_char && !p2->is_wide_char)
+        return memcmp(p1->u.str8 + pos1, p2->u.str8 + pos2, len);
+    for(i = 0; i < len; i++) {
+        c1 = string_get(p1, pos1 + i);
+        c2 = string_get(p2, pos2 + i);
+        if (c1 != c2)
+            return c1 - c2;
+    }
+    return 0;
+}
+
+/* compare two strings or ropes. Return < 0, 0 or > 0. */
+static int js_string_value_compare(JSContext *ctx,
+                                   JSValueConst v1, JSValueConst v2)
+{
+    JSRopeIter it1, it2;
+    JSString *p1, *p2;
+    uint32_t pos1, pos2, len;
+    int res;
+
+    v1 = js_rope_unwrap(v1);
+    v2 = js_rope_unwrap(v2);
+    if (JS_VALUE_GET_TAG(v1) == JS_TAG_STRING &&
+        JS_VALUE_GET_TAG(v2) == JS_TAG_STRING) {
+        return js_string_compare(ctx, JS_VALUE_GET_STRING(v1),
+                                 JS_VALUE_GET_STRING(v2));
+    }
+    js_rope_iter_init(&it1, v1);
+    js_rope_iter_init(&it2, v2);
+    p1 = js_rope_iter_next(&it1);
+    p2 = js_rope_iter_next(&it2);
+    pos1 = pos2 = 0;
+    while (p1 && p2) {
+        len = min_uint32(p1->len - pos1, p2->len - pos2);
+        res = js_string_memcmp2(p1, pos1, p2, pos2, len);
+        if (res != 0)
+            return res;
+        pos1 += len;
+        pos2 += len;
+        if (pos1 == p1->len) {
+            p1 = js_rope_iter_next(&it1);
+            pos1 = 0;
+        }
+        if (pos2 == p2->len) {
+            p2 = js_rope_iter_next(&it2);
+            pos2 = 0;
+        }
+    }
+    if (p1)
+        return 1;
+    else if (p2)
+        return -1;
+    else
+        return 0;
+}
+
+/* same result as hash_string() on the linearized rope */
+static uint32_t hash_string_rope(JSValueConst v, uint32_t h)
+{
+    JSRopeIter it;
+    JSString *p;
+
+    js_rope_iter_init(&it, v);
+    while ((p = js_rope_iter_next(&it)) != NULL)
+        h = hash_string(p, h);
+    return h;
+}
+
 /* op1 and op2 are converted to strings. For convience, op1 or op2 =
    JS_EXCEPTION are accepted and return JS_EXCEPTION.  */
 static JSValue JS_ConcatString(JSContext *ctx, JSValue op1, JSValue op2)
@@ -4159,27 +5423,36 @@ static JSValue JS_ConcatString(JSContext *ctx, JSValue op1, JSValue op2)
     JSValue ret;
     JSString *p1, *p2;
 
-    if (unlikely(JS_VALUE_GET_TAG(op1) != JS_TAG_STRING)) {
+    if (unlikely(!tag_is_string(JS_VALUE_GET_TAG(op1)))) {
         op1 = JS_ToStringFree(ctx, op1);
         if (JS_IsException(op1)) {
             JS_FreeValue(ctx, op2);
             return JS_EXCEPTION;
         }
     }
-    if (unlikely(JS_VALUE_GET_TAG(op2) != JS_TAG_STRING)) {
+    if (unlikely(!tag_is_string(JS_VALUE_GET_TAG(op2)))) {
         op2 = JS_ToStringFree(ctx, op2);
         if (JS_IsException(op2)) {
             JS_FreeValue(ctx, op1);
             return JS_EXCEPTION;
         }
     }
+    if (js_string_value_len(op2) == 0) {
+        goto ret_op1;
+    }
+    if (js_string_value_len(op1) == 0) {
+        JS_FreeValue(ctx, op1);
+        return op2;
+    }
+    if (JS_VALUE_GET_TAG(op1) != JS_TAG_STRING ||
+        JS_VALUE_GET_TAG(op2) != JS_TAG_STRING) {
+        if (js_rope_append_in_place(ctx, op1, op2))
+            goto ret_op1;
+        return js_concat_rope(ctx, op1, op2);
+    }
     p1 = JS_VALUE_GET_STRING(op1);
     p2 = JS_VALUE_GET_STRING(op2);
 
-    /* XXX: could also check if p1 is empty */
-    if (p2->len == 0) {
-        goto ret_op1;
-    }
     if (p1->header.ref_count == 1 && p1->is_wide_char == p2->is_wide_char
     &&  js_malloc_usable_size(ctx, p1) >= sizeof(*p1) + ((p1->len + p2->len) << p2->is_wide_char) + 1 - p1->is_wide_char) {
         /* Concatenate in place in available space at the end of p1 */
@@ -4195,6 +5468,8 @@ static JSValue JS_ConcatString(JSContext *ctx, JSValue op1, JSValue op2)
         JS_FreeValue(ctx, op2);
         return op1;
     }
+    if (p1->len + p2->len >= JS_STRING_ROPE_SHORT_LEN)
+        return js_concat_rope(ctx, op1, op2);
     ret = JS_ConcatString1(ctx, p1, p2);
     JS_FreeValue(ctx, op1);
     JS_FreeValue(ctx, op2);
@@ -4310,6 +5585,71 @@ static void js_shape_hash_unlink(JSRuntime *rt, JSShape *sh)
     rt->shape_hash_count--;
 }
 
+/* renumber the live shapes and empty all the inline caches. Only
+   needed when JSRuntime.shape_ic_id wraps around. */
+static no_inline void js_reset_inline_caches(JSRuntime *rt)
+{
+    struct list_head *el;
+    JSGCObjectHeader *gp;
+    JSFunctionBytecode *b;
+    JSContext *ctx;
+    int i;
+
+    rt->shape_ic_id = 0;
+    list_for_each(el, &rt->context_list) {
+        ctx = list_entry(el, JSContext, link);
+        memset(ctx->json_plain_shapes, 0, sizeof(ctx->json_plain_shapes));
+    }
+    gc_promote_young(rt);
+    list_for_each(el, &rt->gc_obj_list) {
+        gp = list_entry(el, JSGCObjectHeader, link);
+        switch(gp->gc_obj_type) {
+        case JS_GC_OBJ_TYPE_SHAPE:
+            ((JSShape *)gp)->ic_id = ++rt->shape_ic_id;
+            break;
+        case JS_GC_OBJ_TYPE_FUNCTION_BYTECODE:
+            b = (JSFunctionBytecode *)gp;
+            for(i = 0; i < b->ic_count; i++) {
+                memset(b->ic[i].entries, 0, sizeof(b->ic[i].entries));
+            }
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+/* must be called each time the property layout or the prototype of
+   'sh' is modified so that the inline caches referencing it miss */
+static inline void js_shape_update_ic_id(JSRuntime *rt, JSShape *sh)
+{
+    if (unlikely(rt->shape_ic_id == UINT32_MAX))
+        js_reset_inline_caches(rt);
+    sh->ic_id = ++rt->shape_ic_id;
+    if (sh->is_prototype) {
+        if (unlikely(rt->proto_epoch == UINT32_MAX)) {
+            js_reset_inline_caches(rt);
+            rt->proto_epoch = 0;
+        }
+        rt->proto_epoch++;
+    }
+}
+
+static int js_shape_prepare_update(JSContext *ctx, JSObject *p,
+                                   JSShapeProperty **pprs);
+
+/* 'p' is used as a prototype: give it its own shape so that its
+   modifications can be tracked */
+static int js_mark_prototype(JSContext *ctx, JSObject *p)
+{
+    if (!p->shape->is_prototype) {
+        if (js_shape_prepare_update(ctx, p, NULL))
+            return -1;
+        p->shape->is_prototype = TRUE;
+    }
+    return 0;
+}
+
 /* create a new empty shape with prototype 'proto' */
 static no_inline JSShape *js_new_shape2(JSContext *ctx, JSObject *proto,
                                         int hash_size, int prop_size)
@@ -4318,6 +5658,9 @@ static no_inline JSShape *js_new_shape2(JSContext *ctx, JSObject *proto,
     void *sh_alloc;
     JSShape *sh;
 
+    if (proto && js_mark_prototype(ctx, proto))
+        return NULL;
+
     /* resize the shape hash table if necessary */
     if (2 * (rt->shape_hash_count + 1) > rt->shape_hash_size) {
         resize_shape_hash(rt, rt->shape_hash_bits + 1);
@@ -4338,11 +5681,13 @@ static no_inline JSShape *js_new_shape2(JSContext *ctx, JSObject *proto,
     sh->prop_size = prop_size;
     sh->prop_count = 0;
     sh->deleted_prop_count = 0;
+    sh->has_small_array_index = FALSE;
+    sh->is_prototype = FALSE;
+    js_shape_update_ic_id(rt, sh);
     
     /* insert in the hash table */
     sh->hash = shape_initial_hash(proto);
     sh->is_hashed = TRUE;
-    sh->has_small_array_index = FALSE;
     js_shape_hash_link(ctx->rt, sh);
     return sh;
 }
@@ -4374,6 +5719,7 @@ static JSShape *js_clone_shape(JSContext *ctx, JSShape *sh1)
     sh->header.ref_count = 1;
     add_gc_object(ctx->rt, &sh->header, JS_GC_OBJ_TYPE_SHAPE);
     sh->is_hashed = FALSE;
+    js_shape_update_ic_id(ctx->rt, sh);
     if (sh->proto) {
         JS_DupValue(ctx, JS_MKPTR(JS_TAG_OBJECT, sh->proto));
     }
@@ -4458,7 +5804,7 @@ static no_inline int resize_properties(JSContext *ctx, JSShape **psh,
         /* copy all the fields and the properties */
         memcpy(sh, old_sh,
                sizeof(JSShape) + sizeof(sh->prop[0]) * old_sh->prop_count);
-        list_add_tail(&sh->header.link, &ctx->rt->gc_obj_list);
+        relink_gc_object(ctx->rt, &sh->header);
         new_hash_mask = new_hash_size - 1;
         sh->prop_hash_mask = new_hash_mask;
         memset(prop_hash_end(sh) - new_hash_size, 0,
@@ -4478,11 +5824,11 @@ static no_inline int resize_properties(JSContext *ctx, JSShape **psh,
                               get_shape_size(new_hash_size, new_size));
         if (unlikely(!sh_alloc)) {
             /* insert again in the GC list */
-            list_add_tail(&sh->header.link, &ctx->rt->gc_obj_list);
+            relink_gc_object(ctx->rt, &sh->header);
             return -1;
         }
         sh = get_shape_from_alloc(sh_alloc, new_hash_size);
-        list_add_tail(&sh->header.link, &ctx->rt->gc_obj_list);
+        relink_gc_object(ctx->rt, &sh->header);
     }
     *psh = sh;
     sh->prop_size = new_size;
@@ -4519,7 +5865,7 @@ static int compact_properties(JSContext *ctx, JSObject *p)
     sh = get_shape_from_alloc(sh_alloc, new_hash_size);
     list_del(&old_sh->header.link);
     memcpy(sh, old_sh, sizeof(JSShape));
-    list_add_tail(&sh->header.link, &ctx->rt->gc_obj_list);
+    relink_gc_object(ctx->rt, &sh->header);
     
     memset(prop_hash_end(sh) - new_hash_size, 0,
            sizeof(prop_hash_end(sh)[0]) * new_hash_size);
@@ -4546,6 +5892,7 @@ static int compact_properties(JSContext *ctx, JSObject *p)
     sh->prop_size = new_size;
     sh->deleted_prop_count = 0;
     sh->prop_count = j;
+    js_shape_update_ic_id(ctx->rt, sh);
 
     p->shape = sh;
     js_free(ctx, get_alloc_from_shape(old_sh));
@@ -4593,6 +5940,7 @@ static int add_shape_property(JSContext *ctx, JSShape **psh,
     pr->atom = JS_DupAtom(ctx, atom);
     pr->flags = prop_flags;
     sh->has_small_array_index |= __JS_AtomIsTaggedInt(atom);
+    js_shape_update_ic_id(rt, sh);
     /* add in hash table */
     hash_mask = sh->prop_hash_mask;
     h = atom & hash_mask;
@@ -4686,6 +6034,7 @@ static __maybe_unused void JS_DumpShapes(JSRuntime *rt)
         }
     }
     /* dump non-hashed shapes */
+    gc_promote_young(rt);
     list_for_each(el, &rt->gc_obj_list) {
         gp = list_entry(el, JSGCObjectHeader, link);
         if (gp->gc_obj_type == JS_GC_OBJ_TYPE_JS_OBJECT) {
@@ -5479,6 +6828,14 @@ void __JS_FreeValueRT(JSRuntime *rt, JSValue v)
             }
         }
         break;
+    case JS_TAG_STRING_ROPE:
+        {
+            JSStringRope *r = JS_VALUE_GET_PTR(v);
+            JS_FreeValueRT(rt, r->left);
+            JS_FreeValueRT(rt, r->right);
+            js_free_rt(rt, r);
+        }
+        break;
     case JS_TAG_OBJECT:
     case JS_TAG_FUNCTION_BYTECODE:
         {
@@ -5486,9 +6843,16 @@ void __JS_FreeValueRT(JSRuntime *rt, JSValue v)
             if (rt->gc_phase != JS_GC_PHASE_REMOVE_CYCLES) {
                 list_del(&p->link);
                 list_add(&p->link, &rt->gc_zero_ref_count_list);
-                if (rt->gc_phase == JS_GC_PHASE_NONE) {
+                if (rt->gc_phase == JS_GC_PHASE_NONE && !rt->deferred_free) {
                     free_zero_refcount(rt);
                 }
+            } else if (p->mark != 1) {
+                /* object outside of the freed cycles which was only
+                   referenced by them (e.g. outside of the window of
+                   JS_RunGCStep()): free it with the cycles */
+                list_del(&p->link);
+                list_add_tail(&p->link, &rt->tmp_obj_list);
+                p->mark = 1;
             }
         }
         break;
@@ -5534,11 +6898,51 @@ void __JS_FreeValue(JSContext *ctx, JSValue v)
 static void add_gc_object(JSRuntime *rt, JSGCObjectHeader *h,
                           JSGCObjectTypeEnum type)
 {
-    h->mark = 0;
+    /* the young objects have mark = 2 so that gc_run_young() can
+       use them as a window without walking them first */
+    h->mark = 2;
     h->gc_obj_type = type;
-    list_add_tail(&h->link, &rt->gc_obj_list);
+    list_add_tail(&h->link, &rt->gc_young_list);
 }
 
+/* insert again a GC object which was moved in memory */
+static void relink_gc_object(JSRuntime *rt, JSGCObjectHeader *h)
+{
+    if (h->mark == 2)
+        list_add_tail(&h->link, &rt->gc_young_list);
+    else
+        list_add_tail(&h->link, &rt->gc_obj_list);
+}
+
+/* must be called before walking gc_obj_list to see all the GC objects */
+static void gc_promote_young(JSRuntime *rt)
+{
+    struct list_head *el;
+    JSGCObjectHeader *p;
+
+    list_for_each(el, &rt->gc_young_list) {
+        p = list_entry(el, JSGCObjectHeader, link);
+        p->mark = 0;
+    }
+    list_splice_tail(&rt->gc_young_list, &rt->gc_obj_list);
+}
+
+/* next element of gc_obj_list followed by gc_young_list */
+static inline struct list_head *gc_obj_next(JSRuntime *rt,
+                                            struct list_head *el)
+{
+    el = el->next;
+    if (el == &rt->gc_obj_list)
+        el = rt->gc_young_list.next;
+    return el;
+}
+
+/* walk all the GC objects without promoting the young ones, so that
+   the read-only queries do not change the next GC */
+#define gc_obj_for_each(el, rt)                                         \
+    for(el = gc_obj_next(rt, &(rt)->gc_obj_list);                       \
+        el != &(rt)->gc_young_list; el = gc_obj_next(rt, el))
+
 static void remove_gc_object(JSGCObjectHeader *h)
 {
     list_del(&h->link);
@@ -5773,6 +7177,11 @@ static void gc_free_cycles(JSRuntime *rt)
 
 void JS_RunGC(JSRuntime *rt)
 {
+    /* gc_free_cycles() uses gc_zero_ref_count_list */
+    if (rt->gc_phase == JS_GC_PHASE_NONE)
+        free_zero_refcount(rt);
+    gc_promote_young(rt);
+
     /* decrement the reference of the children of each object. mark =
        1 after this pass. */
     gc_decref(rt);
@@ -5784,6 +7193,220 @@ void JS_RunGC(JSRuntime *rt)
     gc_free_cycles(rt);
 }
 
+static void gc_window_decref(JSRuntime *rt, JSGCObjectHeader *p)
+{
+    assert(p->ref_count > 0);
+    p->ref_count--;
+    if (p->ref_count == 0 && p->mark == 1) {
+        list_del(&p->link);
+        list_add_tail(&p->link, &rt->tmp_obj_list);
+    }
+}
+
+/* only the references internal to the window are removed. In
+   JS_RunGCStep(), the objects of the window have mark = 3 (1 once
+   visited) and the young objects outside of it have mark = 2. */
+static void gc_step_decref_child(JSRuntime *rt, JSGCObjectHeader *p)
+{
+    if (p->mark & 1)
+        gc_window_decref(rt, p);
+}
+
+/* in gc_run_young(), the window contains all the young objects */
+static void gc_young_decref_child(JSRuntime *rt, JSGCObjectHeader *p)
+{
+    if (p->mark != 0)
+        gc_window_decref(rt, p);
+}
+
+static void gc_step_incref_child(JSRuntime *rt, JSGCObjectHeader *p)
+{
+    if (p->mark == 1) {
+        p->ref_count++;
+        if (p->ref_count == 1) {
+            /* ref_count was 0: remove from tmp_obj_list and add at
+               the end of gc_obj_list */
+            list_del(&p->link);
+            list_add_tail(&p->link, &rt->gc_obj_list);
+        }
+    }
+}
+
+static void gc_step_incref_child2(JSRuntime *rt, JSGCObjectHeader *p)
+{
+    if (p->mark == 1)
+        p->ref_count++;
+}
+
+static int64_t gc_get_time_us(void)
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+/* collect the cycles of the GC objects of gc_obj_list. 'rest' and
+   gc_young_list contain the other GC objects, whose references are
+   considered as roots. 'decref_child' tells from the mark if an
+   object is in the window. The survivors are moved at the end of
+   'rest' which becomes gc_obj_list again. */
+static void gc_collect_window(JSRuntime *rt, struct list_head *rest,
+                              JS_MarkFunc *decref_child)
+{
+    struct list_head *el, *el1;
+    JSGCObjectHeader *p;
+
+    init_list_head(&rt->tmp_obj_list);
+    /* decrement the internal references and move the objects with a
+       zero refcount to tmp_obj_list, as in gc_decref(). mark = 1
+       after this pass. */
+    list_for_each_safe(el, el1, &rt->gc_obj_list) {
+        p = list_entry(el, JSGCObjectHeader, link);
+        mark_children(rt, p, decref_child);
+        p->mark = 1;
+        if (p->ref_count == 0) {
+            list_del(&p->link);
+            list_add_tail(&p->link, &rt->tmp_obj_list);
+        }
+    }
+
+    /* keep the objects with a refcount > 0 and their children */
+    list_for_each(el, &rt->gc_obj_list) {
+        p = list_entry(el, JSGCObjectHeader, link);
+        assert(p->ref_count > 0);
+        mark_children(rt, p, gc_step_incref_child);
+    }
+    /* restore the refcount of the objects to be deleted */
+    list_for_each(el, &rt->tmp_obj_list) {
+        p = list_entry(el, JSGCObjectHeader, link);
+        mark_children(rt, p, gc_step_incref_child2);
+    }
+    list_for_each(el, &rt->gc_obj_list) {
+        p = list_entry(el, JSGCObjectHeader, link);
+        p->mark = 0;
+    }
+    list_splice_tail(&rt->gc_obj_list, rest);
+    list_splice_tail(rest, &rt->gc_obj_list);
+
+    gc_free_cycles(rt);
+}
+
+/* free the objects of gc_zero_ref_count_list until the time
+   'deadline' (see gc_get_time_us()). Return FALSE if some objects
+   remain. */
+static BOOL free_deferred_objects(JSRuntime *rt, int64_t deadline)
+{
+    struct list_head *el;
+    JSGCObjectHeader *p;
+    JSObject *p1;
+    int n, i;
+
+    rt->gc_phase = JS_GC_PHASE_DECREF;
+    for(n = 0;; n++) {
+        el = rt->gc_zero_ref_count_list.next;
+        if (el == &rt->gc_zero_ref_count_list)
+            break;
+        /* the time is only read every 64 objects */
+        if ((n & 63) == 63 && gc_get_time_us() >= deadline)
+            break;
+        p = list_entry(el, JSGCObjectHeader, link);
+        assert(p->ref_count == 0);
+        if (p->gc_obj_type == JS_GC_OBJ_TYPE_JS_OBJECT) {
+            /* the elements of the large arrays are released by
+               chunks so that an array does not exceed the deadline */
+            p1 = (JSObject *)p;
+            if ((p1->class_id == JS_CLASS_ARRAY ||
+                 p1->class_id == JS_CLASS_ARGUMENTS) &&
+                p1->u.array.count > 64) {
+                for(i = 0; i < 64; i++) {
+                    p1->u.array.count--;
+                    JS_FreeValueRT(rt, p1->u.array.u.values[p1->u.array.count]);
+                }
+                continue;
+            }
+        }
+        free_gc_object(rt, p);
+    }
+    rt->gc_phase = JS_GC_PHASE_NONE;
+    return list_empty(&rt->gc_zero_ref_count_list);
+}
+
+void JS_SetDeferredFree(JSRuntime *rt, BOOL enable)
+{
+    rt->deferred_free = enable;
+    if (!enable && rt->gc_phase == JS_GC_PHASE_NONE)
+        free_zero_refcount(rt);
+}
+
+/* Incremental version of JS_RunGC(): the cycle collection is done on
+   a window of the oldest GC objects whose size is chosen so that the
+   call takes about 'budget_us' microseconds. The references coming
+   from outside the window are considered as roots. Each step is
+   atomic so no write barrier is needed when the mutator runs between
+   two steps. The surviving objects are moved to the end of
+   gc_obj_list so that the next steps cover the whole heap. The cycles
+   larger than a window are only collected by JS_RunGC(). The objects
+   whose freeing was deferred (see JS_SetDeferredFree()) are freed
+   first, within the same budget. */
+void JS_RunGCStep(JSRuntime *rt, int budget_us)
+{
+    struct list_head rest, *el;
+    JSGCObjectHeader *p;
+    int64_t n, count, ti, t0;
+
+    if (budget_us <= 0 || rt->gc_phase != JS_GC_PHASE_NONE)
+        return;
+    t0 = gc_get_time_us();
+    if (!free_deferred_objects(rt, t0 + budget_us))
+        return;
+    ti = gc_get_time_us();
+    budget_us -= ti - t0;
+    n = (int64_t)budget_us * 1000 / rt->gc_step_ns_per_object;
+    n = max_int64(n, 16);
+
+    /* gc_obj_list temporarily contains only the window, taken from
+       the old objects then from the young ones */
+    init_list_head(&rest);
+    list_splice_tail(&rt->gc_obj_list, &rest);
+    for(count = 0; count < n; count++) {
+        el = rest.next;
+        if (el == &rest) {
+            el = rt->gc_young_list.next;
+            if (el == &rt->gc_young_list)
+                break;
+        }
+        p = list_entry(el, JSGCObjectHeader, link);
+        assert(p->mark == 0 || p->mark == 2);
+        p->mark = 3;
+        list_del(&p->link);
+        list_add_tail(&p->link, &rt->gc_obj_list);
+    }
+    gc_collect_window(rt, &rest, gc_step_decref_child);
+
+    /* update the cost estimation */
+    if (count >= 16) {
+        ti = (gc_get_time_us() - ti) * 1000 / count;
+        ti = (rt->gc_step_ns_per_object + ti) / 2;
+        rt->gc_step_ns_per_object = max_int64(min_int64(ti, 1000000), 1);
+    }
+}
+
+/* Generational collection: most objects die young, either from their
+   refcount or in a cycle with other young objects. js_trigger_gc()
+   scans only the GC objects created since the last GC, as a window of
+   JS_RunGCStep(), and the survivors become old objects. */
+static void gc_run_young(JSRuntime *rt)
+{
+    struct list_head rest;
+
+    if (rt->gc_phase == JS_GC_PHASE_NONE)
+        free_zero_refcount(rt);
+    init_list_head(&rest);
+    list_splice_tail(&rt->gc_obj_list, &rest);
+    list_splice_tail(&rt->gc_young_list, &rt->gc_obj_list);
+    gc_collect_window(rt, &rest, gc_young_decref_child);
+}
+
 /* Return false if not an object or if the object has already been
    freed (zombie objects are visible in finalizers when freeing
    cycles). */
@@ -5843,13 +7466,17 @@ static void compute_bytecode_size(JSFunctionBytecode *b, JSMemoryUsage_helper *h
     if (!b->read_only_bytecode && b->byte_code_buf) {
         hp->js_func_code_size += b->byte_code_len;
     }
+    if (b->ic) {
+        memory_used_count++;
+        js_func_size += b->ic_count * sizeof(*b->ic);
+    }
     if (b->has_debug) {
         js_func_size += sizeof(*b) - offsetof(JSFunctionBytecode, debug);
         if (b->debug.source) {
             memory_used_count++;
             js_func_size += b->debug.source_len + 1;
         }
-        if (b->debug.pc2line_len) {
+        if (b->debug.pc2line_len && !b->read_only_bytecode) {
             memory_used_count++;
             hp->js_func_pc2line_count += 1;
             hp->js_func_pc2line_size += b->debug.pc2line_len;
@@ -5866,6 +7493,16 @@ static void compute_value_size(JSValueConst val, JSMemoryUsage_helper *hp)
     case JS_TAG_STRING:
         compute_jsstring_size(JS_VALUE_GET_STRING(val), hp);
         break;
+    case JS_TAG_STRING_ROPE:
+        {
+            JSStringRope *r = JS_VALUE_GET_PTR(val);
+            double s_ref_count = r->header.ref_count;
+            hp->str_count += 1 / s_ref_count;
+            hp->str_size += sizeof(*r) / s_ref_count;
+            compute_value_size(r->left, hp);
+            compute_value_size(r->right, hp);
+        }
+        break;
 #ifdef CONFIG_BIGNUM
     case JS_TAG_BIG_INT:
     case JS_TAG_BIG_FLOAT:
@@ -5890,6 +7527,22 @@ void JS_ComputeMemoryUsage(JSRuntime *rt, JSMemoryUsage *s)
     s->memory_used_count = 2; /* rt + rt->class_array */
     s->memory_used_size = sizeof(JSRuntime) + sizeof(JSValue) * rt->class_count;
 
+    if (rt->mf.js_malloc == js_pool_malloc) {
+        JSMallocPool *pool = rt->malloc_state.opaque;
+        for(i = 0; i < JS_MALLOC_POOL_CLASS_COUNT; i++) {
+            JSPoolClass *cls = &pool->classes[i];
+            JSMallocPoolClassUsage *cs = &s->pool_classes[i];
+            int block_size = js_pool_class_size[i];
+            cs->block_size = block_size;
+            cs->chunk_count = cls->chunk_count;
+            cs->block_count = (int64_t)cls->chunk_count *
+                ((JS_POOL_CHUNK_SIZE - JS_POOL_CHUNK_HEADER_SIZE) / block_size);
+            cs->used_count = cls->used_count;
+        }
+        s->pool_chunk_count = pool->chunk_count;
+        s->pool_size = (int64_t)pool->chunk_count * JS_POOL_CHUNK_SIZE;
+    }
+
     list_for_each(el, &rt->context_list) {
         JSContext *ctx = list_entry(el, JSContext, link);
         JSShape *sh = ctx->array_shape;
@@ -5938,7 +7591,7 @@ void JS_ComputeMemoryUsage(JSRuntime *rt, JSMemoryUsage *s)
         }
     }
 
-    list_for_each(el, &rt->gc_obj_list) {
+    gc_obj_for_each(el, rt) {
         JSGCObjectHeader *gp = list_entry(el, JSGCObjectHeader, link);
         JSObject *p;
         JSShape *sh;
@@ -6207,7 +7860,7 @@ void JS_DumpMemoryUsage(FILE *fp, const JSMemoryUsage *s, JSRuntime *rt)
             int obj_classes[JS_CLASS_INIT_COUNT + 1] = { 0 };
             int class_id;
             struct list_head *el;
-            list_for_each(el, &rt->gc_obj_list) {
+            gc_obj_for_each(el, rt) {
                 JSGCObjectHeader *gp = list_entry(el, JSGCObjectHeader, link);
                 JSObject *p;
                 if (gp->gc_obj_type == JS_GC_OBJ_TYPE_JS_OBJECT) {
@@ -6293,6 +7946,680 @@ void JS_DumpMemoryUsage(FILE *fp, const JSMemoryUsage *s, JSRuntime *rt)
         fprintf(fp, "%-20s %8"PRId64" %8"PRId64"\n",
                 "binary objects", s->binary_object_count, s->binary_object_size);
     }
+    if (s->pool_chunk_count) {
+        int i;
+        fprintf(fp, "%-20s %8"PRId64" %8"PRId64"\n",
+                "pool chunks", s->pool_chunk_count, s->pool_size);
+        for(i = 0; i < JS_MALLOC_POOL_CLASS_COUNT; i++) {
+            const JSMallocPoolClassUsage *cs = &s->pool_classes[i];
+            if (cs->chunk_count) {
+                fprintf(fp, "  %-18"PRId64" %8"PRId64" %8"PRId64"  (%0.1f%% used)\n",
+                        cs->block_size, cs->used_count, cs->used_count * cs->block_size,
+                        100.0 * cs->used_count / cs->block_count);
+            }
+        }
+    }
+}
+
+/* Heap snapshot in the .heapsnapshot JSON format of Chrome DevTools.
+   The nodes are the GC objects and the strings referenced by them,
+   the edges are found with mark_children() except for the objects,
+   whose properties are named. The GC objects which have references
+   from outside the GC objects are the children of the root node. */
+
+enum {
+    JS_HEAP_NODE_HIDDEN = 0,
+    JS_HEAP_NODE_STRING = 2,
+    JS_HEAP_NODE_OBJECT = 3,
+    JS_HEAP_NODE_CODE = 4,
+    JS_HEAP_NODE_CLOSURE = 5,
+    JS_HEAP_NODE_REGEXP = 6,
+    JS_HEAP_NODE_SYNTHETIC = 9,
+    JS_HEAP_NODE_CONCATENATED_STRING = 10,
+    JS_HEAP_NODE_OBJECT_SHAPE = 14,
+};
+
+enum {
+    JS_HEAP_EDGE_CONTEXT = 0,
+    JS_HEAP_EDGE_ELEMENT = 1,
+    JS_HEAP_EDGE_PROPERTY = 2,
+    JS_HEAP_EDGE_INTERNAL = 3,
+};
+
+/* fixed strings, in the order of js_heap_snapshot_names[] */
+enum {
+    JS_HEAP_STR_EMPTY,
+    JS_HEAP_STR_ROOT,
+    JS_HEAP_STR_MAP,
+    JS_HEAP_STR_PROTO,
+    JS_HEAP_STR_INTERNAL,
+    JS_HEAP_STR_VALUE,
+    JS_HEAP_STR_HOME_OBJECT,
+    JS_HEAP_STR_CODE,
+    JS_HEAP_STR_FIRST,
+    JS_HEAP_STR_SECOND,
+    JS_HEAP_STR_SHAPE,
+    JS_HEAP_STR_VAR_REF,
+    JS_HEAP_STR_ASYNC_FUNCTION,
+    JS_HEAP_STR_REALM,
+    JS_HEAP_STR_ROPE,
+    JS_HEAP_STR_ANONYMOUS,
+    JS_HEAP_STR_OBJECT,
+    JS_HEAP_STR_COUNT,
+};
+
+static const char * const js_heap_snapshot_names[JS_HEAP_STR_COUNT] = {
+    "", "(root)", "map", "__proto__", "(internal)", "value", "home_object",
+    "code", "first", "second", "(shape)", "(closure variable)",
+    "(async function)", "(realm)", "(rope)", "(anonymous)", "Object",
+};
+
+typedef struct JSHeapNode {
+    void *ptr; /* GC object, JSString or JSStringRope */
+    uint8_t type;
+    uint32_t name;
+    uint32_t self_size;
+    uint32_t edge_count;
+    uint32_t ref_count; /* references from the GC objects */
+} JSHeapNode;
+
+typedef struct JSHeapEdge {
+    uint8_t type;
+    uint32_t name_or_index;
+    uint32_t to_node;
+} JSHeapEdge;
+
+typedef struct JSHeapSnapshot {
+    JSRuntime *rt;
+    BOOL error; /* not enough memory */
+    JSHeapNode *nodes;
+    uint32_t node_count;
+    uint32_t node_size;
+    uint32_t *node_hash; /* index + 1 of the node of a pointer, 0 if none */
+    uint32_t node_hash_size; /* power of two */
+    JSHeapEdge *edges;
+    uint32_t edge_count;
+    uint32_t edge_size;
+    DynBuf strings; /* JSON strings separated by commas */
+    uint32_t string_count;
+    int32_t *atom_strings; /* string of each atom or -1 */
+    /* edge added by js_heap_snapshot_mark() */
+    uint8_t mark_edge_type;
+    uint32_t mark_edge_name;
+    uint32_t cur_node; /* node whose edges are added */
+} JSHeapSnapshot;
+
+static uint32_t js_heap_snapshot_hash(const void *ptr, uint32_t hash_size)
+{
+    return (uint32_t)(((uint64_t)(uintptr_t)ptr * 0x9e3779b97f4a7c15) >> 32) &
+        (hash_size - 1);
+}
+
+/* return the node index of 'ptr' or 0 if none */
+static uint32_t js_heap_snapshot_find(JSHeapSnapshot *hs, const void *ptr)
+{
+    uint32_t h, i;
+
+    for(h = js_heap_snapshot_hash(ptr, hs->node_hash_size);;
+        h = (h + 1) & (hs->node_hash_size - 1)) {
+        i = hs->node_hash[h];
+        if (i == 0 || hs->nodes[i - 1].ptr == ptr)
+            return i ? i - 1 : 0;
+    }
+}
+
+/* return the index of the new node or 0 if error */
+static uint32_t js_heap_snapshot_new_node(JSHeapSnapshot *hs, void *ptr,
+                                          int type, uint32_t name,
+                                          size_t self_size)
+{
+    JSRuntime *rt = hs->rt;
+    JSHeapNode *n;
+    uint32_t h, i;
+
+    if (hs->node_count >= hs->node_size) {
+        uint32_t new_size = max_int(hs->node_size * 3 / 2, 256);
+        n = js_realloc_rt(rt, hs->nodes, sizeof(n[0]) * new_size);
+        if (!n)
+            goto fail;
+        hs->nodes = n;
+        hs->node_size = new_size;
+    }
+    /* at most half full */
+    if (2 * (hs->node_count + 1) > hs->node_hash_size) {
+        uint32_t new_size = max_int(hs->node_hash_size * 2, 512), *node_hash;
+        node_hash = js_mallocz_rt(rt, sizeof(node_hash[0]) * new_size);
+        if (!node_hash)
+            goto fail;
+        for(i = 1; i < hs->node_count; i++) {
+            for(h = js_heap_snapshot_hash(hs->nodes[i].ptr, new_size);
+                node_hash[h] != 0; h = (h + 1) & (new_size - 1))
+                continue;
+            node_hash[h] = i + 1;
+        }
+        js_free_rt(rt, hs->node_hash);
+        hs->node_hash = node_hash;
+        hs->node_hash_size = new_size;
+    }
+    i = hs->node_count++;
+    n = &hs->nodes[i];
+    n->ptr = ptr;
+    n->type = type;
+    n->name = name;
+    n->self_size = min_int64(self_size, UINT32_MAX);
+    n->edge_count = 0;
+    n->ref_count = 0;
+    if (ptr) {
+        for(h = js_heap_snapshot_hash(ptr, hs->node_hash_size);
+            hs->node_hash[h] != 0; h = (h + 1) & (hs->node_hash_size - 1))
+            continue;
+        hs->node_hash[h] = i + 1;
+    }
+    return i;
+ fail:
+    hs->error = TRUE;
+    return 0;
+}
+
+static void js_heap_snapshot_put_cstr(DynBuf *dbuf, const char *s)
+{
+    dbuf_putc(dbuf, '"');
+    for(; *s; s++) {
+        if (*s == '"' || *s == '\\')
+            dbuf_printf(dbuf, "\\%c", *s);
+        else if ((uint8_t)*s < 0x20)
+            dbuf_printf(dbuf, "\\u%04x", (uint8_t)*s);
+        else
+            dbuf_putc(dbuf, *s);
+    }
+    dbuf_putc(dbuf, '"');
+}
+
+/* return the index of a new string */
+static uint32_t js_heap_snapshot_new_cstr(JSHeapSnapshot *hs, const char *s)
+{
+    if (hs->string_count != 0)
+        dbuf_putc(&hs->strings, ',');
+    js_heap_snapshot_put_cstr(&hs->strings, s);
+    return hs->string_count++;
+}
+
+static uint32_t js_heap_snapshot_atom(JSHeapSnapshot *hs, JSAtom atom)
+{
+    char buf[ATOM_GET_STR_BUF_SIZE];
+
+    if (__JS_AtomIsTaggedInt(atom) || atom >= hs->rt->atom_size)
+        return js_heap_snapshot_new_cstr(hs, JS_AtomGetStrRT(hs->rt, buf, sizeof(buf), atom));
+    if (hs->atom_strings[atom] < 0) {
+        hs->atom_strings[atom] =
+            js_heap_snapshot_new_cstr(hs, JS_AtomGetStrRT(hs->rt, buf,
+                                                          sizeof(buf), atom));
+    }
+    return hs->atom_strings[atom];
+}
+
+/* at most 'max_len' characters of a string */
+static uint32_t js_heap_snapshot_string(JSHeapSnapshot *hs, JSString *p,
+                                        uint32_t max_len)
+{
+    DynBuf *dbuf = &hs->strings;
+    uint32_t i, c;
+
+    if (p->atom_type != 0)
+        return js_heap_snapshot_atom(hs, js_get_atom_index(hs->rt, p));
+    if (hs->string_count != 0)
+        dbuf_putc(dbuf, ',');
+    dbuf_putc(dbuf, '"');
+    for(i = 0; i < min_uint32(p->len, max_len); i++) {
+        c = p->is_wide_char ? p->u.str16[i] : p->u.str8[i];
+        if (c == '"' || c == '\\')
+            dbuf_printf(dbuf, "\\%c", c);
+        else if (c < 0x20 || c >= 0x7f)
+            dbuf_printf(dbuf, "\\u%04x", c);
+        else
+            dbuf_putc(dbuf, c);
+    }
+    dbuf_putc(dbuf, '"');
+    return hs->string_count++;
+}
+
+/* own 'prop' property of 'p' if it is a string, otherwise JS_UNDEFINED */
+static JSValueConst js_heap_snapshot_get_string(JSObject *p, JSAtom prop)
+{
+    JSProperty *pr;
+    JSShapeProperty *prs;
+
+    prs = find_own_property(&pr, p, prop);
+    if (prs && (prs->flags & JS_PROP_TMASK) == JS_PROP_NORMAL &&
+        JS_VALUE_GET_TAG(pr->u.value) == JS_TAG_STRING)
+        return pr->u.value;
+    return JS_UNDEFINED;
+}
+
+static BOOL js_heap_snapshot_is_function(JSObject *p)
+{
+    switch(p->class_id) {
+    case JS_CLASS_C_FUNCTION:
+    case JS_CLASS_BOUND_FUNCTION:
+    case JS_CLASS_C_FUNCTION_DATA:
+        return TRUE;
+    default:
+        return js_class_has_bytecode(p->class_id);
+    }
+}
+
+static uint32_t js_heap_snapshot_add_gc_object(JSHeapSnapshot *hs,
+                                               JSGCObjectHeader *gp)
+{
+    JSRuntime *rt = hs->rt;
+    int type;
+    uint32_t name;
+    size_t size;
+
+    switch(gp->gc_obj_type) {
+    case JS_GC_OBJ_TYPE_JS_OBJECT:
+        {
+            JSObject *p = (JSObject *)gp, *ctor;
+            JSValueConst str;
+            JSProperty *pr;
+            JSShapeProperty *prs;
+
+            size = sizeof(*p) + sizeof(JSProperty) * p->shape->prop_size;
+            if ((p->class_id == JS_CLASS_ARRAY ||
+                 p->class_id == JS_CLASS_ARGUMENTS) && p->fast_array) {
+                size += sizeof(JSValue) * p->u.array.u1.size;
+            } else if ((p->class_id == JS_CLASS_ARRAY_BUFFER ||
+                        p->class_id == JS_CLASS_SHARED_ARRAY_BUFFER) &&
+                       p->u.array_buffer) {
+                size += p->u.array_buffer->byte_length;
+            }
+            name = JS_HEAP_STR_ANONYMOUS;
+            str = JS_UNDEFINED;
+            if (js_heap_snapshot_is_function(p)) {
+                type = JS_HEAP_NODE_CLOSURE;
+                if (js_class_has_bytecode(p->class_id)) {
+                    if (p->u.func.function_bytecode->func_name != JS_ATOM_NULL &&
+                        p->u.func.function_bytecode->func_name != JS_ATOM_empty_string)
+                        name = js_heap_snapshot_atom(hs, p->u.func.function_bytecode->func_name);
+                } else {
+                    str = js_heap_snapshot_get_string(p, JS_ATOM_name);
+                }
+            } else {
+                type = p->class_id == JS_CLASS_REGEXP ? JS_HEAP_NODE_REGEXP :
+                    JS_HEAP_NODE_OBJECT;
+                name = js_heap_snapshot_atom(hs, rt->class_array[p->class_id].class_name);
+                /* name of the constructor for the plain objects */
+                if (p->class_id == JS_CLASS_OBJECT) {
+                    name = JS_HEAP_STR_OBJECT;
+                    if (p->shape->proto) {
+                        prs = find_own_property(&pr, p->shape->proto,
+                                                JS_ATOM_constructor);
+                        if (prs && (prs->flags & JS_PROP_TMASK) == JS_PROP_NORMAL &&
+                            JS_VALUE_GET_TAG(pr->u.value) == JS_TAG_OBJECT) {
+                            ctor = JS_VALUE_GET_OBJ(pr->u.value);
+                            if (js_class_has_bytecode(ctor->class_id) &&
+                                ctor->u.func.function_bytecode->func_name != JS_ATOM_NULL &&
+                                ctor->u.func.function_bytecode->func_name != JS_ATOM_empty_string)
+                                name = js_heap_snapshot_atom(hs, ctor->u.func.function_bytecode->func_name);
+                            else
+                                str = js_heap_snapshot_get_string(ctor, JS_ATOM_name);
+                        }
+                    }
+                }
+            }
+            if (JS_VALUE_GET_TAG(str) == JS_TAG_STRING &&
+                JS_VALUE_GET_STRING(str)->len != 0)
+                name = js_heap_snapshot_string(hs, JS_VALUE_GET_STRING(str), 256);
+        }
+        break;
+    case JS_GC_OBJ_TYPE_FUNCTION_BYTECODE:
+        {
+            JSFunctionBytecode *b = (JSFunctionBytecode *)gp;
+            type = JS_HEAP_NODE_CODE;
+            name = JS_HEAP_STR_ANONYMOUS;
+            if (b->func_name != JS_ATOM_NULL &&
+                b->func_name != JS_ATOM_empty_string)
+                name = js_heap_snapshot_atom(hs, b->func_name);
+            size = sizeof(*b) + b->byte_code_len +
+                sizeof(b->cpool[0]) * b->cpool_count +
+                sizeof(b->closure_var[0]) * b->closure_var_count;
+            if (b->vardefs)
+                size += sizeof(b->vardefs[0]) * (b->arg_count + b->var_count);
+            if (b->has_debug)
+                size += b->debug.pc2line_len;
+        }
+        break;
+    case JS_GC_OBJ_TYPE_SHAPE:
+        {
+            JSShape *sh = (JSShape *)gp;
+            type = JS_HEAP_NODE_OBJECT_SHAPE;
+            name = JS_HEAP_STR_SHAPE;
+            size = get_shape_size(sh->prop_hash_mask + 1, sh->prop_size);
+        }
+        break;
+    case JS_GC_OBJ_TYPE_VAR_REF:
+        type = JS_HEAP_NODE_HIDDEN;
+        name = JS_HEAP_STR_VAR_REF;
+        size = sizeof(JSVarRef);
+        break;
+    case JS_GC_OBJ_TYPE_ASYNC_FUNCTION:
+        type = JS_HEAP_NODE_HIDDEN;
+        name = JS_HEAP_STR_ASYNC_FUNCTION;
+        size = sizeof(JSAsyncFunctionData);
+        break;
+    case JS_GC_OBJ_TYPE_JS_CONTEXT:
+    default:
+        type = JS_HEAP_NODE_HIDDEN;
+        name = JS_HEAP_STR_REALM;
+        size = sizeof(JSContext);
+        break;
+    }
+    return js_heap_snapshot_new_node(hs, gp, type, name, size);
+}
+
+static void js_heap_snapshot_add_edge(JSHeapSnapshot *hs, int type,
+                                      uint32_t name_or_index, uint32_t to_node)
+{
+    JSHeapEdge *e;
+
+    if (hs->edge_count >= hs->edge_size) {
+        uint32_t new_size = max_int(hs->edge_size * 3 / 2, 256);
+        e = js_realloc_rt(hs->rt, hs->edges, sizeof(e[0]) * new_size);
+        if (!e) {
+            hs->error = TRUE;
+            return;
+        }
+        hs->edges = e;
+        hs->edge_size = new_size;
+    }
+    e = &hs->edges[hs->edge_count++];
+    e->type = type;
+    e->name_or_index = name_or_index;
+    e->to_node = to_node;
+    hs->nodes[hs->cur_node].edge_count++;
+}
+
+/* edge to a GC object or a string, nothing for the other values */
+static void js_heap_snapshot_add_value_edge(JSHeapSnapshot *hs, int type,
+                                            uint32_t name_or_index,
+                                            JSValueConst val)
+{
+    void *ptr;
+    uint32_t i;
+
+    switch(JS_VALUE_GET_TAG(val)) {
+    case JS_TAG_OBJECT:
+    case JS_TAG_FUNCTION_BYTECODE:
+    case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
+        break;
+    default:
+        return;
+    }
+    ptr = JS_VALUE_GET_PTR(val);
+    i = js_heap_snapshot_find(hs, ptr);
+    if (i == 0) {
+        /* the strings are added when they are found */
+        if (JS_VALUE_GET_TAG(val) == JS_TAG_STRING) {
+            JSString *p = ptr;
+            i = js_heap_snapshot_new_node(hs, ptr, JS_HEAP_NODE_STRING,
+                                          js_heap_snapshot_string(hs, p, 1024),
+                                          sizeof(*p) + (p->len << p->is_wide_char) +
+                                          1 - p->is_wide_char);
+        } else if (JS_VALUE_GET_TAG(val) == JS_TAG_STRING_ROPE) {
+            i = js_heap_snapshot_new_node(hs, ptr,
+                                          JS_HEAP_NODE_CONCATENATED_STRING,
+                                          JS_HEAP_STR_ROPE,
+                                          sizeof(JSStringRope));
+        }
+        if (i == 0)
+            return;
+    }
+    js_heap_snapshot_add_edge(hs, type, name_or_index, i);
+}
+
+static void js_heap_snapshot_add_atom_edge(JSHeapSnapshot *hs, JSAtom atom,
+                                           JSValueConst val)
+{
+    if (__JS_AtomIsTaggedInt(atom)) {
+        js_heap_snapshot_add_value_edge(hs, JS_HEAP_EDGE_ELEMENT,
+                                        __JS_AtomToUInt32(atom), val);
+    } else {
+        js_heap_snapshot_add_value_edge(hs, JS_HEAP_EDGE_PROPERTY,
+                                        js_heap_snapshot_atom(hs, atom), val);
+    }
+}
+
+static void js_heap_snapshot_count_ref(JSRuntime *rt, JSGCObjectHeader *gp)
+{
+    JSHeapSnapshot *hs = rt->heap_snapshot;
+    uint32_t i;
+
+    i = js_heap_snapshot_find(hs, gp);
+    if (i != 0)
+        hs->nodes[i].ref_count++;
+}
+
+static void js_heap_snapshot_mark(JSRuntime *rt, JSGCObjectHeader *gp)
+{
+    JSHeapSnapshot *hs = rt->heap_snapshot;
+
+    /* the tag does not matter provided it is a GC object */
+    js_heap_snapshot_add_value_edge(hs, hs->mark_edge_type, hs->mark_edge_name,
+                                    JS_MKPTR(JS_TAG_OBJECT, gp));
+}
+
+static void js_heap_snapshot_add_object_edges(JSHeapSnapshot *hs, JSObject *p)
+{
+    JSRuntime *rt = hs->rt;
+    JSShape *sh = p->shape;
+    JSShapeProperty *prs;
+    JSProperty *pr;
+    int i;
+
+    js_heap_snapshot_add_value_edge(hs, JS_HEAP_EDGE_INTERNAL, JS_HEAP_STR_MAP,
+                                    JS_MKPTR(JS_TAG_OBJECT, sh));
+    /* same fields as mark_children() */
+    for(i = 0, prs = get_shape_prop(sh); i < sh->prop_count; i++, prs++) {
+        pr = &p->prop[i];
+        if (prs->atom == JS_ATOM_NULL)
+            continue;
+        switch(prs->flags & JS_PROP_TMASK) {
+        case JS_PROP_NORMAL:
+            js_heap_snapshot_add_atom_edge(hs, prs->atom, pr->u.value);
+            break;
+        case JS_PROP_GETSET:
+            if (pr->u.getset.getter)
+                js_heap_snapshot_add_atom_edge(hs, prs->atom, JS_MKPTR(JS_TAG_OBJECT, pr->u.getset.getter));
+            if (pr->u.getset.setter)
+                js_heap_snapshot_add_atom_edge(hs, prs->atom, JS_MKPTR(JS_TAG_OBJECT, pr->u.getset.setter));
+            break;
+        case JS_PROP_VARREF:
+            if (pr->u.var_ref->is_detached)
+                js_heap_snapshot_add_atom_edge(hs, prs->atom, JS_MKPTR(JS_TAG_OBJECT, pr->u.var_ref));
+            break;
+        case JS_PROP_AUTOINIT:
+            hs->mark_edge_type = JS_HEAP_EDGE_INTERNAL;
+            hs->mark_edge_name = JS_HEAP_STR_INTERNAL;
+            js_autoinit_mark(rt, pr, js_heap_snapshot_mark);
+            break;
+        }
+    }
+
+    if ((p->class_id == JS_CLASS_ARRAY || p->class_id == JS_CLASS_ARGUMENTS) &&
+        p->fast_array) {
+        for(i = 0; i < p->u.array.count; i++) {
+            js_heap_snapshot_add_value_edge(hs, JS_HEAP_EDGE_ELEMENT, i,
+                                            p->u.array.u.values[i]);
+        }
+    } else if (js_class_has_bytecode(p->class_id)) {
+        /* same fields as js_bytecode_function_mark() with the names of
+           the closure variables */
+        JSFunctionBytecode *b = p->u.func.function_bytecode;
+        if (p->u.func.home_object) {
+            js_heap_snapshot_add_value_edge(hs, JS_HEAP_EDGE_INTERNAL,
+                                            JS_HEAP_STR_HOME_OBJECT,
+                                            JS_MKPTR(JS_TAG_OBJECT, p->u.func.home_object));
+        }
+        if (b) {
+            if (p->u.func.var_refs) {
+                for(i = 0; i < b->closure_var_count; i++) {
+                    JSVarRef *var_ref = p->u.func.var_refs[i];
+                    if (var_ref && var_ref->is_detached) {
+                        js_heap_snapshot_add_value_edge(hs, JS_HEAP_EDGE_CONTEXT,
+                                                        js_heap_snapshot_atom(hs, b->closure_var[i].var_name),
+                                                        JS_MKPTR(JS_TAG_OBJECT, var_ref));
+                    }
+                }
+            }
+            js_heap_snapshot_add_value_edge(hs, JS_HEAP_EDGE_INTERNAL,
+                                            JS_HEAP_STR_CODE,
+                                            JS_MKPTR(JS_TAG_FUNCTION_BYTECODE, b));
+        }
+    } else if (p->class_id != JS_CLASS_OBJECT) {
+        JSClassGCMark *gc_mark;
+        gc_mark = rt->class_array[p->class_id].gc_mark;
+        if (gc_mark) {
+            hs->mark_edge_type = JS_HEAP_EDGE_INTERNAL;
+            hs->mark_edge_name = JS_HEAP_STR_INTERNAL;
+            gc_mark(rt, JS_MKPTR(JS_TAG_OBJECT, p), js_heap_snapshot_mark);
+        }
+    }
+}
+
+static void js_heap_snapshot_add_edges(JSHeapSnapshot *hs, uint32_t node)
+{
+    JSHeapNode *n = &hs->nodes[node];
+    JSGCObjectHeader *gp;
+
+    hs->cur_node = node;
+    if (n->type == JS_HEAP_NODE_STRING)
+        return;
+    if (n->type == JS_HEAP_NODE_CONCATENATED_STRING) {
+        JSStringRope *r = n->ptr;
+        js_heap_snapshot_add_value_edge(hs, JS_HEAP_EDGE_INTERNAL,
+                                        JS_HEAP_STR_FIRST, r->left);
+        js_heap_snapshot_add_value_edge(hs, JS_HEAP_EDGE_INTERNAL,
+                                        JS_HEAP_STR_SECOND, r->right);
+        return;
+    }
+    gp = n->ptr;
+    switch(gp->gc_obj_type) {
+    case JS_GC_OBJ_TYPE_JS_OBJECT:
+        js_heap_snapshot_add_object_edges(hs, (JSObject *)gp);
+        break;
+    case JS_GC_OBJ_TYPE_VAR_REF:
+        js_heap_snapshot_add_value_edge(hs, JS_HEAP_EDGE_INTERNAL,
+                                        JS_HEAP_STR_VALUE,
+                                        *((JSVarRef *)gp)->pvalue);
+        break;
+    default:
+        hs->mark_edge_type = JS_HEAP_EDGE_INTERNAL;
+        hs->mark_edge_name = gp->gc_obj_type == JS_GC_OBJ_TYPE_SHAPE ?
+            JS_HEAP_STR_PROTO : JS_HEAP_STR_INTERNAL;
+        mark_children(hs->rt, gp, js_heap_snapshot_mark);
+        break;
+    }
+}
+
+static int js_heap_snapshot_write(JSHeapSnapshot *hs, FILE *f)
+{
+    static const int node_field_count = 6;
+    JSHeapNode *n;
+    JSHeapEdge *e;
+    uint32_t i;
+
+    fprintf(f, "{\"snapshot\":{\"meta\":{"
+            "\"node_fields\":[\"type\",\"name\",\"id\",\"self_size\","
+            "\"edge_count\",\"trace_node_id\"],"
+            "\"node_types\":[[\"hidden\",\"array\",\"string\",\"object\","
+            "\"code\",\"closure\",\"regexp\",\"number\",\"native\","
+            "\"synthetic\",\"concatenated string\",\"sliced string\","
+            "\"symbol\",\"bigint\",\"object shape\"],\"string\",\"number\","
+            "\"number\",\"number\",\"number\"],"
+            "\"edge_fields\":[\"type\",\"name_or_index\",\"to_node\"],"
+            "\"edge_types\":[[\"context\",\"element\",\"property\","
+            "\"internal\",\"hidden\",\"shortcut\",\"weak\"],"
+            "\"string_or_number\",\"node\"],"
+            "\"trace_function_info_fields\":[],\"trace_node_fields\":[],"
+            "\"sample_fields\":[],\"location_fields\":[]},"
+            "\"node_count\":%u,\"edge_count\":%u,\"trace_function_count\":0},\n"
+            "\"nodes\":[", hs->node_count, hs->edge_count);
+    for(i = 0; i < hs->node_count; i++) {
+        n = &hs->nodes[i];
+        /* the addresses are used as ids, odd as in V8 */
+        fprintf(f, "%s%u,%u,%" PRIu64 ",%u,%u,0\n", i ? "," : "",
+                n->type, n->name, (uint64_t)(uintptr_t)n->ptr | 1,
+                n->self_size, n->edge_count);
+    }
+    fprintf(f, "],\n\"edges\":[");
+    for(i = 0; i < hs->edge_count; i++) {
+        e = &hs->edges[i];
+        fprintf(f, "%s%u,%u,%u\n", i ? "," : "", e->type, e->name_or_index,
+                e->to_node * node_field_count);
+    }
+    fprintf(f, "],\n\"trace_function_infos\":[],\"trace_tree\":[],"
+            "\"samples\":[],\"locations\":[],\n\"strings\":[");
+    fwrite(hs->strings.buf, 1, hs->strings.size, f);
+    fprintf(f, "]}\n");
+    return ferror(f) ? -1 : 0;
+}
+
+int JS_WriteHeapSnapshot(JSRuntime *rt, FILE *f)
+{
+    JSHeapSnapshot hs_s, *hs = &hs_s;
+    struct list_head *el;
+    JSGCObjectHeader *gp;
+    uint32_t i, gc_node_count, root_count;
+    int ret;
+
+    memset(hs, 0, sizeof(*hs));
+    hs->rt = rt;
+    dbuf_init2(&hs->strings, rt, (DynBufReallocFunc *)js_realloc_rt);
+    hs->atom_strings = js_malloc_rt(rt, sizeof(hs->atom_strings[0]) *
+                                    max_int(rt->atom_size, 1));
+    if (!hs->atom_strings) {
+        hs->error = TRUE;
+        goto done;
+    }
+    memset(hs->atom_strings, 0xff, sizeof(hs->atom_strings[0]) * rt->atom_size);
+    for(i = 0; i < JS_HEAP_STR_COUNT; i++)
+        js_heap_snapshot_new_cstr(hs, js_heap_snapshot_names[i]);
+    js_heap_snapshot_new_node(hs, NULL, JS_HEAP_NODE_SYNTHETIC,
+                              JS_HEAP_STR_ROOT, 0);
+    gc_obj_for_each(el, rt) {
+        gp = list_entry(el, JSGCObjectHeader, link);
+        js_heap_snapshot_add_gc_object(hs, gp);
+    }
+    if (hs->error)
+        goto done;
+    gc_node_count = hs->node_count;
+
+    /* the references from the GC objects are counted as in gc_decref() */
+    rt->heap_snapshot = hs;
+    for(i = 1; i < gc_node_count; i++)
+        mark_children(rt, hs->nodes[i].ptr, js_heap_snapshot_count_ref);
+    root_count = 0;
+    for(i = 1; i < gc_node_count; i++) {
+        gp = hs->nodes[i].ptr;
+        if (gp->ref_count > hs->nodes[i].ref_count)
+            js_heap_snapshot_add_edge(hs, JS_HEAP_EDGE_ELEMENT, root_count++, i);
+    }
+    /* the strings are appended to the nodes as they are found */
+    for(i = 1; i < hs->node_count && !hs->error; i++)
+        js_heap_snapshot_add_edges(hs, i);
+    rt->heap_snapshot = NULL;
+ done:
+    if (hs->error || hs->strings.error)
+        ret = -1;
+    else
+        ret = js_heap_snapshot_write(hs, f);
+    dbuf_free(&hs->strings);
+    js_free_rt(rt, hs->atom_strings);
+    js_free_rt(rt, hs->node_hash);
+    js_free_rt(rt, hs->edges);
+    js_free_rt(rt, hs->nodes);
+    return ret;
 }
 
 JSValue JS_GetGlobalObject(JSContext *ctx)
@@ -6436,7 +8763,7 @@ static const char *get_func_name(JSContext *ctx, JSValueConst func)
     if ((prs->flags & JS_PROP_TMASK) != JS_PROP_NORMAL)
         return NULL;
     val = pr->u.value;
-    if (JS_VALUE_GET_TAG(val) != JS_TAG_STRING)
+    if (!JS_IsString(val))
         return NULL;
     return JS_ToCString(ctx, val);
 }
@@ -6748,10 +9075,877 @@ static JSValue JS_ThrowTypeErrorInvalidClass(JSContext *ctx, int class_id)
     return JS_ThrowTypeErrorAtom(ctx, "%s object expected", name);
 }
 
+/* line number of the last saved pc of a bytecode frame or -1 */
+static int js_frame_line_num(JSStackFrame *sf, JSFunctionBytecode *b)
+{
+    if (!b->has_debug)
+        return -1;
+    /* no pc2line info if the function is on a single line */
+    if (sf->cur_pc > b->byte_code_buf && b->debug.pc2line_buf)
+        return find_line_num(b->realm, b, sf->cur_pc - b->byte_code_buf - 1);
+    return b->debug.line_num;
+}
+
+/* Sampling profiler: when the interrupt counter expires, the stack
+   frames are recorded if 'interval_us' has elapsed since the last
+   sample. Each distinct stack is a path in a tree of nodes (one node
+   per function and line) whose leaf counts the samples. */
+
+/* interrupt counter while profiling, to check the time often enough */
+#define JS_PROFILER_COUNTER_INIT 100
+
+typedef struct JSProfileNode {
+    uint32_t parent;
+    uint32_t first_child; /* 0 if none */
+    uint32_t next_sibling; /* 0 if none */
+    const void *func; /* function bytecode or C function */
+    int line; /* line number of the pc or magic of the C function */
+    JSAtom name;
+    JSAtom filename;
+    uint32_t hit_count;
+} JSProfileNode;
+
+typedef struct JSProfiler {
+    BOOL running;
+    int64_t interval_us;
+    int64_t start_time;
+    int64_t last_time;
+    JSProfileNode *nodes; /* nodes[0] is the root */
+    uint32_t node_count;
+    uint32_t node_size;
+    uint32_t *samples; /* leaf node of each sample */
+    uint32_t *time_deltas; /* in us, since the previous sample */
+    uint32_t sample_count;
+    uint32_t sample_size;
+    JSStackFrame **frames; /* temporary */
+    uint32_t frame_size;
+} JSProfiler;
+
+static void js_free_profiler(JSRuntime *rt, JSProfiler *prof)
+{
+    JSProfileNode *n;
+    uint32_t i;
+
+    for(i = 1; i < prof->node_count; i++) {
+        n = &prof->nodes[i];
+        if (n->filename != JS_ATOM_NULL) {
+            /* reference to the function bytecode */
+            JS_FreeValueRT(rt, JS_MKPTR(JS_TAG_FUNCTION_BYTECODE,
+                                        (void *)n->func));
+            JS_FreeAtomRT(rt, n->filename);
+        }
+        JS_FreeAtomRT(rt, n->name);
+    }
+    js_free_rt(rt, prof->nodes);
+    js_free_rt(rt, prof->samples);
+    js_free_rt(rt, prof->time_deltas);
+    js_free_rt(rt, prof->frames);
+    js_free_rt(rt, prof);
+}
+
+/* return the child node of 'parent' for the frame 'sf' or 0 if
+   memory is missing */
+static uint32_t js_profiler_child(JSContext *ctx, JSProfiler *prof,
+                                  uint32_t parent, JSStackFrame *sf)
+{
+    JSRuntime *rt = ctx->rt;
+    JSObject *p;
+    JSFunctionBytecode *b = NULL;
+    const void *func;
+    int line;
+    uint32_t i;
+    JSProfileNode *n;
+
+    p = JS_VALUE_GET_OBJ(sf->cur_func);
+    if (js_class_has_bytecode(p->class_id)) {
+        b = p->u.func.function_bytecode;
+        func = b;
+        line = js_frame_line_num(sf, b);
+    } else if (p->class_id == JS_CLASS_C_FUNCTION) {
+        func = (const void *)p->u.cfunc.c_function.generic;
+        line = p->u.cfunc.magic;
+    } else {
+        func = NULL;
+        line = p->class_id;
+    }
+    for(i = prof->nodes[parent].first_child; i != 0;
+        i = prof->nodes[i].next_sibling) {
+        n = &prof->nodes[i];
+        if (n->func == func && n->line == line)
+            return i;
+    }
+
+    if (prof->node_count >= prof->node_size) {
+        uint32_t new_size = max_int(prof->node_size * 3 / 2, 64);
+        n = js_realloc_rt(rt, prof->nodes, sizeof(n[0]) * new_size);
+        if (!n)
+            return 0;
+        prof->nodes = n;
+        prof->node_size = new_size;
+    }
+    i = prof->node_count++;
+    n = &prof->nodes[i];
+    n->parent = parent;
+    n->first_child = 0;
+    n->next_sibling = prof->nodes[parent].first_child;
+    prof->nodes[parent].first_child = i;
+    n->func = func;
+    n->line = line;
+    n->hit_count = 0;
+    n->name = JS_ATOM_NULL;
+    n->filename = JS_ATOM_NULL;
+    if (b) {
+        /* the bytecode is kept so that its address is not reused */
+        JS_DupValueRT(rt, JS_MKPTR(JS_TAG_FUNCTION_BYTECODE, b));
+        n->name = JS_DupAtomRT(rt, b->func_name);
+        n->filename = JS_DupAtomRT(rt, b->has_debug ? b->debug.filename :
+                                   JS_ATOM_empty_string);
+    } else {
+        /* same rule as the backtraces: only a 'name' string */
+        JSProperty *pr;
+        JSShapeProperty *prs;
+        prs = find_own_property(&pr, p, JS_ATOM_name);
+        if (prs && (prs->flags & JS_PROP_TMASK) == JS_PROP_NORMAL &&
+            JS_VALUE_GET_TAG(pr->u.value) == JS_TAG_STRING) {
+            n->name = JS_NewAtomStr(ctx, JS_VALUE_GET_STRING(
+                                        JS_DupValue(ctx, pr->u.value)));
+        }
+    }
+    return i;
+}
+
+static void js_profiler_sample(JSContext *ctx, JSProfiler *prof, int64_t now)
+{
+    JSRuntime *rt = ctx->rt;
+    JSStackFrame *sf;
+    uint32_t depth, node, i;
+
+    depth = 0;
+    for(sf = rt->current_stack_frame; sf != NULL; sf = sf->prev_frame) {
+        if (depth >= prof->frame_size) {
+            uint32_t new_size = max_int(prof->frame_size * 2, 32);
+            JSStackFrame **frames;
+            frames = js_realloc_rt(rt, prof->frames,
+                                   sizeof(frames[0]) * new_size);
+            if (!frames)
+                return;
+            prof->frames = frames;
+            prof->frame_size = new_size;
+        }
+        prof->frames[depth++] = sf;
+    }
+    if (prof->sample_count >= prof->sample_size) {
+        uint32_t new_size = max_int(prof->sample_size * 3 / 2, 256);
+        uint32_t *samples, *time_deltas;
+        samples = js_realloc_rt(rt, prof->samples,
+                                sizeof(samples[0]) * new_size);
+        if (!samples)
+            return;
+        prof->samples = samples;
+        time_deltas = js_realloc_rt(rt, prof->time_deltas,
+                                    sizeof(time_deltas[0]) * new_size);
+        if (!time_deltas)
+            return;
+        prof->time_deltas = time_deltas;
+        prof->sample_size = new_size;
+    }
+
+    /* from the outermost frame */
+    node = 0;
+    for(i = depth; i-- > 0;) {
+        sf = prof->frames[i];
+        if (JS_VALUE_GET_TAG(sf->cur_func) != JS_TAG_OBJECT)
+            continue;
+        node = js_profiler_child(ctx, prof, node, sf);
+        if (node == 0)
+            return;
+    }
+    prof->nodes[node].hit_count++;
+    prof->samples[prof->sample_count] = node;
+    prof->time_deltas[prof->sample_count] = now - prof->last_time;
+    prof->sample_count++;
+    prof->last_time = now;
+}
+
+int JS_StartProfiler(JSRuntime *rt, int interval_us)
+{
+    JSProfiler *prof;
+
+    if (rt->profiler)
+        js_free_profiler(rt, rt->profiler);
+    prof = js_mallocz_rt(rt, sizeof(*prof));
+    rt->profiler = prof;
+    if (!prof)
+        return -1;
+    prof->nodes = js_malloc_rt(rt, sizeof(prof->nodes[0]));
+    if (!prof->nodes) {
+        js_free_profiler(rt, prof);
+        rt->profiler = NULL;
+        return -1;
+    }
+    memset(&prof->nodes[0], 0, sizeof(prof->nodes[0]));
+    prof->node_count = 1;
+    prof->node_size = 1;
+    prof->interval_us = max_int(interval_us, 1);
+    prof->start_time = gc_get_time_us();
+    prof->last_time = prof->start_time;
+    prof->running = TRUE;
+    return 0;
+}
+
+void JS_StopProfiler(JSRuntime *rt)
+{
+    if (rt->profiler && rt->profiler->running) {
+        rt->profiler->running = FALSE;
+        rt->profiler->last_time = gc_get_time_us();
+    }
+}
+
+typedef struct {
+    DynBuf dbuf;
+    JSProfileWriteFunc *write_func;
+    void *opaque;
+    int ret;
+} JSProfileWriter;
+
+static void js_profile_flush(JSProfileWriter *w, size_t threshold)
+{
+    if (w->dbuf.size >= threshold && w->dbuf.size > 0) {
+        if (w->dbuf.error) {
+            w->ret = -1;
+        } else if (w->ret == 0 &&
+                   w->write_func(w->opaque, w->dbuf.buf, w->dbuf.size) < 0) {
+            w->ret = -1;
+        }
+        w->dbuf.size = 0;
+    }
+}
+
+/* frame name as 'func (file:line)', without the characters used by
+   the output format */
+static void js_profile_put_name(JSRuntime *rt, DynBuf *dbuf,
+                                JSProfileNode *n, BOOL json)
+{
+    char buf[256];
+    const char *s;
+
+    if (n->name != JS_ATOM_NULL && n->name != JS_ATOM_empty_string)
+        s = JS_AtomGetStrRT(rt, buf, sizeof(buf), n->name);
+    else if (n->filename != JS_ATOM_NULL)
+        s = "(anonymous)";
+    else
+        s = "(native)";
+    for(; *s; s++) {
+        if (json ? (*s == '"' || *s == '\\' || (uint8_t)*s < 0x20) :
+            (*s == ';' || *s == '\n'))
+            dbuf_putc(dbuf, '_');
+        else
+            dbuf_putc(dbuf, *s);
+    }
+    if (!json && n->filename != JS_ATOM_NULL) {
+        dbuf_printf(dbuf, " (%s:%d)",
+                    JS_AtomGetStrRT(rt, buf, sizeof(buf), n->filename),
+                    n->line);
+    }
+}
+
+static void js_profile_put_path(JSRuntime *rt, DynBuf *dbuf,
+                                JSProfiler *prof, uint32_t node)
+{
+    if (prof->nodes[node].parent != 0) {
+        js_profile_put_path(rt, dbuf, prof, prof->nodes[node].parent);
+        dbuf_putc(dbuf, ';');
+    }
+    js_profile_put_name(rt, dbuf, &prof->nodes[node], FALSE);
+}
+
+int JS_WriteProfile(JSRuntime *rt, int format,
+                    JSProfileWriteFunc *write_func, void *opaque)
+{
+    JSProfiler *prof = rt->profiler;
+    JSProfileWriter w_s, *w = &w_s;
+    JSProfileNode *n;
+    char buf[256];
+    uint32_t i, j;
+    int64_t end_time;
+
+    if (!prof)
+        return -1;
+    dbuf_init2(&w->dbuf, rt, (DynBufReallocFunc *)js_realloc_rt);
+    w->write_func = write_func;
+    w->opaque = opaque;
+    w->ret = 0;
+    if (format == JS_PROFILE_FOLDED) {
+        /* one line per stack: 'outer;...;inner count' */
+        for(i = 1; i < prof->node_count; i++) {
+            if (prof->nodes[i].hit_count == 0)
+                continue;
+            js_profile_put_path(rt, &w->dbuf, prof, i);
+            dbuf_printf(&w->dbuf, " %u\n", prof->nodes[i].hit_count);
+            js_profile_flush(w, 4096);
+        }
+    } else {
+        /* Chrome DevTools .cpuprofile (node ids are the indexes + 1) */
+        dbuf_putstr(&w->dbuf, "{\"nodes\":[");
+        for(i = 0; i < prof->node_count; i++) {
+            n = &prof->nodes[i];
+            dbuf_printf(&w->dbuf, "%s{\"id\":%u,\"callFrame\":"
+                        "{\"functionName\":\"", i ? "," : "", i + 1);
+            if (i == 0)
+                dbuf_putstr(&w->dbuf, "(root)");
+            else
+                js_profile_put_name(rt, &w->dbuf, n, TRUE);
+            dbuf_printf(&w->dbuf, "\",\"scriptId\":\"%u\",\"url\":\"",
+                        n->filename);
+            if (n->filename != JS_ATOM_NULL) {
+                const char *s;
+                for(s = JS_AtomGetStrRT(rt, buf, sizeof(buf), n->filename);
+                    *s; s++) {
+                    if (*s == '"' || *s == '\\')
+                        dbuf_putc(&w->dbuf, '\\');
+                    if ((uint8_t)*s >= 0x20)
+                        dbuf_putc(&w->dbuf, *s);
+                }
+            }
+            dbuf_printf(&w->dbuf, "\",\"lineNumber\":%d,\"columnNumber\":-1},"
+                        "\"hitCount\":%u",
+                        n->filename != JS_ATOM_NULL && n->line > 0 ?
+                        n->line - 1 : -1, n->hit_count);
+            if (n->first_child) {
+                dbuf_putstr(&w->dbuf, ",\"children\":[");
+                for(j = n->first_child; j != 0; j = prof->nodes[j].next_sibling) {
+                    dbuf_printf(&w->dbuf, "%u%s", j + 1,
+                                prof->nodes[j].next_sibling ? "," : "");
+                }
+                dbuf_putc(&w->dbuf, ']');
+            }
+            dbuf_putc(&w->dbuf, '}');
+            js_profile_flush(w, 4096);
+        }
+        end_time = prof->running ? gc_get_time_us() : prof->last_time;
+        dbuf_printf(&w->dbuf, "],\"startTime\":%" PRId64 ",\"endTime\":%" PRId64
+                    ",\"samples\":[", prof->start_time, end_time);
+        for(i = 0; i < prof->sample_count; i++) {
+            dbuf_printf(&w->dbuf, "%s%u", i ? "," : "", prof->samples[i] + 1);
+            js_profile_flush(w, 4096);
+        }
+        dbuf_putstr(&w->dbuf, "],\"timeDeltas\":[");
+        for(i = 0; i < prof->sample_count; i++) {
+            dbuf_printf(&w->dbuf, "%s%u", i ? "," : "", prof->time_deltas[i]);
+            js_profile_flush(w, 4096);
+        }
+        dbuf_putstr(&w->dbuf, "]}\n");
+    }
+    js_profile_flush(w, 0);
+    dbuf_free(&w->dbuf);
+    return w->ret;
+}
+
+/* Allocation profiler: an allocation is sampled each time
+   'sample_bytes' bytes have been allocated and the sample stands for
+   all the bytes allocated since the previous one. It is attributed to
+   its site (innermost JS function and line, plus the native function
+   called from it) and kept until the block is freed, so that the live
+   memory of each site is known. A reallocation counts as a free
+   followed by a new allocation. */
+
+typedef struct JSAllocSite {
+    JSFunctionBytecode *b; /* innermost JS function or NULL */
+    JSObject *cfunc; /* function called from it or NULL */
+    int line;
+    uint32_t hash_next; /* index + 1 of the next site, 0 if none */
+    int64_t live_bytes;
+    int64_t live_count;
+    int64_t total_bytes;
+    int64_t total_count;
+} JSAllocSite;
+
+typedef struct JSAllocSample {
+    const void *ptr; /* NULL if the slot is free */
+    uint32_t site;
+    int64_t bytes; /* estimated number of bytes */
+    int64_t count; /* estimated number of allocations */
+} JSAllocSample;
+
+typedef struct JSAllocSnapshot {
+    uint32_t site_count;
+    int64_t *live; /* live bytes and count of each site */
+} JSAllocSnapshot;
+
+typedef struct JSAllocProfiler {
+    BOOL running;
+    BOOL lost_samples; /* not enough memory for some samples */
+    int64_t sample_bytes;
+    int64_t bytes_until_sample;
+    JSAllocSite *sites;
+    uint32_t site_count;
+    uint32_t site_size;
+    uint32_t *site_hash; /* index + 1 of the first site, 0 if none */
+    uint32_t site_hash_size; /* power of two */
+    JSAllocSample *samples; /* open addressing, at most half full */
+    uint32_t sample_count;
+    uint32_t sample_hash_size; /* power of two, 0 if not allocated */
+    JSAllocSnapshot *snapshots;
+    int snapshot_count;
+} JSAllocProfiler;
+
+/* the memory of the profiler is not profiled */
+static void *js_alloc_profiler_realloc(void *opaque, void *ptr, size_t size)
+{
+    JSRuntime *rt = opaque;
+    return rt->mf.js_realloc(&rt->malloc_state, ptr, size);
+}
+
+static inline uint32_t js_alloc_profiler_hash(uint64_t h, uint32_t hash_size)
+{
+    return (uint32_t)((h * 0x9e3779b97f4a7c15) >> 32) & (hash_size - 1);
+}
+
+static void js_free_alloc_profiler(JSRuntime *rt, JSAllocProfiler *ap)
+{
+    uint32_t i;
+    int j;
+
+    for(i = 0; i < ap->site_count; i++) {
+        JSAllocSite *site = &ap->sites[i];
+        if (site->b)
+            JS_FreeValueRT(rt, JS_MKPTR(JS_TAG_FUNCTION_BYTECODE, site->b));
+        if (site->cfunc)
+            JS_FreeValueRT(rt, JS_MKPTR(JS_TAG_OBJECT, site->cfunc));
+    }
+    for(j = 0; j < ap->snapshot_count; j++)
+        js_alloc_profiler_realloc(rt, ap->snapshots[j].live, 0);
+    js_alloc_profiler_realloc(rt, ap->snapshots, 0);
+    js_alloc_profiler_realloc(rt, ap->samples, 0);
+    js_alloc_profiler_realloc(rt, ap->site_hash, 0);
+    js_alloc_profiler_realloc(rt, ap->sites, 0);
+    js_alloc_profiler_realloc(rt, ap, 0);
+}
+
+static JSAllocSample *js_alloc_profiler_find(JSAllocProfiler *ap,
+                                             const void *ptr)
+{
+    JSAllocSample *s;
+    uint32_t i;
+
+    if (ap->sample_hash_size == 0)
+        return NULL;
+    for(i = js_alloc_profiler_hash((uintptr_t)ptr, ap->sample_hash_size);;
+        i = (i + 1) & (ap->sample_hash_size - 1)) {
+        s = &ap->samples[i];
+        if (s->ptr == ptr)
+            return s;
+        if (!s->ptr)
+            return NULL;
+    }
+}
+
+static void js_alloc_profiler_remove(JSAllocProfiler *ap, JSAllocSample *s)
+{
+    JSAllocSite *site = &ap->sites[s->site];
+    uint32_t mask, i, j, k;
+
+    site->live_bytes -= s->bytes;
+    site->live_count -= s->count;
+    ap->sample_count--;
+    /* move back the following entries which can fill the hole */
+    mask = ap->sample_hash_size - 1;
+    i = s - ap->samples;
+    for(j = (i + 1) & mask; ap->samples[j].ptr; j = (j + 1) & mask) {
+        k = js_alloc_profiler_hash((uintptr_t)ap->samples[j].ptr,
+                                   ap->sample_hash_size);
+        if (i <= j ? (k <= i || k > j) : (k <= i && k > j)) {
+            ap->samples[i] = ap->samples[j];
+            i = j;
+        }
+    }
+    ap->samples[i].ptr = NULL;
+}
+
+static int js_alloc_profiler_resize_samples(JSRuntime *rt,
+                                            JSAllocProfiler *ap)
+{
+    JSAllocSample *samples, *s;
+    uint32_t new_size, i, j;
+
+    new_size = max_int(ap->sample_hash_size * 2, 256);
+    samples = js_alloc_profiler_realloc(rt, NULL,
+                                        sizeof(samples[0]) * new_size);
+    if (!samples)
+        return -1;
+    memset(samples, 0, sizeof(samples[0]) * new_size);
+    for(i = 0; i < ap->sample_hash_size; i++) {
+        s = &ap->samples[i];
+        if (!s->ptr)
+            continue;
+        for(j = js_alloc_profiler_hash((uintptr_t)s->ptr, new_size);
+            samples[j].ptr; j = (j + 1) & (new_size - 1))
+            continue;
+        samples[j] = *s;
+    }
+    js_alloc_profiler_realloc(rt, ap->samples, 0);
+    ap->samples = samples;
+    ap->sample_hash_size = new_size;
+    return 0;
+}
+
+/* return the index of the site of the current allocation or -1 if
+   memory is missing. The objects are not accessed because they may be
+   in the middle of a modification. */
+static int js_alloc_profiler_site(JSRuntime *rt, JSAllocProfiler *ap)
+{
+    JSStackFrame *sf;
+    JSObject *p, *cfunc = NULL;
+    JSFunctionBytecode *b = NULL;
+    JSAllocSite *site;
+    int line = -1;
+    uint32_t h, i;
+
+    for(sf = rt->current_stack_frame; sf != NULL; sf = sf->prev_frame) {
+        if (JS_VALUE_GET_TAG(sf->cur_func) != JS_TAG_OBJECT)
+            continue;
+        p = JS_VALUE_GET_OBJ(sf->cur_func);
+        if (js_class_has_bytecode(p->class_id)) {
+            b = p->u.func.function_bytecode;
+            line = js_frame_line_num(sf, b);
+            break;
+        }
+        if (!cfunc)
+            cfunc = p;
+    }
+    h = js_alloc_profiler_hash(((uintptr_t)b * 31 + (uintptr_t)cfunc) * 31 +
+                               line, ap->site_hash_size);
+    for(i = ap->site_hash[h]; i != 0; i = site->hash_next) {
+        site = &ap->sites[i - 1];
+        if (site->b == b && site->cfunc == cfunc && site->line == line)
+            return i - 1;
+    }
+
+    if (ap->site_count >= ap->site_size) {
+        uint32_t new_size = ap->site_size * 3 / 2;
+        site = js_alloc_profiler_realloc(rt, ap->sites,
+                                         sizeof(site[0]) * new_size);
+        if (!site)
+            return -1;
+        ap->sites = site;
+        ap->site_size = new_size;
+    }
+    if (ap->site_count >= ap->site_hash_size) {
+        uint32_t new_size = ap->site_hash_size * 2, *site_hash;
+        site_hash = js_alloc_profiler_realloc(rt, NULL,
+                                              sizeof(site_hash[0]) * new_size);
+        if (!site_hash)
+            return -1;
+        memset(site_hash, 0, sizeof(site_hash[0]) * new_size);
+        for(i = 0; i < ap->site_count; i++) {
+            site = &ap->sites[i];
+            h = js_alloc_profiler_hash(((uintptr_t)site->b * 31 +
+                                        (uintptr_t)site->cfunc) * 31 +
+                                       site->line, new_size);
+            site->hash_next = site_hash[h];
+            site_hash[h] = i + 1;
+        }
+        js_alloc_profiler_realloc(rt, ap->site_hash, 0);
+        ap->site_hash = site_hash;
+        ap->site_hash_size = new_size;
+        h = js_alloc_profiler_hash(((uintptr_t)b * 31 + (uintptr_t)cfunc) * 31 +
+                                   line, ap->site_hash_size);
+    }
+    i = ap->site_count++;
+    site = &ap->sites[i];
+    memset(site, 0, sizeof(*site));
+    /* the references keep the addresses from being reused */
+    site->b = b;
+    if (b)
+        JS_DupValueRT(rt, JS_MKPTR(JS_TAG_FUNCTION_BYTECODE, b));
+    site->cfunc = cfunc;
+    if (cfunc)
+        JS_DupValueRT(rt, JS_MKPTR(JS_TAG_OBJECT, cfunc));
+    site->line = line;
+    site->hash_next = ap->site_hash[h];
+    ap->site_hash[h] = i + 1;
+    return i;
+}
+
+/* called when 'old_ptr' (if not NULL) is freed and when 'new_ptr' (if
+   not NULL) of 'size' bytes is allocated */
+static void js_alloc_profiler_update(JSRuntime *rt, void *old_ptr,
+                                     void *new_ptr, size_t size)
+{
+    JSAllocProfiler *ap = rt->alloc_profiler;
+    JSAllocSample *s;
+    JSAllocSite *site;
+    int64_t n;
+    int site_index;
+    uint32_t i;
+
+    if (old_ptr) {
+        s = js_alloc_profiler_find(ap, old_ptr);
+        if (s)
+            js_alloc_profiler_remove(ap, s);
+    }
+    if (!new_ptr || !ap->running)
+        return;
+    ap->bytes_until_sample -= size;
+    if (likely(ap->bytes_until_sample > 0))
+        return;
+    n = -ap->bytes_until_sample / ap->sample_bytes + 1;
+    ap->bytes_until_sample += n * ap->sample_bytes;
+
+    if (2 * (ap->sample_count + 1) > ap->sample_hash_size &&
+        js_alloc_profiler_resize_samples(rt, ap)) {
+        ap->lost_samples = TRUE;
+        return;
+    }
+    site_index = js_alloc_profiler_site(rt, ap);
+    if (site_index < 0) {
+        ap->lost_samples = TRUE;
+        return;
+    }
+    for(i = js_alloc_profiler_hash((uintptr_t)new_ptr, ap->sample_hash_size);
+        ap->samples[i].ptr; i = (i + 1) & (ap->sample_hash_size - 1))
+        continue;
+    s = &ap->samples[i];
+    s->ptr = new_ptr;
+    s->site = site_index;
+    s->bytes = n * ap->sample_bytes;
+    s->count = s->bytes > size ? s->bytes / size : 1;
+    ap->sample_count++;
+    site = &ap->sites[site_index];
+    site->live_bytes += s->bytes;
+    site->live_count += s->count;
+    site->total_bytes += s->bytes;
+    site->total_count += s->count;
+}
+
+int JS_StartAllocationProfiler(JSRuntime *rt, size_t sample_bytes)
+{
+    JSAllocProfiler *ap;
+
+    if (rt->alloc_profiler) {
+        ap = rt->alloc_profiler;
+        rt->alloc_profiler = NULL;
+        js_free_alloc_profiler(rt, ap);
+    }
+    ap = js_alloc_profiler_realloc(rt, NULL, sizeof(*ap));
+    if (!ap)
+        return -1;
+    memset(ap, 0, sizeof(*ap));
+    ap->site_size = 64;
+    ap->sites = js_alloc_profiler_realloc(rt, NULL, sizeof(ap->sites[0]) *
+                                          ap->site_size);
+    ap->site_hash_size = 64;
+    ap->site_hash = js_alloc_profiler_realloc(rt, NULL,
+                                              sizeof(ap->site_hash[0]) *
+                                              ap->site_hash_size);
+    if (!ap->sites || !ap->site_hash) {
+        js_free_alloc_profiler(rt, ap);
+        return -1;
+    }
+    memset(ap->site_hash, 0, sizeof(ap->site_hash[0]) * ap->site_hash_size);
+    ap->sample_bytes = sample_bytes ? sample_bytes : 1;
+    ap->bytes_until_sample = ap->sample_bytes;
+    ap->running = TRUE;
+    rt->alloc_profiler = ap;
+    return 0;
+}
+
+void JS_StopAllocationProfiler(JSRuntime *rt)
+{
+    if (rt->alloc_profiler)
+        rt->alloc_profiler->running = FALSE;
+}
+
+void JS_FreeAllocationProfiler(JSRuntime *rt)
+{
+    JSAllocProfiler *ap = rt->alloc_profiler;
+
+    if (ap) {
+        /* releasing the references may free memory */
+        rt->alloc_profiler = NULL;
+        js_free_alloc_profiler(rt, ap);
+    }
+}
+
+/* return the snapshot index or -1 */
+int JS_TakeAllocationSnapshot(JSRuntime *rt)
+{
+    JSAllocProfiler *ap = rt->alloc_profiler;
+    JSAllocSnapshot *snapshots, *snap;
+    uint32_t i;
+
+    if (!ap)
+        return -1;
+    snapshots = js_alloc_profiler_realloc(rt, ap->snapshots,
+                                          sizeof(snapshots[0]) *
+                                          (ap->snapshot_count + 1));
+    if (!snapshots)
+        return -1;
+    ap->snapshots = snapshots;
+    snap = &snapshots[ap->snapshot_count];
+    snap->live = js_alloc_profiler_realloc(rt, NULL, sizeof(snap->live[0]) *
+                                           2 * (ap->site_count + 1));
+    if (!snap->live)
+        return -1;
+    snap->site_count = ap->site_count;
+    for(i = 0; i < ap->site_count; i++) {
+        snap->live[2 * i] = ap->sites[i].live_bytes;
+        snap->live[2 * i + 1] = ap->sites[i].live_count;
+    }
+    return ap->snapshot_count++;
+}
+
+typedef struct {
+    uint32_t site;
+    int64_t bytes;
+    int64_t count;
+} JSAllocProfileEntry;
+
+static int js_alloc_profile_entry_cmp(const void *a, const void *b,
+                                      void *opaque)
+{
+    const JSAllocProfileEntry *e1 = a, *e2 = b;
+
+    if (e1->bytes != e2->bytes)
+        return e1->bytes < e2->bytes ? 1 : -1;
+    if (e1->count != e2->count)
+        return e1->count < e2->count ? 1 : -1;
+    return (e1->site > e2->site) - (e1->site < e2->site);
+}
+
+/* live bytes and count of a site in a snapshot, -1 for the current
+   state and -2 for nothing */
+static void js_alloc_profile_get(JSAllocProfiler *ap, int snapshot,
+                                 uint32_t site, int64_t *pbytes,
+                                 int64_t *pcount)
+{
+    JSAllocSnapshot *snap;
+
+    *pbytes = 0;
+    *pcount = 0;
+    if (snapshot == -1) {
+        *pbytes = ap->sites[site].live_bytes;
+        *pcount = ap->sites[site].live_count;
+    } else if (snapshot >= 0) {
+        snap = &ap->snapshots[snapshot];
+        if (site < snap->site_count) {
+            *pbytes = snap->live[2 * site];
+            *pcount = snap->live[2 * site + 1];
+        }
+    }
+}
+
+/* site as 'func (file:line);cfunc', without the characters used by the
+   output format */
+static void js_alloc_profile_put_site(JSRuntime *rt, DynBuf *dbuf,
+                                      JSAllocSite *site)
+{
+    char buf[256];
+    JSProfileNode n;
+
+    if (site->b) {
+        memset(&n, 0, sizeof(n));
+        n.name = site->b->func_name;
+        n.filename = site->b->has_debug ? site->b->debug.filename :
+            JS_ATOM_empty_string;
+        n.line = site->line;
+        js_profile_put_name(rt, dbuf, &n, FALSE);
+    } else {
+        dbuf_putstr(dbuf, "(runtime)");
+    }
+    if (site->cfunc) {
+        /* same rule as the backtraces: only a 'name' string */
+        JSProperty *pr;
+        JSShapeProperty *prs;
+        const char *s = "(native)";
+        prs = find_own_property(&pr, site->cfunc, JS_ATOM_name);
+        if (prs && (prs->flags & JS_PROP_TMASK) == JS_PROP_NORMAL &&
+            JS_VALUE_GET_TAG(pr->u.value) == JS_TAG_STRING) {
+            JSString *str = JS_VALUE_GET_STRING(pr->u.value);
+            if (str->atom_type != 0 && str->len != 0) {
+                s = JS_AtomGetStrRT(rt, buf, sizeof(buf),
+                                    js_get_atom_index(rt, str));
+            }
+        }
+        dbuf_putc(dbuf, ';');
+        for(; *s; s++)
+            dbuf_putc(dbuf, *s == ';' || *s == '\n' ? '_' : *s);
+    }
+}
+
+int JS_WriteAllocationProfile(JSRuntime *rt, int from_snapshot,
+                              int to_snapshot,
+                              JSProfileWriteFunc *write_func, void *opaque)
+{
+    JSAllocProfiler *ap = rt->alloc_profiler;
+    JSProfileWriter w_s, *w = &w_s;
+    JSAllocProfileEntry *entries, *e;
+    uint32_t i, entry_count;
+    int64_t bytes, count, total_bytes, total_count;
+
+    if (!ap || from_snapshot < -1 || from_snapshot >= ap->snapshot_count ||
+        to_snapshot < -1 || to_snapshot >= ap->snapshot_count)
+        return -1;
+    entries = js_alloc_profiler_realloc(rt, NULL, sizeof(entries[0]) *
+                                        (ap->site_count + 1));
+    if (!entries)
+        return -1;
+    entry_count = 0;
+    total_bytes = 0;
+    total_count = 0;
+    for(i = 0; i < ap->site_count; i++) {
+        e = &entries[entry_count];
+        js_alloc_profile_get(ap, to_snapshot, i, &e->bytes, &e->count);
+        js_alloc_profile_get(ap, from_snapshot == -1 ? -2 : from_snapshot,
+                             i, &bytes, &count);
+        e->bytes -= bytes;
+        e->count -= count;
+        if (e->bytes == 0 && e->count == 0)
+            continue;
+        e->site = i;
+        total_bytes += e->bytes;
+        total_count += e->count;
+        entry_count++;
+    }
+    rqsort(entries, entry_count, sizeof(entries[0]),
+           js_alloc_profile_entry_cmp, NULL);
+
+    dbuf_init2(&w->dbuf, rt, js_alloc_profiler_realloc);
+    w->write_func = write_func;
+    w->opaque = opaque;
+    w->ret = 0;
+    dbuf_printf(&w->dbuf, "# %s memory, sampled every %" PRId64 " bytes%s\n",
+                from_snapshot == -1 ? "live" : "change of the live",
+                ap->sample_bytes,
+                ap->lost_samples ? " (some samples were lost)" : "");
+    dbuf_printf(&w->dbuf, "%12s %10s  %s\n", "BYTES", "COUNT", "SITE");
+    for(i = 0; i < entry_count; i++) {
+        e = &entries[i];
+        dbuf_printf(&w->dbuf, "%12" PRId64 " %10" PRId64 "  ",
+                    e->bytes, e->count);
+        js_alloc_profile_put_site(rt, &w->dbuf, &ap->sites[e->site]);
+        dbuf_putc(&w->dbuf, '\n');
+        js_profile_flush(w, 4096);
+    }
+    dbuf_printf(&w->dbuf, "%12" PRId64 " %10" PRId64 "  %s\n",
+                total_bytes, total_count, "(total)");
+    js_profile_flush(w, 0);
+    dbuf_free(&w->dbuf);
+    js_alloc_profiler_realloc(rt, entries, 0);
+    return w->ret;
+}
+
 static no_inline __exception int __js_poll_interrupts(JSContext *ctx)
 {
     JSRuntime *rt = ctx->rt;
     ctx->interrupt_counter = JS_INTERRUPT_COUNTER_INIT;
+    if (unlikely(rt->profiler && rt->profiler->running)) {
+        JSProfiler *prof = rt->profiler;
+        int64_t now = gc_get_time_us();
+        if (now - prof->last_time >= prof->interval_us)
+            js_profiler_sample(ctx, prof, now);
+        ctx->interrupt_counter = JS_PROFILER_COUNTER_INIT;
+    }
     if (rt->interrupt_handler) {
         if (rt->interrupt_handler(rt, rt->interrupt_opaque)) {
             /* XXX: should set a specific flag to avoid catching */
@@ -6772,6 +9966,19 @@ static inline __exception int js_poll_interrupts(JSContext *ctx)
     }
 }
 
+/* also save the PC of the current bytecode frame for the profiler */
+static inline __exception int js_poll_interrupts_pc(JSContext *ctx,
+                                                    JSStackFrame *sf,
+                                                    const uint8_t *pc)
+{
+    if (unlikely(--ctx->interrupt_counter <= 0)) {
+        sf->cur_pc = pc;
+        return __js_poll_interrupts(ctx);
+    } else {
+        return 0;
+    }
+}
+
 /* return -1 (exception) or TRUE/FALSE */
 static int JS_SetPrototypeInternal(JSContext *ctx, JSValueConst obj,
                                    JSValueConst proto_val,
@@ -6831,11 +10038,16 @@ static int JS_SetPrototypeInternal(JSContext *ctx, JSValueConst obj,
             /* Note: for Proxy objects, proto is NULL */
             p1 = p1->shape->proto;
         } while (p1 != NULL);
+        if (js_mark_prototype(ctx, proto))
+            return -1;
         JS_DupValue(ctx, proto_val);
     }
 
-    if (js_shape_prepare_update(ctx, p, NULL))
+    if (js_shape_prepare_update(ctx, p, NULL)) {
+        if (proto)
+            JS_FreeValue(ctx, JS_MKPTR(JS_TAG_OBJECT, proto));
         return -1;
+    }
     sh = p->shape;
     if (sh->proto)
         JS_FreeValue(ctx, JS_MKPTR(JS_TAG_OBJECT, sh->proto));
@@ -6872,6 +10084,7 @@ static JSValueConst JS_GetPrototypePrimitive(JSContext *ctx, JSValueConst val)
         val = ctx->class_proto[JS_CLASS_BOOLEAN];
         break;
     case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
         val = ctx->class_proto[JS_CLASS_STRING];
         break;
     case JS_TAG_SYMBOL:
@@ -7085,6 +10298,21 @@ JSValue JS_GetPropertyInternal(JSContext *ctx, JSValueConst obj,
                 }
             }
             break;
+        case JS_TAG_STRING_ROPE:
+            {
+                JSStringRope *r = JS_VALUE_GET_PTR(obj);
+                if (__JS_AtomIsTaggedInt(prop)) {
+                    uint32_t idx;
+                    idx = __JS_AtomToUInt32(prop);
+                    if (idx < r->len) {
+                        return js_new_string_char(ctx,
+                                                  js_string_value_get(obj, idx));
+                    }
+                } else if (prop == JS_ATOM_length) {
+                    return JS_NewInt32(ctx, r->len);
+                }
+            }
+            break;
         default:
             break;
         }
@@ -8946,6 +12174,8 @@ static int js_shape_prepare_update(JSContext *ctx, JSObject *p,
             sh->is_hashed = FALSE;
         }
     }
+    /* the caller modifies the shape */
+    js_shape_update_ic_id(ctx->rt, sh);
     return 0;
 }
 
@@ -9883,6 +13113,10 @@ static int JS_ToBoolFree(JSContext *ctx, JSValue val)
         return JS_VALUE_GET_INT(val);
     case JS_TAG_EXCEPTION:
         return -1;
+    case JS_TAG_STRING_ROPE:
+        /* ropes are never empty */
+        JS_FreeValue(ctx, val);
+        return TRUE;
     case JS_TAG_STRING:
         {
             BOOL ret = JS_VALUE_GET_STRING(val)->len != 0;
@@ -9967,13 +13201,371 @@ static inline int to_digit(int c)
         return 36;
 }
 
+/* 64 bit floating point numbers with a 64 bit significand, used by
+   the conversions between doubles and decimal strings */
+
+typedef struct {
+    uint64_t f;
+    int e; /* value = f * 2^e */
+} JSDiyFp;
+
+/* 10^k rounded to 64 bits for k = -348, -340, ..., 340 */
+static const struct {
+    uint64_t f;
+    int16_t e;
+    int16_t k;
+} js_cached_powers[] = {
+    { 0xfa8fd5a0081c0288ULL, -1220, -348 },
+    { 0xbaaee17fa23ebf76ULL, -1193, -340 },
+    { 0x8b16fb203055ac76ULL, -1166, -332 },
+    { 0xcf42894a5dce35eaULL, -1140, -324 },
+    { 0x9a6bb0aa55653b2dULL, -1113, -316 },
+    { 0xe61acf033d1a45dfULL, -1087, -308 },
+    { 0xab70fe17c79ac6caULL, -1060, -300 },
+    { 0xff77b1fcbebcdc4fULL, -1034, -292 },
+    { 0xbe5691ef416bd60cULL, -1007, -284 },
+    { 0x8dd01fad907ffc3cULL, -980, -276 },
+    { 0xd3515c2831559a83ULL, -954, -268 },
+    { 0x9d71ac8fada6c9b5ULL, -927, -260 },
+    { 0xea9c227723ee8bcbULL, -901, -252 },
+    { 0xaecc49914078536dULL, -874, -244 },
+    { 0x823c12795db6ce57ULL, -847, -236 },
+    { 0xc21094364dfb5637ULL, -821, -228 },
+    { 0x9096ea6f3848984fULL, -794, -220 },
+    { 0xd77485cb25823ac7ULL, -768, -212 },
+    { 0xa086cfcd97bf97f4ULL, -741, -204 },
+    { 0xef340a98172aace5ULL, -715, -196 },
+    { 0xb23867fb2a35b28eULL, -688, -188 },
+    { 0x84c8d4dfd2c63f3bULL, -661, -180 },
+    { 0xc5dd44271ad3cdbaULL, -635, -172 },
+    { 0x936b9fcebb25c996ULL, -608, -164 },
+    { 0xdbac6c247d62a584ULL, -582, -156 },
+    { 0xa3ab66580d5fdaf6ULL, -555, -148 },
+    { 0xf3e2f893dec3f126ULL, -529, -140 },
+    { 0xb5b5ada8aaff80b8ULL, -502, -132 },
+    { 0x87625f056c7c4a8bULL, -475, -124 },
+    { 0xc9bcff6034c13053ULL, -449, -116 },
+    { 0x964e858c91ba2655ULL, -422, -108 },
+    { 0xdff9772470297ebdULL, -396, -100 },
+    { 0xa6dfbd9fb8e5b88fULL, -369, -92 },
+    { 0xf8a95fcf88747d94ULL, -343, -84 },
+    { 0xb94470938fa89bcfULL, -316, -76 },
+    { 0x8a08f0f8bf0f156bULL, -289, -68 },
+    { 0xcdb02555653131b6ULL, -263, -60 },
+    { 0x993fe2c6d07b7facULL, -236, -52 },
+    { 0xe45c10c42a2b3b06ULL, -210, -44 },
+    { 0xaa242499697392d3ULL, -183, -36 },
+    { 0xfd87b5f28300ca0eULL, -157, -28 },
+    { 0xbce5086492111aebULL, -130, -20 },
+    { 0x8cbccc096f5088ccULL, -103, -12 },
+    { 0xd1b71758e219652cULL, -77, -4 },
+    { 0x9c40000000000000ULL, -50, 4 },
+    { 0xe8d4a51000000000ULL, -24, 12 },
+    { 0xad78ebc5ac620000ULL, 3, 20 },
+    { 0x813f3978f8940984ULL, 30, 28 },
+    { 0xc097ce7bc90715b3ULL, 56, 36 },
+    { 0x8f7e32ce7bea5c70ULL, 83, 44 },
+    { 0xd5d238a4abe98068ULL, 109, 52 },
+    { 0x9f4f2726179a2245ULL, 136, 60 },
+    { 0xed63a231d4c4fb27ULL, 162, 68 },
+    { 0xb0de65388cc8ada8ULL, 189, 76 },
+    { 0x83c7088e1aab65dbULL, 216, 84 },
+    { 0xc45d1df942711d9aULL, 242, 92 },
+    { 0x924d692ca61be758ULL, 269, 100 },
+    { 0xda01ee641a708deaULL, 295, 108 },
+    { 0xa26da3999aef774aULL, 322, 116 },
+    { 0xf209787bb47d6b85ULL, 348, 124 },
+    { 0xb454e4a179dd1877ULL, 375, 132 },
+    { 0x865b86925b9bc5c2ULL, 402, 140 },
+    { 0xc83553c5c8965d3dULL, 428, 148 },
+    { 0x952ab45cfa97a0b3ULL, 455, 156 },
+    { 0xde469fbd99a05fe3ULL, 481, 164 },
+    { 0xa59bc234db398c25ULL, 508, 172 },
+    { 0xf6c69a72a3989f5cULL, 534, 180 },
+    { 0xb7dcbf5354e9beceULL, 561, 188 },
+    { 0x88fcf317f22241e2ULL, 588, 196 },
+    { 0xcc20ce9bd35c78a5ULL, 614, 204 },
+    { 0x98165af37b2153dfULL, 641, 212 },
+    { 0xe2a0b5dc971f303aULL, 667, 220 },
+    { 0xa8d9d1535ce3b396ULL, 694, 228 },
+    { 0xfb9b7cd9a4a7443cULL, 720, 236 },
+    { 0xbb764c4ca7a44410ULL, 747, 244 },
+    { 0x8bab8eefb6409c1aULL, 774, 252 },
+    { 0xd01fef10a657842cULL, 800, 260 },
+    { 0x9b10a4e5e9913129ULL, 827, 268 },
+    { 0xe7109bfba19c0c9dULL, 853, 276 },
+    { 0xac2820d9623bf429ULL, 880, 284 },
+    { 0x80444b5e7aa7cf85ULL, 907, 292 },
+    { 0xbf21e44003acdd2dULL, 933, 300 },
+    { 0x8e679c2f5e44ff8fULL, 960, 308 },
+    { 0xd433179d9c8cb841ULL, 986, 316 },
+    { 0x9e19db92b4e31ba9ULL, 1013, 324 },
+    { 0xeb96bf6ebadf77d9ULL, 1039, 332 },
+    { 0xaf87023b9bf0ee6bULL, 1066, 340 },
+};
+
+/* d = f * 2^e with f < 2^53 if d is finite (the sign is ignored) */
+static int js_float64_split(double d, uint64_t *pf)
+{
+    JSFloat64Union u;
+    uint64_t f;
+    int e;
+
+    u.d = d;
+    e = (u.u64 >> 52) & 0x7ff;
+    f = u.u64 & (((uint64_t)1 << 52) - 1);
+    if (e == 0) {
+        e = 1 - 1075;
+    } else {
+        f |= (uint64_t)1 << 52;
+        e -= 1075;
+    }
+    *pf = f;
+    return e;
+}
+
+static JSDiyFp js_diy_fp_mul(JSDiyFp x, JSDiyFp y)
+{
+    uint64_t a, b, c, d, ac, bc, ad, bd, tmp;
+    JSDiyFp r;
+
+    a = x.f >> 32;
+    b = x.f & 0xffffffff;
+    c = y.f >> 32;
+    d = y.f & 0xffffffff;
+    ac = a * c;
+    bc = b * c;
+    ad = a * d;
+    bd = b * d;
+    /* rounded result */
+    tmp = (bd >> 32) + (ad & 0xffffffff) + (bc & 0xffffffff) +
+        ((uint64_t)1 << 31);
+    r.f = ac + (ad >> 32) + (bc >> 32) + (tmp >> 32);
+    r.e = x.e + y.e + 64;
+    return r;
+}
+
+static JSDiyFp js_diy_fp_normalize(JSDiyFp x)
+{
+    int n = clz64(x.f);
+    x.f <<= n;
+    x.e -= n;
+    return x;
+}
+
+/* exact powers of ten */
+static const double js_pow10_exact[23] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+/* 10^1 to 10^7 */
+static const JSDiyFp js_pow10_adjust[7] = {
+    { 0xa000000000000000ULL, -60 },
+    { 0xc800000000000000ULL, -57 },
+    { 0xfa00000000000000ULL, -54 },
+    { 0x9c40000000000000ULL, -50 },
+    { 0xc350000000000000ULL, -47 },
+    { 0xf424000000000000ULL, -44 },
+    { 0x9896800000000000ULL, -40 },
+};
+
+/* return f * 2^e with f <= 2^53. The low bits must be zero if the
+   result is denormal. */
+static double js_float64_join(uint64_t f, int e)
+{
+    JSFloat64Union u;
+    uint64_t biased_e;
+
+    while (f >= (uint64_t)1 << 53) {
+        f >>= 1;
+        e++;
+    }
+    if (e > 2046 - 1075)
+        return INFINITY;
+    if (f == 0 || e < 1 - 1075)
+        return 0;
+    while (e > 1 - 1075 && !(f & ((uint64_t)1 << 52))) {
+        f <<= 1;
+        e--;
+    }
+    if (f & ((uint64_t)1 << 52))
+        biased_e = e + 1075;
+    else
+        biased_e = 0; /* denormal */
+    u.u64 = (f & (((uint64_t)1 << 52) - 1)) | (biased_e << 52);
+    return u.d;
+}
+
+/* Correctly rounded conversion of a decimal number (optional '-',
+   digits with an optional '.' and an optional exponent). The first
+   19 significant digits are multiplied by a cached power of ten with
+   64 bit integers while keeping track of the error, as in the
+   double-conversion library of F. Loitsch. strtod() is only used
+   when the result is too close to the middle of two doubles. */
+static double js_atod(const char *str)
+{
+    const char *p;
+    char digits[20];
+    uint64_t w, bits, half;
+    JSDiyFp x, c;
+    int n_digits, n_zeros, n_frac, n, e10, exp, error, shift, prec, i;
+    int order, size;
+    BOOL is_neg, exp_neg, truncated;
+    double d;
+
+    p = str;
+    is_neg = (*p == '-');
+    p += is_neg;
+    /* keep the 20 first significant digits */
+    n_digits = 0;
+    n_zeros = 0; /* trailing zeros */
+    n_frac = 0;
+    for(;;) {
+        if (*p == '.') {
+            n_frac = -1;
+        } else if (is_digit(*p)) {
+            if (n_frac < 0)
+                n_frac--;
+            if (*p == '0') {
+                n_zeros += (n_digits != 0);
+            } else {
+                /* n_digits counts the significant digits up to the
+                   last non zero one */
+                n = n_digits + n_zeros;
+                for(i = n_digits; i < min_int(n, 20); i++)
+                    digits[i] = '0';
+                if (n < 20)
+                    digits[n] = *p;
+                n_digits = n + 1;
+                n_zeros = 0;
+            }
+        } else {
+            break;
+        }
+        p++;
+    }
+    if (n_frac < 0)
+        n_frac = -n_frac - 1;
+    exp = 0;
+    if (*p == 'e' || *p == 'E') {
+        p++;
+        exp_neg = (*p == '-');
+        p += (*p == '-' || *p == '+');
+        while (is_digit(*p)) {
+            if (exp < 100000)
+                exp = exp * 10 + (*p - '0');
+            p++;
+        }
+        if (exp_neg)
+            exp = -exp;
+    }
+    /* value = 0.digits * 10^(n_digits + e10) */
+    e10 = exp + n_zeros - n_frac;
+    if (n_digits == 0 || n_digits + e10 <= -324) {
+        d = 0;
+        goto done;
+    }
+    if (n_digits + e10 > 309) {
+        d = INFINITY;
+        goto done;
+    }
+    n = min_int(n_digits, 19);
+    w = 0;
+    for(i = 0; i < n; i++)
+        w = w * 10 + (digits[i] - '0');
+    truncated = (n_digits > n);
+    if (truncated && digits[n] >= '5')
+        w++;
+    e10 += n_digits - n;
+
+#if FLT_EVAL_METHOD == 0
+    /* w and 10^|e10| are exact doubles: a single rounding */
+    if (!truncated && n <= 15) {
+        if (e10 >= -22 && e10 < 0) {
+            d = (double)w / js_pow10_exact[-e10];
+            goto done;
+        }
+        if (e10 >= 0 && e10 <= 22 + 15 - n) {
+            d = (double)w;
+            if (e10 > 22) {
+                /* still exact */
+                d *= js_pow10_exact[e10 - 22];
+                e10 = 22;
+            }
+            d *= js_pow10_exact[e10];
+            goto done;
+        }
+    }
+#endif
+
+    /* the error is counted in 1/8 of the least significant bit */
+    error = truncated ? 4 : 0;
+    x.f = w;
+    x.e = 0;
+    shift = clz64(x.f);
+    x.f <<= shift;
+    x.e -= shift;
+    error <<= shift;
+    i = (e10 + 348) / 8;
+    n = e10 - js_cached_powers[i].k;
+    if (n != 0) {
+        x = js_diy_fp_mul(x, js_pow10_adjust[n - 1]);
+        /* w * 10^n may not fit in 64 bits */
+        if (19 - n_digits < n)
+            error += 4;
+    }
+    c.f = js_cached_powers[i].f;
+    c.e = js_cached_powers[i].e;
+    x = js_diy_fp_mul(x, c);
+    /* the rounding of the multiplication and the error of the cached
+       power */
+    error += 8 + (error != 0);
+    shift = clz64(x.f);
+    x.f <<= shift;
+    x.e -= shift;
+    error <<= shift;
+
+    /* number of bits of the double significand */
+    order = 64 + x.e;
+    if (order >= 1 - 1075 + 53)
+        size = 53;
+    else if (order <= 1 - 1075)
+        size = 0;
+    else
+        size = order - (1 - 1075);
+    prec = 64 - size;
+    if (prec + 3 >= 64) {
+        /* keep room for the 1/8 units */
+        shift = prec + 3 - 64 + 1;
+        x.f >>= shift;
+        x.e += shift;
+        error = (error >> shift) + 1 + 8;
+        prec -= shift;
+    }
+    bits = (x.f & (((uint64_t)1 << prec) - 1)) * 8;
+    half = ((uint64_t)1 << (prec - 1)) * 8;
+    if (half - error < bits && bits < half + error) {
+        /* too close to the middle of two doubles */
+        return strtod(str, NULL);
+    }
+    w = x.f >> prec;
+    if (bits >= half + error)
+        w++;
+    d = js_float64_join(w, x.e + prec);
+ done:
+    return is_neg ? -d : d;
+}
+
 /* XXX: remove */
 static double js_strtod(const char *p, int radix, BOOL is_float)
 {
     double d;
     int c;
     
-    if (!is_float || radix != 10) {
+    if (radix == 10) {
+        d = js_atod(p);
+    } else {
         uint64_t n_max, n;
         int int_exp, is_neg;
         
@@ -9987,10 +13579,7 @@ static double js_strtod(const char *p, int radix, BOOL is_float)
         while (*p == '0')
             p++;
         n = 0;
-        if (radix == 10)
-            n_max = ((uint64_t)-1 - 9) / 10; /* most common case */
-        else
-            n_max = ((uint64_t)-1 - (radix - 1)) / radix;
+        n_max = ((uint64_t)-1 - (radix - 1)) / radix;
         /* XXX: could be more precise */
         int_exp = 0;
         while (*p != '\0') {
@@ -10010,8 +13599,6 @@ static double js_strtod(const char *p, int radix, BOOL is_float)
         }
         if (is_neg)
             d = -d;
-    } else {
-        d = strtod(p, NULL);
     }
     return d;
 }
@@ -10410,6 +13997,7 @@ static JSValue JS_ToNumberHintFree(JSContext *ctx, JSValue val,
             return JS_EXCEPTION;
         goto redo;
     case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
         {
             const char *str;
             const char *p;
@@ -11253,6 +14841,277 @@ static char *i64toa(char *buf_end, int64_t n, unsigned int base)
     return q;
 }
 
+/* Grisu3 (F. Loitsch, "Printing Floating-Point Numbers Quickly and
+   Accurately with Integers", 2010): the shortest or the n_digits
+   correctly rounded decimal digits of a double are computed with 64
+   bit integers. It fails (about 0.5% of the cases) when the result
+   cannot be proved correct, and the caller then uses printf(). */
+
+/* return a cached power of ten 10^-mk such that the binary exponent
+   of w * 10^-mk is between -60 and -32 */
+static JSDiyFp js_cached_power(int w_e, int *mk)
+{
+    JSDiyFp p;
+    int k, i;
+
+    /* k = ceil((-60 - (w_e + 64) + 63) * log10(2)) */
+    k = (int)ceil((-61 - w_e) * 0.30102999566398114);
+    i = (348 + k - 1) / 8 + 1;
+    p.f = js_cached_powers[i].f;
+    p.e = js_cached_powers[i].e;
+    *mk = js_cached_powers[i].k;
+    return p;
+}
+
+/* number of digits of n > 0 and corresponding power of ten */
+static int js_biggest_power10(uint32_t n, uint32_t *ppow10)
+{
+    uint32_t pow10;
+    int k;
+
+    k = 1;
+    pow10 = 1;
+    while (k < 10 && n >= pow10 * 10) {
+        pow10 *= 10;
+        k++;
+    }
+    *ppow10 = pow10;
+    return k;
+}
+
+/* move the last digit of buf towards w while it is closer to it and
+   stays in the interval. Return FALSE if the result is not proved to
+   be the closest shortest one. */
+static BOOL js_grisu_round_weed(char *buf, int len, uint64_t dist_high_w,
+                                uint64_t unsafe_interval, uint64_t rest,
+                                uint64_t ten_kappa, uint64_t unit)
+{
+    uint64_t small_dist = dist_high_w - unit;
+    uint64_t big_dist = dist_high_w + unit;
+
+    while (rest < small_dist &&
+           unsafe_interval - rest >= ten_kappa &&
+           (rest + ten_kappa < small_dist ||
+            small_dist - rest >= rest + ten_kappa - small_dist)) {
+        buf[len - 1]--;
+        rest += ten_kappa;
+    }
+    if (rest < big_dist &&
+        unsafe_interval - rest >= ten_kappa &&
+        (rest + ten_kappa < big_dist ||
+         big_dist - rest > rest + ten_kappa - big_dist))
+        return FALSE;
+    return 2 * unit <= rest && rest <= unsafe_interval - 4 * unit;
+}
+
+/* round the counted digits of buf according to rest. Return FALSE if
+   the error 'unit' prevents deciding. */
+static BOOL js_grisu_round_weed_counted(char *buf, int len, uint64_t rest,
+                                        uint64_t ten_kappa, uint64_t unit,
+                                        int *kappa)
+{
+    int i;
+
+    if (unit >= ten_kappa || ten_kappa - unit <= unit)
+        return FALSE;
+    if (ten_kappa - rest > rest && ten_kappa - 2 * rest >= 2 * unit)
+        return TRUE;
+    if (rest > unit && ten_kappa - (rest - unit) <= rest - unit) {
+        /* round up */
+        buf[len - 1]++;
+        for(i = len - 1; i > 0 && buf[i] == '0' + 10; i--) {
+            buf[i] = '0';
+            buf[i - 1]++;
+        }
+        if (buf[0] == '0' + 10) {
+            buf[0] = '1';
+            (*kappa)++;
+        }
+        return TRUE;
+    }
+    return FALSE;
+}
+
+/* d > 0. If n_digits = 0, compute the shortest digits which convert
+   back to d, otherwise n_digits correctly rounded digits. Return the
+   number of digits or 0 if it fails. */
+static int js_grisu3(double d, int n_digits, char *buf, int *decpt)
+{
+    JSDiyFp w, m_plus, m_minus, ten_mk, one;
+    uint64_t f, frac, rest, unit, unsafe_interval, dist_high_w, too_low;
+    uint64_t too_high;
+    uint32_t integrals, pow10;
+    int e, mk, kappa, len;
+    BOOL ok;
+
+    e = js_float64_split(d, &f);
+    w.f = f;
+    w.e = e;
+    w = js_diy_fp_normalize(w);
+    ten_mk = js_cached_power(w.e, &mk);
+    one.e = w.e + ten_mk.e + 64; /* exponent of the scaled values */
+    one.f = (uint64_t)1 << -one.e;
+    len = 0;
+
+    if (n_digits == 0) {
+        /* boundaries of the rounding interval of d */
+        m_plus.f = (f << 1) + 1;
+        m_plus.e = e - 1;
+        m_plus = js_diy_fp_normalize(m_plus);
+        if (f == ((uint64_t)1 << 52) && e != 1 - 1075) {
+            /* the lower boundary is closer */
+            m_minus.f = (f << 2) - 1;
+            m_minus.e = e - 2;
+        } else {
+            m_minus.f = (f << 1) - 1;
+            m_minus.e = e - 1;
+        }
+        m_minus.f <<= m_minus.e - m_plus.e;
+        m_minus.e = m_plus.e;
+
+        w = js_diy_fp_mul(w, ten_mk);
+        m_plus = js_diy_fp_mul(m_plus, ten_mk);
+        m_minus = js_diy_fp_mul(m_minus, ten_mk);
+        /* the scaled values have an error of 1 unit */
+        unit = 1;
+        too_low = m_minus.f - unit;
+        too_high = m_plus.f + unit;
+        unsafe_interval = too_high - too_low;
+        dist_high_w = too_high - w.f;
+        integrals = too_high >> -one.e;
+        frac = too_high & (one.f - 1);
+        kappa = js_biggest_power10(integrals, &pow10);
+        while (kappa > 0) {
+            buf[len++] = '0' + integrals / pow10;
+            integrals %= pow10;
+            kappa--;
+            rest = ((uint64_t)integrals << -one.e) + frac;
+            if (rest < unsafe_interval) {
+                ok = js_grisu_round_weed(buf, len, dist_high_w,
+                                         unsafe_interval, rest,
+                                         (uint64_t)pow10 << -one.e, unit);
+                goto done;
+            }
+            pow10 /= 10;
+        }
+        for(;;) {
+            frac *= 10;
+            unit *= 10;
+            unsafe_interval *= 10;
+            buf[len++] = '0' + (frac >> -one.e);
+            frac &= one.f - 1;
+            kappa--;
+            if (frac < unsafe_interval) {
+                ok = js_grisu_round_weed(buf, len, dist_high_w * unit,
+                                         unsafe_interval, frac, one.f, unit);
+                goto done;
+            }
+        }
+    } else {
+        w = js_diy_fp_mul(w, ten_mk);
+        unit = 1;
+        integrals = w.f >> -one.e;
+        frac = w.f & (one.f - 1);
+        kappa = js_biggest_power10(integrals, &pow10);
+        while (kappa > 0) {
+            buf[len++] = '0' + integrals / pow10;
+            integrals %= pow10;
+            kappa--;
+            if (len == n_digits) {
+                rest = ((uint64_t)integrals << -one.e) + frac;
+                ok = js_grisu_round_weed_counted(buf, len, rest,
+                                                 (uint64_t)pow10 << -one.e,
+                                                 unit, &kappa);
+                goto done;
+            }
+            pow10 /= 10;
+        }
+        while (len < n_digits && frac > unit) {
+            frac *= 10;
+            unit *= 10;
+            buf[len++] = '0' + (frac >> -one.e);
+            frac &= one.f - 1;
+            kappa--;
+        }
+        if (len < n_digits)
+            return 0;
+        ok = js_grisu_round_weed_counted(buf, len, frac, one.f, unit, &kappa);
+    }
+ done:
+    if (!ok)
+        return 0;
+    /* d = buf * 10^(kappa - mk) */
+    *decpt = len + kappa - mk;
+    return len;
+}
+
+/* toFixed() with 0 <= n_digits <= 100: the fractional part of d is
+   exactly converted with 32 bit limbs. Return FALSE if |d| >= 2^63. */
+static BOOL js_fcvt_exact(char *buf, double d, int n_digits)
+{
+    uint32_t limbs[(1074 + 31) / 32];
+    char digits[101 + 1], int_buf[24];
+    uint64_t f, int_part, v;
+    int e, i, j, n_limbs, shift;
+
+    if (n_digits < 0 || n_digits > 100)
+        return FALSE;
+    if (d < 0)
+        *buf++ = '-';
+    e = js_float64_split(d, &f);
+    if (e >= 0) {
+        if (e > 10)
+            return FALSE;
+        int_part = f << e;
+        n_limbs = 0;
+    } else {
+        if (-e < 64) {
+            int_part = f >> -e;
+            f &= ((uint64_t)1 << -e) - 1;
+        } else {
+            int_part = 0;
+        }
+        /* the limbs contain f * 2^shift = frac(d) * 2^(32 * n_limbs) */
+        n_limbs = (-e + 31) / 32;
+        shift = n_limbs * 32 + e;
+        memset(limbs, 0, sizeof(limbs[0]) * n_limbs);
+        v = (f & 0xffffffff) << shift;
+        limbs[0] = (uint32_t)v;
+        v = ((f >> 32) << shift) + (v >> 32);
+        if (n_limbs > 1)
+            limbs[1] = (uint32_t)v;
+        if (n_limbs > 2)
+            limbs[2] = (uint32_t)(v >> 32);
+    }
+    /* n_digits + 1 fractional digits */
+    for(i = 0; i <= n_digits; i++) {
+        v = 0;
+        for(j = 0; j < n_limbs; j++) {
+            v += (uint64_t)limbs[j] * 10;
+            limbs[j] = (uint32_t)v;
+            v >>= 32;
+        }
+        digits[i] = '0' + v;
+    }
+    /* round to nearest with ties away from zero */
+    if (digits[n_digits] >= '5') {
+        for(i = n_digits - 1; i >= 0 && digits[i] == '9'; i--)
+            digits[i] = '0';
+        if (i >= 0)
+            digits[i]++;
+        else
+            int_part++;
+    }
+    strcpy(buf, i64toa(int_buf + sizeof(int_buf), int_part, 10));
+    if (n_digits > 0) {
+        buf += strlen(buf);
+        *buf++ = '.';
+        memcpy(buf, digits, n_digits);
+        buf[n_digits] = '\0';
+    }
+    return TRUE;
+}
+
 /* buf1 contains the printf result */
 static void js_ecvt1(double d, int n_digits, int *decpt, int *sign, char *buf,
                      int rounding_mode, char *buf1, int buf1_size)
@@ -11283,6 +15142,18 @@ static int js_ecvt(double d, int n_digits, int *decpt, int *sign, char *buf,
     int rounding_mode;
     char buf_tmp[JS_DTOA_BUF_SIZE];
 
+    if (d != 0 && isfinite(d)) {
+        int k;
+        k = js_grisu3(fabs(d), is_fixed ? n_digits : 0, buf, decpt);
+        if (k > 0) {
+            *sign = (d < 0);
+            /* no need to keep the trailing zeros */
+            while (!is_fixed && k >= 2 && buf[k - 1] == '0')
+                k--;
+            buf[k] = '\0';
+            return k;
+        }
+    }
     if (!is_fixed) {
         unsigned int n_digits_min, n_digits_max;
         /* find the minimum amount of digits (XXX: inefficient but simple) */
@@ -11353,6 +15224,8 @@ static int js_fcvt1(char *buf, int buf_size, double d, int n_digits,
 static void js_fcvt(char *buf, int buf_size, double d, int n_digits)
 {
     int rounding_mode;
+    if (js_fcvt_exact(buf, d, n_digits))
+        return;
     rounding_mode = FE_TONEAREST;
 #ifdef CONFIG_PRINTF_RNDN
     {
@@ -11503,6 +15376,8 @@ JSValue JS_ToStringInternal(JSContext *ctx, JSValueConst val, BOOL is_ToProperty
     switch(tag) {
     case JS_TAG_STRING:
         return JS_DupValue(ctx, val);
+    case JS_TAG_STRING_ROPE:
+        return js_linearize_rope(ctx, val);
     case JS_TAG_INT:
         snprintf(buf, sizeof(buf), "%d", JS_VALUE_GET_INT(val));
         str = buf;
@@ -11587,71 +15462,102 @@ static JSValue JS_ToStringCheckObject(JSContext *ctx, JSValueConst val)
     return JS_ToString(ctx, val);
 }
 
+#define JSON_ONES  0x0101010101010101ULL
+#define JSON_HIGHS 0x8080808080808080ULL
+
+/* JSON escape of the characters < 0x60: 0 if none, 'u' for \u00XX */
+static const uint8_t json_escape_table[0x60] = {
+    'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u',
+    'b', 't', 'n', 'u', 'f', 'r', 'u', 'u',
+    'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u',
+    'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u',
+    0, 0, '\"', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, '\\', 0, 0, 0,
+};
+
+/* return the position of the first character of str[i..len) which
+   must be escaped in JSON or 'len'. The string is scanned 8 bytes
+   at a time. */
+static int json_find_escape8(const uint8_t *str, int i, int len)
+{
+    uint64_t v, q, bs;
+
+    while (i + 8 <= len) {
+        memcpy(&v, str + i, 8);
+        q = v ^ (JSON_ONES * '"');
+        bs = v ^ (JSON_ONES * '\\');
+        if ((((q - JSON_ONES) & ~q) | ((bs - JSON_ONES) & ~bs) |
+             ((v - JSON_ONES * 0x20) & ~v)) & JSON_HIGHS)
+            break;
+        i += 8;
+    }
+    while (i < len && (str[i] >= 0x60 || !json_escape_table[str[i]]))
+        i++;
+    return i;
+}
+
+/* append the JSON quoted form of 'p'. The runs of characters which
+   need no escape are copied at once. */
+static int string_buffer_put_quoted(StringBuffer *b, const JSString *p)
+{
+    int i, j, c, c1, len;
+    char buf[8];
+
+    len = p->len;
+    if (b->len + len + 2 > b->size) {
+        if (string_buffer_realloc(b, b->len + len + 2, 0))
+            return -1;
+    }
+    string_buffer_putc8(b, '\"');
+    for(i = 0;; i = j) {
+        if (p->is_wide_char) {
+            for(j = i; j < len; j++) {
+                c = p->u.str16[j];
+                if (c < 0x60 ? json_escape_table[c] :
+                    (c >= 0xd800 && c < 0xe000))
+                    break;
+            }
+            string_buffer_write16(b, p->u.str16 + i, j - i);
+        } else {
+            j = json_find_escape8(p->u.str8, i, len);
+            string_buffer_write8(b, p->u.str8 + i, j - i);
+        }
+        if (j >= len)
+            break;
+        c = string_get(p, j++);
+        if (c < 0x60 && json_escape_table[c] != 'u') {
+            string_buffer_putc8(b, '\\');
+            string_buffer_putc8(b, json_escape_table[c]);
+        } else if (c >= 0xd800 && c < 0xdc00 && j < len &&
+                   (c1 = p->u.str16[j]) >= 0xdc00 && c1 < 0xe000) {
+            /* surrogate pair */
+            string_buffer_putc16(b, c);
+            string_buffer_putc16(b, c1);
+            j++;
+        } else {
+            snprintf(buf, sizeof(buf), "\\u%04x", c);
+            string_buffer_write8(b, (const uint8_t *)buf, 6);
+        }
+    }
+    return string_buffer_putc8(b, '\"');
+}
+
 static JSValue JS_ToQuotedString(JSContext *ctx, JSValueConst val1)
 {
     JSValue val;
     JSString *p;
-    int i;
-    uint32_t c;
     StringBuffer b_s, *b = &b_s;
-    char buf[16];
 
     val = JS_ToStringCheckObject(ctx, val1);
     if (JS_IsException(val))
         return val;
     p = JS_VALUE_GET_STRING(val);
-
-    if (string_buffer_init(ctx, b, p->len + 2))
-        goto fail;
-
-    if (string_buffer_putc8(b, '\"'))
-        goto fail;
-    for(i = 0; i < p->len; ) {
-        c = string_getc(p, &i);
-        switch(c) {
-        case '\t':
-            c = 't';
-            goto quote;
-        case '\r':
-            c = 'r';
-            goto quote;
-        case '\n':
-            c = 'n';
-            goto quote;
-        case '\b':
-            c = 'b';
-            goto quote;
-        case '\f':
-            c = 'f';
-            goto quote;
-        case '\"':
-        case '\\':
-        quote:
-            if (string_buffer_putc8(b, '\\'))
-                goto fail;
-            if (string_buffer_putc8(b, c))
-                goto fail;
-            break;
-        default:
-            if (c < 32 || (c >= 0xd800 && c < 0xe000)) {
-                snprintf(buf, sizeof(buf), "\\u%04x", c);
-                if (string_buffer_puts8(b, buf))
-                    goto fail;
-            } else {
-                if (string_buffer_putc(b, c))
-                    goto fail;
-            }
-            break;
-        }
-    }
-    if (string_buffer_putc8(b, '\"'))
-        goto fail;
+    string_buffer_init(ctx, b, p->len + 2);
+    string_buffer_put_quoted(b, p);
     JS_FreeValue(ctx, val);
     return string_buffer_end(b);
- fail:
-    JS_FreeValue(ctx, val);
-    string_buffer_free(b);
-    return JS_EXCEPTION;
 }
 
 static __maybe_unused void JS_DumpObjectHeader(JSRuntime *rt)
@@ -11871,6 +15777,12 @@ static __maybe_unused void JS_DumpValueShort(JSRuntime *rt,
             JS_DumpString(rt, p);
         }
         break;
+    case JS_TAG_STRING_ROPE:
+        {
+            JSStringRope *r = JS_VALUE_GET_PTR(val);
+            printf("[rope len=%u depth=%d]", r->len, r->depth);
+        }
+        break;
     case JS_TAG_FUNCTION_BYTECODE:
         {
             JSFunctionBytecode *b = JS_VALUE_GET_PTR(val);
@@ -12146,6 +16058,7 @@ static bf_t *JS_ToBigIntFree(JSContext *ctx, bf_t *buf, JSValue val)
         JS_FreeValue(ctx, val);
         break;
     case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
         val = JS_StringToBigIntErr(ctx, val);
         if (JS_IsException(val))
             return NULL;
@@ -13430,10 +17343,10 @@ static no_inline __exception int js_add_slow(JSContext *ctx, JSValue *sp)
         /* try to call an overloaded operator */
         if ((tag1 == JS_TAG_OBJECT &&
              (tag2 != JS_TAG_NULL && tag2 != JS_TAG_UNDEFINED &&
-              tag2 != JS_TAG_STRING)) ||
+              !tag_is_string(tag2))) ||
             (tag2 == JS_TAG_OBJECT &&
              (tag1 != JS_TAG_NULL && tag1 != JS_TAG_UNDEFINED &&
-              tag1 != JS_TAG_STRING))) {
+              !tag_is_string(tag1)))) {
             ret = js_call_binary_op_fallback(ctx, &res, op1, op2, OP_add,
                                              FALSE, HINT_NONE);
             if (ret != 0) {
@@ -13463,7 +17376,7 @@ static no_inline __exception int js_add_slow(JSContext *ctx, JSValue *sp)
         tag2 = JS_VALUE_GET_NORM_TAG(op2);
     }
 
-    if (tag1 == JS_TAG_STRING || tag2 == JS_TAG_STRING) {
+    if (tag_is_string(tag1) || tag_is_string(tag2)) {
         sp[-2] = JS_ConcatString(ctx, op1, op2);
         if (JS_IsException(sp[-2]))
             goto exception;
@@ -13749,11 +17662,8 @@ static no_inline int js_relational_slow(JSContext *ctx, JSValue *sp,
     tag1 = JS_VALUE_GET_NORM_TAG(op1);
     tag2 = JS_VALUE_GET_NORM_TAG(op2);
 
-    if (tag1 == JS_TAG_STRING && tag2 == JS_TAG_STRING) {
-        JSString *p1, *p2;
-        p1 = JS_VALUE_GET_STRING(op1);
-        p2 = JS_VALUE_GET_STRING(op2);
-        res = js_string_compare(ctx, p1, p2);
+    if (tag_is_string(tag1) && tag_is_string(tag2)) {
+        res = js_string_value_compare(ctx, op1, op2);
         switch(op) {
         case OP_lt:
             res = (res < 0);
@@ -13776,15 +17686,15 @@ static no_inline int js_relational_slow(JSContext *ctx, JSValue *sp,
         /* fast path for float64/int */
         goto float64_compare;
     } else {
-        if (((tag1 == JS_TAG_BIG_INT && tag2 == JS_TAG_STRING) ||
-             (tag2 == JS_TAG_BIG_INT && tag1 == JS_TAG_STRING)) &&
+        if (((tag1 == JS_TAG_BIG_INT && tag_is_string(tag2)) ||
+             (tag2 == JS_TAG_BIG_INT && tag_is_string(tag1))) &&
             !is_math_mode(ctx)) {
-            if (tag1 == JS_TAG_STRING) {
+            if (tag_is_string(tag1)) {
                 op1 = JS_StringToBigInt(ctx, op1);
                 if (JS_VALUE_GET_TAG(op1) != JS_TAG_BIG_INT)
                     goto invalid_bigint_string;
             }
-            if (tag2 == JS_TAG_STRING) {
+            if (tag_is_string(tag2)) {
                 op2 = JS_StringToBigInt(ctx, op2);
                 if (JS_VALUE_GET_TAG(op2) != JS_TAG_BIG_INT) {
                 invalid_bigint_string:
@@ -13882,6 +17792,11 @@ static no_inline __exception int js_eq_slow(JSContext *ctx, JSValue *sp,
  redo:
     tag1 = JS_VALUE_GET_NORM_TAG(op1);
     tag2 = JS_VALUE_GET_NORM_TAG(op2);
+    /* a rope compares as a string */
+    if (tag1 == JS_TAG_STRING_ROPE)
+        tag1 = JS_TAG_STRING;
+    if (tag2 == JS_TAG_STRING_ROPE)
+        tag2 = JS_TAG_STRING;
     if (tag_is_number(tag1) && tag_is_number(tag2)) {
         if (tag1 == JS_TAG_INT && tag2 == JS_TAG_INT) {
             res = JS_VALUE_GET_INT(op1) == JS_VALUE_GET_INT(op2);
@@ -14262,7 +18177,7 @@ static no_inline __exception int js_add_slow(JSContext *ctx, JSValue *sp)
         }
         tag1 = JS_VALUE_GET_TAG(op1);
         tag2 = JS_VALUE_GET_TAG(op2);
-        if (tag1 == JS_TAG_STRING || tag2 == JS_TAG_STRING) {
+        if (tag_is_string(tag1) || tag_is_string(tag2)) {
             sp[-2] = JS_ConcatString(ctx, op1, op2);
             if (JS_IsException(sp[-2]))
                 goto exception;
@@ -14357,12 +18272,9 @@ static no_inline int js_relational_slow(JSContext *ctx, JSValue *sp,
         JS_FreeValue(ctx, op1);
         goto exception;
     }
-    if (JS_VALUE_GET_TAG(op1) == JS_TAG_STRING &&
-        JS_VALUE_GET_TAG(op2) == JS_TAG_STRING) {
-        JSString *p1, *p2;
-        p1 = JS_VALUE_GET_STRING(op1);
-        p2 = JS_VALUE_GET_STRING(op2);
-        res = js_string_compare(ctx, p1, p2);
+    if (tag_is_string(JS_VALUE_GET_TAG(op1)) &&
+        tag_is_string(JS_VALUE_GET_TAG(op2))) {
+        res = js_string_value_compare(ctx, op1, op2);
         JS_FreeValue(ctx, op1);
         JS_FreeValue(ctx, op2);
         switch(op) {
@@ -14424,6 +18336,11 @@ static no_inline __exception int js_eq_slow(JSContext *ctx, JSValue *sp,
  redo:
     tag1 = JS_VALUE_GET_NORM_TAG(op1);
     tag2 = JS_VALUE_GET_NORM_TAG(op2);
+    /* a rope compares as a string */
+    if (tag1 == JS_TAG_STRING_ROPE)
+        tag1 = JS_TAG_STRING;
+    if (tag2 == JS_TAG_STRING_ROPE)
+        tag2 = JS_TAG_STRING;
     if (tag1 == tag2 ||
         (tag1 == JS_TAG_INT && tag2 == JS_TAG_FLOAT64) ||
         (tag2 == JS_TAG_INT && tag1 == JS_TAG_FLOAT64)) {
@@ -14535,15 +18452,12 @@ static BOOL js_strict_eq2(JSContext *ctx, JSValue op1, JSValue op2,
         res = (tag1 == tag2);
         break;
     case JS_TAG_STRING:
-        {
-            JSString *p1, *p2;
-            if (tag1 != tag2) {
-                res = FALSE;
-            } else {
-                p1 = JS_VALUE_GET_STRING(op1);
-                p2 = JS_VALUE_GET_STRING(op2);
-                res = (js_string_compare(ctx, p1, p2) == 0);
-            }
+    case JS_TAG_STRING_ROPE:
+        if (!tag_is_string(tag2) ||
+            js_string_value_len(op1) != js_string_value_len(op2)) {
+            res = FALSE;
+        } else {
+            res = (js_string_value_compare(ctx, op1, op2) == 0);
         }
         break;
     case JS_TAG_SYMBOL:
@@ -14787,6 +18701,7 @@ static __exception int js_operator_typeof(JSContext *ctx, JSValueConst op1)
         atom = JS_ATOM_boolean;
         break;
     case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
         atom = JS_ATOM_string;
         break;
     case JS_TAG_OBJECT:
@@ -15727,6 +19642,13 @@ static JSValue js_closure(JSContext *ctx, JSValue bfunc,
     JSAtom name_atom;
 
     b = JS_VALUE_GET_PTR(bfunc);
+    if (b->is_lazy && !JS_IsUndefined(b->cpool[0])) {
+        /* already compiled */
+        JSValue func_val = JS_DupValue(ctx, b->cpool[0]);
+        JS_FreeValue(ctx, bfunc);
+        bfunc = func_val;
+        b = JS_VALUE_GET_PTR(bfunc);
+    }
     func_obj = JS_NewObjectClass(ctx, func_kind_to_class_id[b->func_kind]);
     if (JS_IsException(func_obj)) {
         JS_FreeValue(ctx, bfunc);
@@ -16084,6 +20006,145 @@ static JSValue js_call_bound_function(JSContext *ctx, JSValueConst func_obj,
     }
 }
 
+static void js_ic_add(JSRuntime *rt, JSInlineCache *ic, JSShape *sh,
+                      uint32_t prop_idx, int depth)
+{
+    int i;
+
+    if (depth != 0 && ic->proto_epoch != rt->proto_epoch) {
+        /* remove the obsolete prototype entries */
+        for(i = 0; i < JS_IC_WAYS; i++) {
+            if (ic->entries[i].depth != 0)
+                ic->entries[i].shape_id = 0;
+        }
+        ic->proto_epoch = rt->proto_epoch;
+    }
+    memmove(&ic->entries[1], &ic->entries[0],
+            sizeof(ic->entries[0]) * (JS_IC_WAYS - 1));
+    ic->entries[0].shape_id = sh->ic_id;
+    ic->entries[0].prop_idx = prop_idx;
+    ic->entries[0].depth = depth;
+}
+
+/* objects whose property lookup only depends on their shape for
+   non-index atoms */
+static inline BOOL js_ic_is_plain_object(JSObject *p)
+{
+    return !p->is_exotic || p->class_id == JS_CLASS_ARRAY;
+}
+
+static no_inline JSValue js_get_field_ic_miss(JSContext *ctx, JSObject *p,
+                                              JSInlineCache *ic)
+{
+    JSShapeProperty *prs;
+    JSProperty *pr;
+    JSObject *p1;
+    uint32_t prop_idx;
+    int depth;
+
+    p1 = p;
+    depth = 0;
+    for(;;) {
+        prs = find_own_property(&pr, p1, ic->atom);
+        if (prs) {
+            prop_idx = prs - get_shape_prop(p1->shape);
+            if ((prs->flags & JS_PROP_TMASK) || prop_idx > 0xffff)
+                break;
+            js_ic_add(ctx->rt, ic, p->shape, prop_idx, depth);
+            return JS_DupValue(ctx, pr->u.value);
+        }
+        /* the prototype chain is cached only if its modifications are
+           tracked */
+        if (!js_ic_is_plain_object(p1) || __JS_AtomIsTaggedInt(ic->atom))
+            break;
+        p1 = p1->shape->proto;
+        if (!p1 || !p1->shape->is_prototype || depth == 0xffff)
+            break;
+        depth++;
+    }
+    return JS_GetPropertyInternal(ctx, JS_MKPTR(JS_TAG_OBJECT, p), ic->atom,
+                                  JS_MKPTR(JS_TAG_OBJECT, p), FALSE);
+}
+
+static inline JSValue js_get_field_ic(JSContext *ctx, JSValueConst obj,
+                                      JSInlineCache *ic)
+{
+    JSInlineCacheEntry *e;
+    JSObject *p;
+    uint32_t shape_id;
+    int i, depth;
+
+    if (likely(JS_VALUE_GET_TAG(obj) == JS_TAG_OBJECT)) {
+        p = JS_VALUE_GET_OBJ(obj);
+        shape_id = p->shape->ic_id;
+        for(i = 0; i < JS_IC_WAYS; i++) {
+            e = &ic->entries[i];
+            if (e->shape_id == shape_id) {
+                depth = e->depth;
+                if (depth != 0) {
+                    /* an exotic object may share the shape of the
+                       plain object which filled the entry */
+                    if (unlikely(ic->proto_epoch != ctx->rt->proto_epoch ||
+                                 !js_ic_is_plain_object(p)))
+                        break;
+                    /* the prototype chain is unchanged */
+                    do {
+                        p = p->shape->proto;
+                    } while (--depth != 0);
+                }
+                return JS_DupValue(ctx, p->prop[e->prop_idx].u.value);
+            }
+        }
+        return js_get_field_ic_miss(ctx, JS_VALUE_GET_OBJ(obj), ic);
+    }
+    return JS_GetProperty(ctx, obj, ic->atom);
+}
+
+static no_inline int js_put_field_ic_miss(JSContext *ctx, JSObject *p,
+                                          JSValue val, JSInlineCache *ic)
+{
+    JSShapeProperty *prs;
+    JSProperty *pr;
+    uint32_t prop_idx;
+
+    prs = find_own_property(&pr, p, ic->atom);
+    if (prs && (prs->flags & (JS_PROP_TMASK | JS_PROP_WRITABLE |
+                              JS_PROP_LENGTH)) == JS_PROP_WRITABLE) {
+        prop_idx = prs - get_shape_prop(p->shape);
+        if (prop_idx <= 0xffff)
+            js_ic_add(ctx->rt, ic, p->shape, prop_idx, 0);
+        set_value(ctx, &pr->u.value, val);
+        return TRUE;
+    }
+    return JS_SetPropertyInternal(ctx, JS_MKPTR(JS_TAG_OBJECT, p), ic->atom,
+                                  val, JS_PROP_THROW_STRICT);
+}
+
+/* 'val' is freed. Only own properties are cached. */
+static inline int js_put_field_ic(JSContext *ctx, JSValueConst obj,
+                                  JSValue val, JSInlineCache *ic)
+{
+    JSInlineCacheEntry *e;
+    JSObject *p;
+    uint32_t shape_id;
+    int i;
+
+    if (likely(JS_VALUE_GET_TAG(obj) == JS_TAG_OBJECT)) {
+        p = JS_VALUE_GET_OBJ(obj);
+        shape_id = p->shape->ic_id;
+        for(i = 0; i < JS_IC_WAYS; i++) {
+            e = &ic->entries[i];
+            if (e->shape_id == shape_id) {
+                set_value(ctx, &p->prop[e->prop_idx].u.value, val);
+                return TRUE;
+            }
+        }
+        return js_put_field_ic_miss(ctx, p, val, ic);
+    }
+    return JS_SetPropertyInternal(ctx, obj, ic->atom, val,
+                                  JS_PROP_THROW_STRICT);
+}
+
 /* argument of OP_special_object */
 typedef enum {
     OP_SPECIAL_OBJECT_ARGUMENTS,
@@ -16100,6 +20161,46 @@ typedef enum {
 #define FUNC_RET_YIELD_STAR 2
 
 /* argv[] is modified if (flags & JS_CALL_FLAG_COPY_ARGV) = 0. */
+#ifdef CONFIG_OPCODE_STATS
+static inline uint64_t js_opcode_stats_cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    uint32_t lo, hi;
+    __asm__ volatile ("rdtsc" : "=a" (lo), "=d" (hi));
+    return ((uint64_t)hi << 32) | lo;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+/* called before the execution of each opcode */
+static inline void js_opcode_stats_update(JSRuntime *rt, int *pprev_opcode,
+                                          int opcode)
+{
+    JSOpcodeStats *s = rt->opcode_stats;
+    uint64_t now = js_opcode_stats_cycles();
+    s->cycles[s->last_opcode] += now - s->last_cycles;
+    s->last_cycles = now;
+    s->last_opcode = opcode;
+    s->count[opcode]++;
+    if (*pprev_opcode != OP_invalid)
+        s->pair_count[*pprev_opcode][opcode]++;
+    *pprev_opcode = opcode;
+}
+
+/* called when leaving a bytecode function */
+static inline void js_opcode_stats_leave(JSRuntime *rt)
+{
+    JSOpcodeStats *s = rt->opcode_stats;
+    uint64_t now = js_opcode_stats_cycles();
+    s->cycles[s->last_opcode] += now - s->last_cycles;
+    s->last_cycles = now;
+    s->last_opcode = OP_invalid;
+}
+#endif
+
 static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                                JSValueConst this_obj, JSValueConst new_target,
                                int argc, JSValue *argv, int flags)
@@ -16114,9 +20215,16 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
     JSValue *local_buf, *stack_buf, *var_buf, *arg_buf, *sp, ret_val, *pval;
     JSVarRef **var_refs;
     size_t alloca_size;
+#ifdef CONFIG_OPCODE_STATS
+    int prev_opcode = OP_invalid;
+#define OPCODE_STATS_UPDATE(opcode) \
+    js_opcode_stats_update(rt, &prev_opcode, opcode)
+#else
+#define OPCODE_STATS_UPDATE(opcode) ((void)0)
+#endif
 
 #if !DIRECT_DISPATCH
-#define SWITCH(pc)      switch (opcode = *pc++)
+#define SWITCH(pc)      switch (opcode = *pc++, OPCODE_STATS_UPDATE(opcode), opcode)
 #define CASE(op)        case op
 #define DEFAULT         default
 #define BREAK           break
@@ -16131,7 +20239,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
 #include "quickjs-opcode.h"
         [ OP_COUNT ... 255 ] = &&case_default
     };
-#define SWITCH(pc)      goto *dispatch_table[opcode = *pc++];
+#define SWITCH(pc)      goto *dispatch_table[(opcode = *pc++, OPCODE_STATS_UPDATE(opcode), opcode)];
 #define CASE(op)        case_ ## op
 #define DEFAULT         case_default
 #define BREAK           SWITCH(pc)
@@ -16177,6 +20285,11 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                          (JSValueConst *)argv, flags);
     }
     b = p->u.func.function_bytecode;
+    if (unlikely(b->is_lazy)) {
+        b = js_get_lazy_function(caller_ctx, p);
+        if (!b)
+            return JS_EXCEPTION;
+    }
 
     if (unlikely(argc < b->arg_count || (flags & JS_CALL_FLAG_COPY_ARGV))) {
         arg_allocated_size = b->arg_count;
@@ -16216,6 +20329,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
     stack_buf = var_buf + b->var_count;
     sp = stack_buf;
     pc = b->byte_code_buf;
+    sf->cur_pc = pc;
     sf->prev_frame = rt->current_stack_frame;
     rt->current_stack_frame = sf;
     ctx = b->realm; /* set the current realm */
@@ -16258,6 +20372,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             *sp++ = JS_DupValue(ctx, b->cpool[*pc++]);
             BREAK;
         CASE(OP_fclosure8):
+            sf->cur_pc = pc;
             *sp++ = js_closure(ctx, JS_DupValue(ctx, b->cpool[*pc++]), var_refs, sf);
             if (unlikely(JS_IsException(sp[-1])))
                 goto exception;
@@ -16278,7 +20393,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             BREAK;
 #endif
         CASE(OP_push_atom_value):
-            *sp++ = JS_AtomToValue(ctx, get_u32(pc));
+            *sp++ = JS_AtomToValue(ctx, js_bytecode_atom(b, get_u32(pc)));
             pc += 4;
             BREAK;
         CASE(OP_undefined):
@@ -16316,6 +20431,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             *sp++ = JS_TRUE;
             BREAK;
         CASE(OP_object):
+            sf->cur_pc = pc;
             *sp++ = JS_NewObject(ctx);
             if (unlikely(JS_IsException(sp[-1])))
                 goto exception;
@@ -16522,6 +20638,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             {
                 JSValue bfunc = JS_DupValue(ctx, b->cpool[get_u32(pc)]);
                 pc += 4;
+                sf->cur_pc = pc;
                 *sp++ = js_closure(ctx, bfunc, var_refs, sf);
                 if (unlikely(JS_IsException(sp[-1])))
                     goto exception;
@@ -16598,6 +20715,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
 
                 call_argc = get_u16(pc);
                 pc += 2;
+                sf->cur_pc = pc;
                 ret_val = JS_NewArray(ctx);
                 if (unlikely(JS_IsException(ret_val)))
                     goto exception;
@@ -16683,7 +20801,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             {
                 JSAtom atom;
                 int type;
-                atom = get_u32(pc);
+                atom = js_bytecode_atom(b, get_u32(pc));
                 type = pc[4];
                 pc += 5;
                 if (type == JS_THROW_VAR_RO)
@@ -16801,7 +20919,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             {
                 int ret;
                 JSAtom atom;
-                atom = get_u32(pc);
+                atom = js_bytecode_atom(b, get_u32(pc));
                 pc += 4;
 
                 ret = JS_CheckGlobalVar(ctx, atom);
@@ -16816,7 +20934,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             {
                 JSValue val;
                 JSAtom atom;
-                atom = get_u32(pc);
+                atom = js_bytecode_atom(b, get_u32(pc));
                 pc += 4;
 
                 val = JS_GetGlobalVar(ctx, atom, opcode - OP_get_var_undef);
@@ -16831,7 +20949,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             {
                 int ret;
                 JSAtom atom;
-                atom = get_u32(pc);
+                atom = js_bytecode_atom(b, get_u32(pc));
                 pc += 4;
 
                 ret = JS_SetGlobalVar(ctx, atom, sp[-1], opcode - OP_put_var);
@@ -16845,7 +20963,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             {
                 int ret;
                 JSAtom atom;
-                atom = get_u32(pc);
+                atom = js_bytecode_atom(b, get_u32(pc));
                 pc += 4;
 
                 /* sp[-2] is JS_TRUE or JS_FALSE */
@@ -16864,7 +20982,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             {
                 JSAtom atom;
                 int flags;
-                atom = get_u32(pc);
+                atom = js_bytecode_atom(b, get_u32(pc));
                 flags = pc[4];
                 pc += 5;
                 if (JS_CheckDefineGlobalVar(ctx, atom, flags))
@@ -16875,7 +20993,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             {
                 JSAtom atom;
                 int flags;
-                atom = get_u32(pc);
+                atom = js_bytecode_atom(b, get_u32(pc));
                 flags = pc[4];
                 pc += 5;
                 if (JS_DefineGlobalVar(ctx, atom, flags))
@@ -16886,7 +21004,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             {
                 JSAtom atom;
                 int flags;
-                atom = get_u32(pc);
+                atom = js_bytecode_atom(b, get_u32(pc));
                 flags = pc[4];
                 pc += 5;
                 if (JS_DefineGlobalFunction(ctx, atom, sp[-1], flags))
@@ -17125,7 +21243,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                 JSProperty *pr;
                 JSAtom atom;
                 int idx;
-                atom = get_u32(pc);
+                atom = js_bytecode_atom(b, get_u32(pc));
                 idx = get_u16(pc + 4);
                 pc += 6;
                 *sp++ = JS_NewObjectProto(ctx, JS_NULL);
@@ -17152,7 +21270,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
         CASE(OP_make_var_ref):
             {
                 JSAtom atom;
-                atom = get_u32(pc);
+                atom = js_bytecode_atom(b, get_u32(pc));
                 pc += 4;
 
                 if (JS_GetGlobalVarRef(ctx, atom, sp))
@@ -17163,18 +21281,18 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
 
         CASE(OP_goto):
             pc += (int32_t)get_u32(pc);
-            if (unlikely(js_poll_interrupts(ctx)))
+            if (unlikely(js_poll_interrupts_pc(ctx, sf, pc)))
                 goto exception;
             BREAK;
 #if SHORT_OPCODES
         CASE(OP_goto16):
             pc += (int16_t)get_u16(pc);
-            if (unlikely(js_poll_interrupts(ctx)))
+            if (unlikely(js_poll_interrupts_pc(ctx, sf, pc)))
                 goto exception;
             BREAK;
         CASE(OP_goto8):
             pc += (int8_t)pc[0];
-            if (unlikely(js_poll_interrupts(ctx)))
+            if (unlikely(js_poll_interrupts_pc(ctx, sf, pc)))
                 goto exception;
             BREAK;
 #endif
@@ -17194,7 +21312,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                 if (res) {
                     pc += (int32_t)get_u32(pc - 4) - 4;
                 }
-                if (unlikely(js_poll_interrupts(ctx)))
+                if (unlikely(js_poll_interrupts_pc(ctx, sf, pc)))
                     goto exception;
             }
             BREAK;
@@ -17214,7 +21332,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                 if (!res) {
                     pc += (int32_t)get_u32(pc - 4) - 4;
                 }
-                if (unlikely(js_poll_interrupts(ctx)))
+                if (unlikely(js_poll_interrupts_pc(ctx, sf, pc)))
                     goto exception;
             }
             BREAK;
@@ -17235,7 +21353,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                 if (res) {
                     pc += (int8_t)pc[-1] - 1;
                 }
-                if (unlikely(js_poll_interrupts(ctx)))
+                if (unlikely(js_poll_interrupts_pc(ctx, sf, pc)))
                     goto exception;
             }
             BREAK;
@@ -17255,7 +21373,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                 if (!res) {
                     pc += (int8_t)pc[-1] - 1;
                 }
-                if (unlikely(js_poll_interrupts(ctx)))
+                if (unlikely(js_poll_interrupts_pc(ctx, sf, pc)))
                     goto exception;
             }
             BREAK;
@@ -17439,7 +21557,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             {
                 JSValue val;
                 JSAtom atom;
-                atom = get_u32(pc);
+                atom = js_bytecode_atom(b, get_u32(pc));
                 pc += 4;
 
                 val = JS_GetProperty(ctx, sp[-1], atom);
@@ -17454,7 +21572,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             {
                 JSValue val;
                 JSAtom atom;
-                atom = get_u32(pc);
+                atom = js_bytecode_atom(b, get_u32(pc));
                 pc += 4;
 
                 val = JS_GetProperty(ctx, sp[-1], atom);
@@ -17468,7 +21586,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             {
                 int ret;
                 JSAtom atom;
-                atom = get_u32(pc);
+                atom = js_bytecode_atom(b, get_u32(pc));
                 pc += 4;
 
                 ret = JS_SetPropertyInternal(ctx, sp[-2], atom, sp[-1],
@@ -17480,12 +21598,56 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             }
             BREAK;
 
+        CASE(OP_get_field_ic):
+            {
+                JSValue val;
+                JSInlineCache *ic;
+                ic = &b->ic[get_u32(pc)];
+                pc += 4;
+
+                val = js_get_field_ic(ctx, sp[-1], ic);
+                if (unlikely(JS_IsException(val)))
+                    goto exception;
+                JS_FreeValue(ctx, sp[-1]);
+                sp[-1] = val;
+            }
+            BREAK;
+
+        CASE(OP_get_field2_ic):
+            {
+                JSValue val;
+                JSInlineCache *ic;
+                ic = &b->ic[get_u32(pc)];
+                pc += 4;
+
+                val = js_get_field_ic(ctx, sp[-1], ic);
+                if (unlikely(JS_IsException(val)))
+                    goto exception;
+                *sp++ = val;
+            }
+            BREAK;
+
+        CASE(OP_put_field_ic):
+            {
+                int ret;
+                JSInlineCache *ic;
+                ic = &b->ic[get_u32(pc)];
+                pc += 4;
+
+                ret = js_put_field_ic(ctx, sp[-2], sp[-1], ic);
+                JS_FreeValue(ctx, sp[-2]);
+                sp -= 2;
+                if (unlikely(ret < 0))
+                    goto exception;
+            }
+            BREAK;
+
         CASE(OP_private_symbol):
             {
                 JSAtom atom;
                 JSValue val;
                 
-                atom = get_u32(pc);
+                atom = js_bytecode_atom(b, get_u32(pc));
                 pc += 4;
                 val = JS_NewSymbolFromAtom(ctx, atom, JS_ATOM_TYPE_PRIVATE);
                 if (JS_IsException(val))
@@ -17535,8 +21697,9 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             {
                 int ret;
                 JSAtom atom;
-                atom = get_u32(pc);
+                atom = js_bytecode_atom(b, get_u32(pc));
                 pc += 4;
+                sf->cur_pc = pc;
 
                 ret = JS_DefinePropertyValue(ctx, sp[-2], atom, sp[-1],
                                              JS_PROP_C_W_E | JS_PROP_THROW);
@@ -17550,7 +21713,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             {
                 int ret;
                 JSAtom atom;
-                atom = get_u32(pc);
+                atom = js_bytecode_atom(b, get_u32(pc));
                 pc += 4;
 
                 ret = JS_DefineObjectName(ctx, sp[-1], atom, JS_PROP_CONFIGURABLE);
@@ -17601,7 +21764,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                         goto exception;
                     opcode += OP_define_method - OP_define_method_computed;
                 } else {
-                    atom = get_u32(pc);
+                    atom = js_bytecode_atom(b, get_u32(pc));
                     pc += 4;
                 }
                 op_flags = *pc++;
@@ -17647,7 +21810,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                 int class_flags;
                 JSAtom atom;
                 
-                atom = get_u32(pc);
+                atom = js_bytecode_atom(b, get_u32(pc));
                 class_flags = pc[4];
                 pc += 5;
                 if (js_op_define_class(ctx, sp, atom, class_flags,
@@ -17724,6 +21887,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             {
                 int ret;
 
+                sf->cur_pc = pc;
                 ret = JS_SetPropertyValue(ctx, sp[-3], sp[-2], sp[-1], JS_PROP_THROW_STRICT);
                 JS_FreeValue(ctx, sp[-3]);
                 sp -= 3;
@@ -17786,6 +21950,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
         CASE(OP_define_array_el):
             {
                 int ret;
+                sf->cur_pc = pc;
                 ret = JS_DefinePropertyValueValue(ctx, sp[-3], JS_DupValue(ctx, sp[-2]), sp[-1],
                                                   JS_PROP_C_W_E | JS_PROP_THROW);
                 sp -= 1;
@@ -17836,6 +22001,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                     sp--;
                 } else {
                 add_slow:
+                    sf->cur_pc = pc;
                     if (js_add_slow(ctx, sp))
                         goto exception;
                     sp--;
@@ -17858,13 +22024,18 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                         goto add_loc_slow;
                     *pv = JS_NewInt32(ctx, r);
                     sp--;
-                } else if (JS_VALUE_GET_TAG(*pv) == JS_TAG_STRING) {
+                } else if (tag_is_string(JS_VALUE_GET_TAG(*pv))) {
                     JSValue op1;
                     op1 = sp[-1];
                     sp--;
+                    sf->cur_pc = pc;
                     op1 = JS_ToPrimitiveFree(ctx, op1, HINT_NONE);
                     if (JS_IsException(op1))
                         goto exception;
+                    if (js_rope_append_in_place(ctx, *pv, op1)) {
+                        JS_FreeValue(ctx, op1);
+                        BREAK;
+                    }
                     op1 = JS_ConcatString(ctx, JS_DupValue(ctx, *pv), op1);
                     if (JS_IsException(op1))
                         goto exception;
@@ -18078,6 +22249,22 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                 goto exception;
             sp++;
             BREAK;
+#if SHORT_OPCODES
+        CASE(OP_inc_loc_goto8):
+            {
+                JSValue op1 = var_buf[*pc];
+                if (likely(JS_VALUE_GET_TAG(op1) == JS_TAG_INT &&
+                           JS_VALUE_GET_INT(op1) != INT32_MAX)) {
+                    var_buf[*pc] = JS_NewInt32(ctx, JS_VALUE_GET_INT(op1) + 1);
+                    pc += 2;
+                    pc += (int8_t)pc[0];
+                    if (unlikely(js_poll_interrupts_pc(ctx, sf, pc)))
+                        goto exception;
+                    BREAK;
+                }
+            }
+            /* fall thru: the goto8 is dispatched after inc_loc */
+#endif
         CASE(OP_inc_loc):
             {
                 JSValue op1;
@@ -18300,9 +22487,38 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                 }                                                       \
             BREAK
 
+#if SHORT_OPCODES
+/* comparison followed by if_false8. If the operands are not integers,
+   the comparison is executed alone and the if_false8 is dispatched. */
+#define OP_CMP_IF_FALSE8(fused_opcode, opcode1, binary_op)              \
+            CASE(fused_opcode):                                         \
+                if (likely(JS_VALUE_IS_BOTH_INT(sp[-2], sp[-1]))) {     \
+                    int res = JS_VALUE_GET_INT(sp[-2]) binary_op JS_VALUE_GET_INT(sp[-1]); \
+                    sp -= 2;                                            \
+                    pc += 2;                                            \
+                    if (!res)                                           \
+                        pc += (int8_t)pc[-1] - 1;                       \
+                    if (unlikely(js_poll_interrupts_pc(ctx, sf, pc)))   \
+                        goto exception;                                 \
+                    BREAK;                                              \
+                }                                                       \
+                opcode = opcode1;                                       \
+                /* fall thru */
+
+            OP_CMP_IF_FALSE8(OP_lt_if_false8, OP_lt, <);
+#endif
             OP_CMP(OP_lt, <, js_relational_slow(ctx, sp, opcode));
+#if SHORT_OPCODES
+            OP_CMP_IF_FALSE8(OP_lte_if_false8, OP_lte, <=);
+#endif
             OP_CMP(OP_lte, <=, js_relational_slow(ctx, sp, opcode));
+#if SHORT_OPCODES
+            OP_CMP_IF_FALSE8(OP_gt_if_false8, OP_gt, >);
+#endif
             OP_CMP(OP_gt, >, js_relational_slow(ctx, sp, opcode));
+#if SHORT_OPCODES
+            OP_CMP_IF_FALSE8(OP_gte_if_false8, OP_gte, >=);
+#endif
             OP_CMP(OP_gte, >=, js_relational_slow(ctx, sp, opcode));
             OP_CMP(OP_eq, ==, js_eq_slow(ctx, sp, 0));
             OP_CMP(OP_neq, !=, js_eq_slow(ctx, sp, 1));
@@ -18347,7 +22563,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                 JSAtom atom;
                 int ret;
 
-                atom = get_u32(pc);
+                atom = js_bytecode_atom(b, get_u32(pc));
                 pc += 4;
 
                 ret = JS_DeleteProperty(ctx, ctx->global_obj, atom, 0);
@@ -18425,7 +22641,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                 int32_t diff;
                 JSValue obj, val;
                 int ret, is_with;
-                atom = get_u32(pc);
+                atom = js_bytecode_atom(b, get_u32(pc));
                 diff = get_u32(pc + 4);
                 is_with = pc[8];
                 pc += 9;
@@ -18611,6 +22827,9 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             JS_FreeValue(ctx, *pval);
         }
     }
+#ifdef CONFIG_OPCODE_STATS
+    js_opcode_stats_leave(rt);
+#endif
     rt->current_stack_frame = sf->prev_frame;
     return ret_val;
 }
@@ -18804,6 +23023,11 @@ static __exception int async_func_init(JSContext *ctx, JSAsyncFunctionState *s,
     init_list_head(&sf->var_ref_list);
     p = JS_VALUE_GET_OBJ(func_obj);
     b = p->u.func.function_bytecode;
+    if (unlikely(b->is_lazy)) {
+        b = js_get_lazy_function(ctx, p);
+        if (!b)
+            return -1;
+    }
     sf->js_mode = b->js_mode;
     sf->cur_pc = b->byte_code_buf;
     arg_buf_len = max_int(b->arg_count, argc);
@@ -19960,6 +24184,13 @@ typedef struct JSFunctionDef {
     char *source;  /* raw source, utf-8 encoded */
     int source_len;
 
+    /* if is_lazy is true, the body was skipped by the parser and
+       lazy_names contains the identifiers it references */
+    BOOL is_lazy;
+    JSAtom *lazy_names;
+    int lazy_name_count;
+    int lazy_name_size;
+
     JSModuleDef *module; /* != NULL when parsing a module */
 } JSFunctionDef;
 
@@ -20006,10 +24237,11 @@ typedef struct JSParseState {
     BOOL is_module; /* parsing a module */
     BOOL allow_html_comments;
     BOOL ext_json; /* true if accepting JSON superset */
+    BOOL lazy_functions; /* skip the function bodies (JS_EVAL_FLAG_LAZY) */
 } JSParseState;
 
 typedef struct JSOpCode {
-#ifdef DUMP_BYTECODE
+#if defined(DUMP_BYTECODE) || defined(CONFIG_OPCODE_STATS)
     const char *name;
 #endif
     uint8_t size; /* in bytes */
@@ -20022,7 +24254,7 @@ typedef struct JSOpCode {
 
 static const JSOpCode opcode_info[OP_COUNT + (OP_TEMP_END - OP_TEMP_START)] = {
 #define FMT(f)
-#ifdef DUMP_BYTECODE
+#if defined(DUMP_BYTECODE) || defined(CONFIG_OPCODE_STATS)
 #define DEF(id, size, n_pop, n_push, f) { #id, size, n_pop, n_push, OP_FMT_ ## f },
 #else
 #define DEF(id, size, n_pop, n_push, f) { size, n_pop, n_push, OP_FMT_ ## f },
@@ -20040,10 +24272,107 @@ static const JSOpCode opcode_info[OP_COUNT + (OP_TEMP_END - OP_TEMP_START)] = {
 #define short_opcode_info(op)           \
     opcode_info[(op) >= OP_TEMP_START ? \
                 (op) + (OP_TEMP_END - OP_TEMP_START) : (op)]
+
+/* superinstructions: { first opcode, second opcode, fused opcode } */
+static const uint8_t fused_opcodes[][3] = {
+#define FUSE(id, op1, op2) { OP_ ## op1, OP_ ## op2, OP_ ## id },
+#include "quickjs-opcode.h"
+};
 #else
 #define short_opcode_info(op) opcode_info[op]
 #endif
 
+#ifdef CONFIG_OPCODE_STATS
+#if defined(__x86_64__) || defined(__i386__)
+#define OPCODE_STATS_UNIT "cycles"
+#else
+#define OPCODE_STATS_UNIT "ns"
+#endif
+
+/* sort in decreasing order of 'count' */
+static int js_opcode_stats_cmp(const void *a, const void *b, void *opaque)
+{
+    const uint64_t *count = opaque;
+    uint64_t ca = count[*(const int *)a], cb = count[*(const int *)b];
+    return (ca < cb) - (ca > cb);
+}
+
+void JS_DumpOpcodeStats(FILE *fp, JSRuntime *rt)
+{
+    JSOpcodeStats *s = rt->opcode_stats;
+    uint64_t *pair_count;
+    uint64_t total_count, total_cycles, total_pairs;
+    int *tab, i, n;
+    BOOL is_fused;
+
+    tab = js_malloc_rt(rt, sizeof(tab[0]) * 256 * 256);
+    pair_count = js_malloc_rt(rt, sizeof(pair_count[0]) * 256 * 256);
+    if (!tab || !pair_count) {
+        js_free_rt(rt, tab);
+        js_free_rt(rt, pair_count);
+        return;
+    }
+    /* the superinstructions are counted as the pair they replace so
+       that the fusion table can be regenerated from this list */
+    memcpy(pair_count, s->pair_count, sizeof(pair_count[0]) * 256 * 256);
+#if SHORT_OPCODES
+    for(i = 0; i < countof(fused_opcodes); i++) {
+        pair_count[fused_opcodes[i][0] * 256 + fused_opcodes[i][1]] +=
+            s->count[fused_opcodes[i][2]];
+    }
+#endif
+    total_count = total_cycles = total_pairs = 0;
+    for(i = 0; i < 256 * 256; i++)
+        total_pairs += pair_count[i];
+
+    n = 0;
+    for(i = 1; i < OP_COUNT; i++) {
+        if (s->count[i] != 0) {
+            total_count += s->count[i];
+            total_cycles += s->cycles[i];
+            tab[n++] = i;
+        }
+    }
+    rqsort(tab, n, sizeof(tab[0]), js_opcode_stats_cmp, s->count);
+    fprintf(fp, "\n%-22s %14s %6s %14s %6s %8s\n",
+            "OPCODE", "COUNT", "%", OPCODE_STATS_UNIT, "%", "AVERAGE");
+    for(i = 0; i < n; i++) {
+        int op = tab[i];
+        fprintf(fp, "%-22s %14" PRIu64 " %6.2f %14" PRIu64 " %6.2f %8.1f\n",
+                short_opcode_info(op).name, s->count[op],
+                100.0 * s->count[op] / total_count, s->cycles[op],
+                total_cycles ? 100.0 * s->cycles[op] / total_cycles : 0.0,
+                (double)s->cycles[op] / s->count[op]);
+    }
+    fprintf(fp, "%-22s %14" PRIu64 " %6s %14" PRIu64 "\n",
+            "total", total_count, "", total_cycles);
+
+    n = 0;
+    for(i = 0; i < 256 * 256; i++) {
+        if (pair_count[i] != 0)
+            tab[n++] = i;
+    }
+    rqsort(tab, n, sizeof(tab[0]), js_opcode_stats_cmp, pair_count);
+    fprintf(fp, "\n%-45s %14s %6s %s\n", "OPCODE PAIR", "COUNT", "%", "FUSED");
+    for(i = 0; i < min_int(n, 100); i++) {
+        int op1 = tab[i] >> 8, op2 = tab[i] & 0xff, j;
+        is_fused = FALSE;
+#if SHORT_OPCODES
+        for(j = 0; j < countof(fused_opcodes); j++) {
+            if (fused_opcodes[j][0] == op1 && fused_opcodes[j][1] == op2)
+                is_fused = TRUE;
+        }
+#endif
+        fprintf(fp, "%-22s %-22s %14" PRIu64 " %6.2f %s\n",
+                short_opcode_info(op1).name, short_opcode_info(op2).name,
+                pair_count[tab[i]], 100.0 * pair_count[tab[i]] / total_pairs,
+                is_fused ? "yes" : "");
+    }
+    js_free_rt(rt, pair_count);
+    js_free_rt(rt, tab);
+}
+#endif /* CONFIG_OPCODE_STATS */
+
 static __exception int next_token(JSParseState *s);
 
 static void free_token(JSParseState *s, JSToken *token)
@@ -22497,6 +26826,153 @@ static int js_parse_skip_parens_token(JSParseState *s, int *pbits, BOOL no_line_
     return tok;
 }
 
+static int add_lazy_name(JSContext *ctx, JSFunctionDef *fd, JSAtom name)
+{
+    if (js_resize_array(ctx, (void **)&fd->lazy_names,
+                        sizeof(fd->lazy_names[0]),
+                        &fd->lazy_name_size, fd->lazy_name_count + 1))
+        return -1;
+    fd->lazy_names[fd->lazy_name_count++] = JS_DupAtom(ctx, name);
+    return 0;
+}
+
+static void free_lazy_names(JSContext *ctx, JSFunctionDef *fd)
+{
+    int i;
+
+    for(i = 0; i < fd->lazy_name_count; i++)
+        JS_FreeAtom(ctx, fd->lazy_names[i]);
+    js_free(ctx, fd->lazy_names);
+    fd->lazy_names = NULL;
+    fd->lazy_name_count = 0;
+    fd->lazy_name_size = 0;
+}
+
+/* Skip the body of a function which is compiled at its first call. The
+   current token is the opening '{'. The identifiers which may
+   reference the enclosing scopes are added to fd->lazy_names. Return 0
+   if the body was skipped (the current token is then the closing '}'),
+   1 if the function must be parsed now (the caller seeks back to the
+   opening '{') and -1 if exception. */
+static int js_parse_skip_function_body(JSParseState *s, JSFunctionDef *fd)
+{
+    char state[256];
+    size_t level = 0;
+    int last_tok, tok, c, tok_len;
+
+    last_tok = 0;
+    for (;;) {
+        tok = s->token.val;
+        switch(tok) {
+        case '(':
+            /* a regexp may follow the ')' of a statement condition */
+            if (last_tok == TOK_IF || last_tok == TOK_WHILE ||
+                last_tok == TOK_FOR || last_tok == TOK_WITH)
+                c = 'c';
+            else
+                c = '(';
+            goto push_state;
+        case '[':
+            c = '[';
+            goto push_state;
+        case '{':
+            /* a regexp may follow the '}' of a block but not the '}'
+               of an object literal */
+            if (level == 0 || !is_regexp_allowed(last_tok) ||
+                last_tok == ';' || last_tok == '{' || last_tok == TOK_ARROW ||
+                last_tok == TOK_ELSE || last_tok == TOK_DO ||
+                (last_tok == ':' && state[level - 1] != 'o'))
+                c = '{';
+            else
+                c = 'o';
+        push_state:
+            if (level >= sizeof(state))
+                return 1;
+            state[level++] = c;
+            break;
+        case ')':
+            if (level == 0)
+                return 1;
+            c = state[--level];
+            if (c == 'c')
+                tok = ';';
+            else if (c != '(')
+                return 1;
+            break;
+        case ']':
+            if (level == 0 || state[--level] != '[')
+                return 1;
+            break;
+        case '}':
+            if (level == 0)
+                return 1;
+            c = state[--level];
+            if (c == '`') {
+                /* continue the parsing of the template */
+                free_token(s, &s->token);
+                s->got_lf = FALSE;
+                s->last_line_num = s->token.line_num;
+                if (js_parse_template_part(s, s->buf_ptr))
+                    goto fail;
+                goto handle_template;
+            }
+            if (level == 0)
+                return 0;
+            if (c == '{')
+                tok = ';';
+            else if (c != 'o')
+                return 1;
+            break;
+        case TOK_TEMPLATE:
+        handle_template:
+            if (s->token.u.str.sep != '`') {
+                if (level >= sizeof(state))
+                    return 1;
+                state[level++] = '`';
+            }
+            break;
+        case TOK_IDENT:
+        case TOK_YIELD:
+        case TOK_AWAIT:
+            if (last_tok == '.' || last_tok == TOK_QUESTION_MARK_DOT)
+                break;
+            /* a direct eval() may reference any variable */
+            if (s->token.u.ident.atom == JS_ATOM_eval)
+                return 1;
+            if (add_lazy_name(s->ctx, fd, s->token.u.ident.atom))
+                return -1;
+            if (token_is_pseudo_keyword(s, JS_ATOM_of) ||
+                token_is_pseudo_keyword(s, JS_ATOM_yield))
+                tok = TOK_OF;
+            break;
+        case TOK_PRIVATE_NAME: /* the private names are not in lazy_names */
+        case TOK_IMPORT: /* import.meta is only valid in modules */
+        case TOK_EOF:
+            return 1;
+        case TOK_DIV_ASSIGN:
+            tok_len = 2;
+            goto parse_regexp;
+        case '/':
+            tok_len = 1;
+        parse_regexp:
+            if (is_regexp_allowed(last_tok)) {
+                s->buf_ptr -= tok_len;
+                if (js_parse_regexp(s))
+                    goto fail;
+                tok = TOK_REGEXP;
+            }
+            break;
+        }
+        last_tok = tok;
+        if (next_token(s))
+            goto fail;
+    }
+ fail:
+    /* the error is reported again if the body is parsed */
+    JS_FreeValue(s->ctx, JS_GetException(s->ctx));
+    return 1;
+}
+
 static void set_object_name(JSParseState *s, JSAtom name)
 {
     JSFunctionDef *fd = s->cur_func;
@@ -28764,6 +33240,7 @@ static void js_free_function_def(JSContext *ctx, JSFunctionDef *fd)
     dbuf_free(&fd->pc2line);
 
     js_free(ctx, fd->source);
+    free_lazy_names(ctx, fd);
 
     if (fd->parent) {
         /* remove in parent list */
@@ -28991,6 +33468,12 @@ static void dump_byte_code(JSContext *ctx, int pass,
             printf(" ");
             print_atom(ctx, get_u32(tab + pos));
             break;
+        case OP_FMT_ic:
+            idx = get_u32(tab + pos);
+            printf(" %u: ", idx);
+            if (b && idx < b->ic_count)
+                print_atom(ctx, b->ic[idx].atom);
+            break;
         case OP_FMT_atom_u8:
             printf(" ");
             print_atom(ctx, get_u32(tab + pos));
@@ -30250,6 +34733,123 @@ static void add_eval_variables(JSContext *ctx, JSFunctionDef *s)
     }
 }
 
+static int lazy_name_cmp(const void *a, const void *b, void *opaque)
+{
+    JSAtom a1 = *(const JSAtom *)a;
+    JSAtom b1 = *(const JSAtom *)b;
+    return (a1 > b1) - (a1 < b1);
+}
+
+static BOOL is_lazy_name(JSFunctionDef *s, JSAtom name)
+{
+    int lo, hi, mid;
+
+    lo = 0;
+    hi = s->lazy_name_count - 1;
+    while (lo <= hi) {
+        mid = (lo + hi) >> 1;
+        if (s->lazy_names[mid] == name)
+            return TRUE;
+        if (s->lazy_names[mid] < name)
+            lo = mid + 1;
+        else
+            hi = mid - 1;
+    }
+    return FALSE;
+}
+
+/* Put in the closure of a function whose body was skipped the variables
+   of the enclosing functions it may reference. As for eval(), they are
+   ordered by scope and the 'with' and eval() variable objects are
+   always added. */
+static int add_lazy_closure_variables(JSContext *ctx, JSFunctionDef *s)
+{
+    JSFunctionDef *fd;
+    JSVarDef *vd;
+    int i, j, scope_level, scope_idx;
+    BOOL is_arg_scope;
+
+    /* sort and remove the duplicate names */
+    rqsort(s->lazy_names, s->lazy_name_count, sizeof(s->lazy_names[0]),
+           lazy_name_cmp, NULL);
+    for(i = j = 0; i < s->lazy_name_count; i++) {
+        if (j > 0 && s->lazy_names[j - 1] == s->lazy_names[i])
+            JS_FreeAtom(ctx, s->lazy_names[i]);
+        else
+            s->lazy_names[j++] = s->lazy_names[i];
+    }
+    s->lazy_name_count = j;
+
+    fd = s;
+    for(;;) {
+        scope_level = fd->parent_scope_level;
+        fd = fd->parent;
+        if (!fd)
+            break;
+        if (fd->is_func_expr && fd->func_name != JS_ATOM_NULL &&
+            is_lazy_name(s, fd->func_name))
+            add_func_var(ctx, fd, fd->func_name);
+
+        scope_idx = fd->scopes[scope_level].first;
+        while (scope_idx >= 0) {
+            vd = &fd->vars[scope_idx];
+            if (vd->var_name == JS_ATOM__with_ ||
+                is_lazy_name(s, vd->var_name)) {
+                vd->is_captured = 1;
+                if (get_closure_var(ctx, s, fd, FALSE, scope_idx,
+                                    vd->var_name, vd->is_const,
+                                    vd->is_lexical, vd->var_kind) < 0)
+                    return -1;
+            }
+            scope_idx = vd->scope_next;
+        }
+        is_arg_scope = (scope_idx == ARG_SCOPE_END);
+        if (!is_arg_scope) {
+            for(i = 0; i < fd->arg_count; i++) {
+                vd = &fd->args[i];
+                if (vd->var_name != JS_ATOM_NULL &&
+                    is_lazy_name(s, vd->var_name)) {
+                    vd->is_captured = 1;
+                    if (get_closure_var(ctx, s, fd, TRUE, i, vd->var_name,
+                                        FALSE, FALSE, JS_VAR_NORMAL) < 0)
+                        return -1;
+                }
+            }
+        }
+        for(i = 0; i < fd->var_count; i++) {
+            vd = &fd->vars[i];
+            if (vd->scope_level == 0 &&
+                (!is_arg_scope || is_var_in_arg_scope(vd)) &&
+                (vd->var_name == JS_ATOM__var_ ||
+                 vd->var_name == JS_ATOM__arg_var_ ||
+                 is_lazy_name(s, vd->var_name))) {
+                vd->is_captured = 1;
+                if (get_closure_var(ctx, s, fd, FALSE, i, vd->var_name,
+                                    FALSE, FALSE, JS_VAR_NORMAL) < 0)
+                    return -1;
+            }
+        }
+        if (fd->is_eval) {
+            /* direct eval or module variables (necessarily at the top
+               level) */
+            for (i = 0; i < fd->closure_var_count; i++) {
+                JSClosureVar *cv = &fd->closure_var[i];
+                if (cv->var_name == JS_ATOM__var_ ||
+                    cv->var_name == JS_ATOM__arg_var_ ||
+                    cv->var_name == JS_ATOM__with_ ||
+                    is_lazy_name(s, cv->var_name)) {
+                    if (get_closure_var2(ctx, s, fd, FALSE, cv->is_arg, i,
+                                         cv->var_name, cv->is_const,
+                                         cv->is_lexical, cv->var_kind) < 0)
+                        return -1;
+                }
+            }
+        }
+    }
+    free_lazy_names(ctx, s);
+    return 0;
+}
+
 static void set_closure_from_var(JSContext *ctx, JSClosureVar *cv,
                                  JSVarDef *vd, int var_idx)
 {
@@ -31189,6 +35789,30 @@ static void push_short_int(DynBuf *bc_out, int val)
     dbuf_put_u32(bc_out, val);
 }
 
+#if SHORT_OPCODES
+/* Replace the first opcode of the frequent pairs by a superinstruction
+   which also executes the second one. The code size and the jump
+   targets are unchanged because the second opcode stays in place. */
+static void fuse_opcodes(uint8_t *bc_buf, int bc_len)
+{
+    int pos, pos_next, op, i;
+
+    for(pos = 0; pos < bc_len; pos = pos_next) {
+        op = bc_buf[pos];
+        pos_next = pos + short_opcode_info(op).size;
+        if (pos_next >= bc_len)
+            break;
+        for(i = 0; i < countof(fused_opcodes); i++) {
+            if (fused_opcodes[i][0] == op &&
+                fused_opcodes[i][1] == bc_buf[pos_next]) {
+                bc_buf[pos] = fused_opcodes[i][2];
+                break;
+            }
+        }
+    }
+}
+#endif
+
 static void put_short_code(DynBuf *bc_out, int op, int idx)
 {
 #if SHORT_OPCODES
@@ -32107,6 +36731,8 @@ static __exception int resolve_labels(JSContext *ctx, JSFunctionDef *s)
     }
     js_free(ctx, s->jump_slots);
     s->jump_slots = NULL;
+    if (OPTIMIZE && !dbuf_error(&bc_out))
+        fuse_opcodes(bc_out.buf, bc_out.size);
 #endif
     js_free(ctx, s->label_slots);
     s->label_slots = NULL;
@@ -32355,6 +36981,49 @@ static int add_module_variables(JSContext *ctx, JSFunctionDef *fd)
     return 0;
 }
 
+/* Convert the field access opcodes to their inline cached version. The
+   atoms are moved from the bytecode to the inline caches. Nothing is
+   done if there is not enough memory. */
+static void js_create_inline_caches(JSRuntime *rt, JSFunctionBytecode *b)
+{
+    uint8_t *bc_buf = b->byte_code_buf;
+    int pos, op, ic_count;
+    JSInlineCache *ic;
+
+    ic_count = 0;
+    for(pos = 0; pos < b->byte_code_len; pos += short_opcode_info(op).size) {
+        op = bc_buf[pos];
+        if (op == OP_get_field || op == OP_get_field2 || op == OP_put_field)
+            ic_count++;
+    }
+    if (ic_count == 0)
+        return;
+    ic = js_mallocz_rt(rt, sizeof(ic[0]) * ic_count);
+    if (!ic)
+        return;
+    b->ic = ic;
+    b->ic_count = ic_count;
+    for(pos = 0; pos < b->byte_code_len; pos += short_opcode_info(op).size) {
+        op = bc_buf[pos];
+        switch(op) {
+        case OP_get_field:
+            bc_buf[pos] = OP_get_field_ic;
+            break;
+        case OP_get_field2:
+            bc_buf[pos] = OP_get_field2_ic;
+            break;
+        case OP_put_field:
+            bc_buf[pos] = OP_put_field_ic;
+            break;
+        default:
+            continue;
+        }
+        ic->atom = get_u32(bc_buf + pos + 1);
+        put_u32(bc_buf + pos + 1, ic - b->ic);
+        ic++;
+    }
+}
+
 /* create a function object from a function definition. The function
    definition is freed. All the child functions are also created. It
    must be done this way to resolve all the variables. */
@@ -32400,6 +37069,13 @@ static JSValue js_create_function(JSContext *ctx, JSFunctionDef *fd)
     if (fd->has_eval_call)
         add_eval_variables(ctx, fd);
 
+    /* the same applies to the closure of a function compiled at its
+       first call */
+    if (fd->is_lazy) {
+        if (add_lazy_closure_variables(ctx, fd))
+            goto fail;
+    }
+
     /* add the module global variables in the closure */
     if (fd->module) {
         if (add_module_variables(ctx, fd))
@@ -32561,7 +37237,10 @@ static JSValue js_create_function(JSContext *ctx, JSFunctionDef *fd)
     b->super_allowed = fd->super_allowed;
     b->arguments_allowed = fd->arguments_allowed;
     b->backtrace_barrier = fd->backtrace_barrier;
+    b->is_lazy = fd->is_lazy;
+    b->is_func_expr = fd->is_func_expr;
     b->realm = JS_DupContext(ctx);
+    js_create_inline_caches(ctx->rt, b);
 
     add_gc_object(ctx->rt, &b->header, JS_GC_OBJ_TYPE_FUNCTION_BYTECODE);
     
@@ -32583,6 +37262,17 @@ static JSValue js_create_function(JSContext *ctx, JSFunctionDef *fd)
     return JS_EXCEPTION;
 }
 
+static void js_free_bytecode_atom_map(JSRuntime *rt, JSBytecodeAtomMap *map)
+{
+    uint32_t i;
+
+    if (--map->ref_count > 0)
+        return;
+    for(i = 0; i < map->count; i++)
+        JS_FreeAtomRT(rt, map->atoms[i]);
+    js_free_rt(rt, map);
+}
+
 static void free_function_bytecode(JSRuntime *rt, JSFunctionBytecode *b)
 {
     int i;
@@ -32594,8 +37284,18 @@ static void free_function_bytecode(JSRuntime *rt, JSFunctionBytecode *b)
                JS_AtomGetStrRT(rt, buf, sizeof(buf), b->func_name));
     }
 #endif
-    free_bytecode_atoms(rt, b->byte_code_buf, b->byte_code_len, TRUE);
+    if (b->atom_map) {
+        /* the atoms of the bytecode are held by the map */
+        js_free_bytecode_atom_map(rt, b->atom_map);
+    } else {
+        free_bytecode_atoms(rt, b->byte_code_buf, b->byte_code_len, TRUE);
+    }
 
+    if (b->ic) {
+        for(i = 0; i < b->ic_count; i++)
+            JS_FreeAtomRT(rt, b->ic[i].atom);
+        js_free_rt(rt, b->ic);
+    }
     if (b->vardefs) {
         for(i = 0; i < b->arg_count + b->var_count; i++) {
             JS_FreeAtomRT(rt, b->vardefs[i].var_name);
@@ -32614,7 +37314,8 @@ static void free_function_bytecode(JSRuntime *rt, JSFunctionBytecode *b)
     JS_FreeAtomRT(rt, b->func_name);
     if (b->has_debug) {
         JS_FreeAtomRT(rt, b->debug.filename);
-        js_free_rt(rt, b->debug.pc2line_buf);
+        if (!b->read_only_bytecode)
+            js_free_rt(rt, b->debug.pc2line_buf);
         js_free_rt(rt, b->debug.source);
     }
 
@@ -33204,6 +37905,42 @@ static __exception int js_parse_function_decl2(JSParseState *s,
         }
     }
 
+    /* skip the body if the function can be compiled at its first
+       call. The function compiled by js_compile_lazy_function() is the
+       only child of a direct eval code and must be parsed. */
+    if (s->lazy_functions && s->token.val == '{' &&
+        (func_type == JS_PARSE_FUNC_STATEMENT ||
+         func_type == JS_PARSE_FUNC_VAR ||
+         func_type == JS_PARSE_FUNC_EXPR) &&
+        fd->has_simple_parameter_list &&
+        !(fd->js_mode & JS_MODE_STRIP) &&
+        !(fd->parent->is_eval && fd->parent->eval_type == JS_EVAL_TYPE_DIRECT)) {
+        JSParsePos pos;
+        int ret;
+
+        js_parse_get_pos(s, &pos);
+        ret = js_parse_skip_function_body(s, fd);
+        if (ret < 0)
+            goto fail;
+        if (ret == 0) {
+            /* the source code is needed to compile the function */
+            fd->source_len = s->buf_ptr - ptr;
+            fd->source = js_strndup(ctx, (const char *)ptr, fd->source_len);
+            if (!fd->source)
+                goto fail;
+            if (next_token(s))
+                goto fail;
+            fd->is_lazy = TRUE;
+            /* placeholder for the compiled function */
+            cpool_add(s, JS_UNDEFINED);
+            emit_return(s, FALSE);
+            goto done;
+        }
+        free_lazy_names(ctx, fd);
+        if (js_parse_seek_token(s, &pos))
+            goto fail;
+    }
+
     if (js_parse_expect(s, '{'))
         goto fail;
 
@@ -33552,6 +38289,7 @@ static JSValue __JS_EvalInternal(JSContext *ctx, JSValueConst this_obj,
     fd->module = m;
     s->is_module = (m != NULL);
     s->allow_html_comments = !s->is_module;
+    s->lazy_functions = ((flags & JS_EVAL_FLAG_LAZY) != 0);
 
     push_scope(s); /* body scope */
     fd->body_scope = fd->scope_level;
@@ -33561,6 +38299,17 @@ static JSValue __JS_EvalInternal(JSContext *ctx, JSValueConst this_obj,
     fail:
         free_token(s, &s->token);
         js_free_function_def(ctx, fd);
+        if (s->lazy_functions) {
+            /* the skipped function bodies are only tokenized, so a
+               misinterpreted '/' may be the cause of the error: parse
+               the code again to report the right one */
+            if (m)
+                js_free_module_def(ctx, m);
+            JS_FreeValue(ctx, JS_GetException(ctx));
+            return __JS_EvalInternal(ctx, this_obj, input, input_len,
+                                     filename, flags & ~JS_EVAL_FLAG_LAZY,
+                                     scope_idx);
+        }
         goto fail1;
     }
 
@@ -33588,6 +38337,113 @@ static JSValue __JS_EvalInternal(JSContext *ctx, JSValueConst this_obj,
     return JS_EXCEPTION;
 }
 
+/* Compile a function whose body was skipped by the parser. Its source
+   code is parsed again as the only function of a direct eval code
+   whose closure contains the closure variables of the stub 'b', so the
+   result can be used in place of the stub. It is cached in b->cpool[0]. */
+static JSValue js_compile_lazy_function(JSContext *ctx, JSFunctionBytecode *b)
+{
+    JSParseState s1, *s = &s1;
+    JSFunctionDef *fd, *fd1;
+    JSFunctionBytecode *b1;
+    JSValue fun_obj, func_val;
+    const char *filename;
+    int i, idx;
+
+    if (!JS_IsUndefined(b->cpool[0]))
+        return JS_DupValue(ctx, b->cpool[0]);
+
+    filename = JS_AtomToCString(ctx, b->debug.filename);
+    if (!filename)
+        return JS_EXCEPTION;
+    js_parse_init(ctx, s, b->debug.source, b->debug.source_len, filename);
+    s->line_num = b->debug.line_num;
+    s->lazy_functions = TRUE;
+    fd = js_new_function_def(ctx, NULL, TRUE, FALSE, filename,
+                             b->debug.line_num);
+    if (!fd)
+        goto fail1;
+    s->cur_func = fd;
+    fd->eval_type = JS_EVAL_TYPE_DIRECT;
+    fd->has_this_binding = FALSE;
+    fd->js_mode = b->js_mode;
+    fd->func_name = JS_DupAtom(ctx, JS_ATOM__eval_);
+    for(i = 0; i < b->closure_var_count; i++) {
+        JSClosureVar *cv = &b->closure_var[i];
+        if (add_closure_var(ctx, fd, FALSE, cv->is_arg, i, cv->var_name,
+                            cv->is_const, cv->is_lexical, cv->var_kind) < 0)
+            goto fail;
+    }
+    push_scope(s); /* body scope */
+    fd->body_scope = fd->scope_level;
+
+    if (next_token(s))
+        goto fail;
+    if (js_parse_function_decl2(s, JS_PARSE_FUNC_EXPR, JS_FUNC_NORMAL,
+                                JS_ATOM_NULL, s->token.ptr,
+                                s->token.line_num, JS_PARSE_EXPORT_NONE,
+                                &fd1))
+        goto fail;
+    if (s->token.val != TOK_EOF) {
+        js_parse_error(s, "unexpected token after the function body");
+        goto fail;
+    }
+    emit_op(s, OP_drop);
+    emit_op(s, OP_return_undef);
+
+    /* function declarations reference their name in the parent scope */
+    fd1->is_func_expr = b->is_func_expr;
+    /* the closure variables of the function match the ones of the stub */
+    for(i = 0; i < b->closure_var_count; i++) {
+        JSClosureVar *cv = &b->closure_var[i];
+        if (add_closure_var(ctx, fd1, FALSE, cv->is_arg, i, cv->var_name,
+                            cv->is_const, cv->is_lexical, cv->var_kind) < 0)
+            goto fail;
+    }
+    idx = fd1->parent_cpool_idx;
+    JS_FreeCString(ctx, filename);
+
+    fun_obj = js_create_function(ctx, fd);
+    if (JS_IsException(fun_obj))
+        return JS_EXCEPTION;
+    b1 = JS_VALUE_GET_PTR(fun_obj);
+    func_val = JS_DupValue(ctx, b1->cpool[idx]);
+    JS_FreeValue(ctx, fun_obj);
+    b1 = JS_VALUE_GET_PTR(func_val);
+    if (b1->closure_var_count != b->closure_var_count) {
+        JS_FreeValue(ctx, func_val);
+        return JS_ThrowInternalError(ctx, "lazy function: closure mismatch");
+    }
+    for(i = 0; i < b->closure_var_count; i++) {
+        b1->closure_var[i].is_local = b->closure_var[i].is_local;
+        b1->closure_var[i].var_idx = b->closure_var[i].var_idx;
+    }
+    JS_FreeAtom(ctx, b1->func_name);
+    b1->func_name = JS_DupAtom(ctx, b->func_name);
+    b->cpool[0] = JS_DupValue(ctx, func_val);
+    return func_val;
+ fail:
+    free_token(s, &s->token);
+    js_free_function_def(ctx, fd);
+ fail1:
+    JS_FreeCString(ctx, filename);
+    return JS_EXCEPTION;
+}
+
+/* replace the stub of the function object 'p' by the compiled function */
+static JSFunctionBytecode *js_get_lazy_function(JSContext *ctx, JSObject *p)
+{
+    JSFunctionBytecode *b = p->u.func.function_bytecode;
+    JSValue func_val;
+
+    func_val = js_compile_lazy_function(b->realm, b);
+    if (JS_IsException(func_val))
+        return NULL;
+    p->u.func.function_bytecode = JS_VALUE_GET_PTR(func_val);
+    JS_FreeValue(ctx, JS_MKPTR(JS_TAG_FUNCTION_BYTECODE, b));
+    return p->u.func.function_bytecode;
+}
+
 /* the indirection is needed to make 'eval' optional */
 static JSValue JS_EvalInternal(JSContext *ctx, JSValueConst this_obj,
                                const char *input, size_t input_len,
@@ -33783,9 +38639,9 @@ typedef enum BCTagEnum {
 } BCTagEnum;
 
 #ifdef CONFIG_BIGNUM
-#define BC_BASE_VERSION 2
+#define BC_BASE_VERSION 8
 #else
-#define BC_BASE_VERSION 1
+#define BC_BASE_VERSION 7
 #endif
 #define BC_BE_VERSION 0x40
 #ifdef WORDS_BIGENDIAN
@@ -33999,29 +38855,43 @@ static void bc_byte_swap(uint8_t *bc_buf, int bc_len)
 }
 
 static int JS_WriteFunctionBytecode(BCWriterState *s,
-                                    const uint8_t *bc_buf1, int bc_len)
+                                    const JSFunctionBytecode *b)
 {
-    int pos, len, op;
+    int pos, len, op, bc_len;
     JSAtom atom;
     uint8_t *bc_buf;
     uint32_t val;
 
+    bc_len = b->byte_code_len;
     bc_buf = js_malloc(s->ctx, bc_len);
     if (!bc_buf)
         return -1;
-    memcpy(bc_buf, bc_buf1, bc_len);
+    memcpy(bc_buf, b->byte_code_buf, bc_len);
 
     pos = 0;
     while (pos < bc_len) {
         op = bc_buf[pos];
         len = short_opcode_info(op).size;
         switch(short_opcode_info(op).fmt) {
+        case OP_FMT_ic:
+            /* the inline caches are not saved */
+            if (op == OP_get_field_ic)
+                bc_buf[pos] = OP_get_field;
+            else if (op == OP_get_field2_ic)
+                bc_buf[pos] = OP_get_field2;
+            else
+                bc_buf[pos] = OP_put_field;
+            atom = b->ic[get_u32(bc_buf + pos + 1)].atom;
+            if (bc_atom_to_idx(s, &val, atom))
+                goto fail;
+            put_u32(bc_buf + pos + 1, val);
+            break;
         case OP_FMT_atom:
         case OP_FMT_atom_u8:
         case OP_FMT_atom_u16:
         case OP_FMT_atom_label_u8:
         case OP_FMT_atom_label_u16:
-            atom = get_u32(bc_buf + pos + 1);
+            atom = js_bytecode_atom(b, get_u32(bc_buf + pos + 1));
             if (bc_atom_to_idx(s, &val, atom))
                 goto fail;
             put_u32(bc_buf + pos + 1, val);
@@ -34201,6 +39071,18 @@ static int JS_WriteFunctionTag(BCWriterState *s, JSValueConst obj)
     uint32_t flags;
     int idx, i;
     
+    if (b->is_lazy) {
+        JSValue func_val;
+        int ret;
+        /* write the compiled function instead of the stub */
+        func_val = js_compile_lazy_function(s->ctx, b);
+        if (JS_IsException(func_val))
+            return -1;
+        ret = JS_WriteFunctionTag(s, func_val);
+        JS_FreeValue(s->ctx, func_val);
+        return ret;
+    }
+
     bc_put_u8(s, BC_TAG_FUNCTION_BYTECODE);
     flags = idx = 0;
     bc_set_flags(&flags, &idx, b->has_prototype, 1);
@@ -34259,7 +39141,7 @@ static int JS_WriteFunctionTag(BCWriterState *s, JSValueConst obj)
         bc_put_u8(s, flags);
     }
     
-    if (JS_WriteFunctionBytecode(s, b->byte_code_buf, b->byte_code_len))
+    if (JS_WriteFunctionBytecode(s, b))
         goto fail;
     
     if (b->has_debug) {
@@ -34491,6 +39373,16 @@ static int JS_WriteObjectRec(BCWriterState *s, JSValueConst obj)
             JS_WriteString(s, p);
         }
         break;
+    case JS_TAG_STRING_ROPE:
+        {
+            JSValue str = js_linearize_rope(s->ctx, obj);
+            if (JS_IsException(str))
+                goto fail;
+            bc_put_u8(s, BC_TAG_STRING);
+            JS_WriteString(s, JS_VALUE_GET_STRING(str));
+            JS_FreeValue(s->ctx, str);
+        }
+        break;
     case JS_TAG_FUNCTION_BYTECODE:
         if (!s->allow_bytecode)
             goto invalid_tag;
@@ -34687,6 +39579,7 @@ typedef struct BCReaderState {
     uint32_t first_atom;
     uint32_t idx_to_atom_count;
     JSAtom *idx_to_atom;
+    JSBytecodeAtomMap *atom_map; /* for read-only bytecode */
     int error_state;
     BOOL allow_sab : 8;
     BOOL allow_bytecode : 8;
@@ -34928,6 +39821,9 @@ static int JS_ReadFunctionBytecode(BCReaderState *s, JSFunctionBytecode *b,
             return bc_read_error_end(s);
         bc_buf = (uint8_t *)s->ptr;
         s->ptr += bc_len;
+        b->atom_map = s->atom_map;
+        if (b->atom_map)
+            b->atom_map->ref_count++;
     } else {
         bc_buf = (void *)((uint8_t*)b + byte_code_offset);
         if (bc_get_buf(s, bc_buf, bc_len))
@@ -34946,7 +39842,15 @@ static int JS_ReadFunctionBytecode(BCReaderState *s, JSFunctionBytecode *b,
         case OP_FMT_atom_label_u8:
         case OP_FMT_atom_label_u16:
             idx = get_u32(bc_buf + pos + 1);
-            if (s->is_rom_data) {
+            if (s->atom_map) {
+                /* the atom is translated when the bytecode is executed */
+                if (!__JS_AtomIsTaggedInt(idx) && idx >= s->first_atom &&
+                    idx - s->first_atom >= s->idx_to_atom_count) {
+                    JS_ThrowSyntaxError(s->ctx, "invalid atom index (pos=%u)",
+                                        (unsigned int)(s->ptr - s->buf_start));
+                    return s->error_state = -1;
+                }
+            } else if (s->is_rom_data) {
                 /* just increment the reference count of the atom */
                 JS_DupAtom(s->ctx, (JSAtom)idx);
             } else {
@@ -35263,6 +40167,8 @@ static JSValue JS_ReadFunctionTag(BCReaderState *s)
         bc_read_trace(s, "bytecode {\n");
         if (JS_ReadFunctionBytecode(s, b, byte_code_offset, b->byte_code_len))
             goto fail;
+        if (!b->read_only_bytecode)
+            js_create_inline_caches(ctx->rt, b);
         bc_read_trace(s, "}\n");
     }
     if (b->has_debug) {
@@ -35274,7 +40180,15 @@ static JSValue JS_ReadFunctionTag(BCReaderState *s)
             goto fail;
         if (bc_get_leb128_int(s, &b->debug.pc2line_len))
             goto fail;
-        if (b->debug.pc2line_len) {
+        if (b->debug.pc2line_len && b->read_only_bytecode) {
+            /* directly use the input buffer */
+            if (unlikely(s->buf_end - s->ptr < b->debug.pc2line_len)) {
+                bc_read_error_end(s);
+                goto fail;
+            }
+            b->debug.pc2line_buf = (uint8_t *)s->ptr;
+            s->ptr += b->debug.pc2line_len;
+        } else if (b->debug.pc2line_len) {
             b->debug.pc2line_buf = js_mallocz(ctx, b->debug.pc2line_len);
             if (!b->debug.pc2line_buf)
                 goto fail;
@@ -35756,6 +40670,7 @@ static int JS_ReadObjectAtoms(BCReaderState *s)
     JSString *p;
     int i;
     JSAtom atom;
+    BOOL relocate = FALSE;
 
     if (bc_get_u8(s, &v8))
         return -1;
@@ -35784,8 +40699,23 @@ static int JS_ReadObjectAtoms(BCReaderState *s)
         if (atom == JS_ATOM_NULL)
             return s->error_state = -1;
         s->idx_to_atom[i] = atom;
-        if (s->is_rom_data && (atom != (i + s->first_atom)))
-            s->is_rom_data = FALSE; /* atoms must be relocated */
+        if (atom != (i + s->first_atom))
+            relocate = TRUE;
+    }
+    if (s->is_rom_data && relocate) {
+        /* the bytecode cannot be modified: its atoms are translated
+           with a table when it is executed */
+        JSBytecodeAtomMap *map;
+        map = js_malloc(s->ctx, sizeof(*map) +
+                        sizeof(map->atoms[0]) * s->idx_to_atom_count);
+        if (!map)
+            return s->error_state = -1;
+        map->ref_count = 1;
+        map->first_atom = s->first_atom;
+        map->count = s->idx_to_atom_count;
+        for(i = 0; i < s->idx_to_atom_count; i++)
+            map->atoms[i] = JS_DupAtom(s->ctx, s->idx_to_atom[i]);
+        s->atom_map = map;
     }
     bc_read_trace(s, "}\n");
     return 0;
@@ -35800,6 +40730,8 @@ static void bc_reader_free(BCReaderState *s)
         }
         js_free(s->ctx, s->idx_to_atom);
     }
+    if (s->atom_map)
+        js_free_bytecode_atom_map(s->ctx->rt, s->atom_map);
     js_free(s->ctx, s->objects);
 }
 
@@ -36180,6 +41112,15 @@ static JSValue JS_ToObject(JSContext *ctx, JSValueConst val)
             JS_DefinePropertyValue(ctx, obj, JS_ATOM_length, JS_NewInt32(ctx, p1->len), 0);
         }
         goto set_value;
+    case JS_TAG_STRING_ROPE:
+        {
+            JSValue str = js_linearize_rope(ctx, val);
+            if (JS_IsException(str))
+                return str;
+            obj = JS_ToObject(ctx, str);
+            JS_FreeValue(ctx, str);
+            return obj;
+        }
     case JS_TAG_BOOL:
         obj = JS_NewObjectClass(ctx, JS_CLASS_BOOLEAN);
         goto set_value;
@@ -40009,7 +44950,7 @@ static JSValue js_string_constructor(JSContext *ctx, JSValueConst new_target,
 
 static JSValue js_thisStringValue(JSContext *ctx, JSValueConst this_val)
 {
-    if (JS_VALUE_GET_TAG(this_val) == JS_TAG_STRING)
+    if (tag_is_string(JS_VALUE_GET_TAG(this_val)))
         return JS_DupValue(ctx, this_val);
 
     if (JS_VALUE_GET_TAG(this_val) == JS_TAG_OBJECT) {
@@ -40538,7 +45479,8 @@ static JSValue js_string___GetSubstitution(JSContext *ctx, JSValueConst this_val
     namedCaptures = argv[4];
     rep = argv[5];
 
-    if (!JS_IsString(rep) || !JS_IsString(str))
+    if (JS_VALUE_GET_TAG(rep) != JS_TAG_STRING ||
+        JS_VALUE_GET_TAG(str) != JS_TAG_STRING)
         return JS_ThrowTypeError(ctx, "not a string");
 
     sp = JS_VALUE_GET_STRING(str);
@@ -41907,8 +46849,8 @@ static void js_regexp_finalizer(JSRuntime *rt, JSValue val)
 }
 
 /* create a string containing the RegExp bytecode */
-static JSValue js_compile_regexp(JSContext *ctx, JSValueConst pattern,
-                                 JSValueConst flags)
+static JSValue js_compile_regexp1(JSContext *ctx, JSValueConst pattern,
+                                  JSValueConst flags)
 {
     const char *str;
     int re_flags, mask;
@@ -41973,6 +46915,151 @@ static JSValue js_compile_regexp(JSContext *ctx, JSValueConst pattern,
     return ret;
 }
 
+/* The compiled regexps are cached in the runtime by (pattern, flags)
+   so that the regexps built again with the same source, for example
+   in a function or by eval(), are not compiled again. The bytecode
+   strings are immutable so they are shared. The least recently used
+   entries are removed when the cache size exceeds
+   JS_REGEXP_CACHE_SIZE_MAX. */
+
+#define JS_REGEXP_CACHE_HASH_BITS 6
+#define JS_REGEXP_CACHE_SIZE_MAX  (32 * 1024)
+
+typedef struct JSRegExpCacheEntry {
+    struct list_head link; /* JSRuntime.regexp_cache_list */
+    struct JSRegExpCacheEntry *hash_next;
+    JSAtom pattern;
+    JSAtom flags;
+    JSString *bytecode;
+} JSRegExpCacheEntry;
+
+static inline uint32_t js_regexp_cache_hash(JSAtom pattern, JSAtom flags)
+{
+    return ((pattern * 31 + flags) * 0x9e3779b1) >>
+        (32 - JS_REGEXP_CACHE_HASH_BITS);
+}
+
+static inline size_t js_regexp_cache_entry_size(JSRegExpCacheEntry *e)
+{
+    return sizeof(*e) + e->bytecode->len;
+}
+
+static void js_regexp_cache_remove(JSRuntime *rt, JSRegExpCacheEntry *e)
+{
+    JSRegExpCacheEntry **pe;
+
+    pe = &rt->regexp_cache_hash[js_regexp_cache_hash(e->pattern, e->flags)];
+    while (*pe != e)
+        pe = &(*pe)->hash_next;
+    *pe = e->hash_next;
+    list_del(&e->link);
+    rt->regexp_cache_size -= js_regexp_cache_entry_size(e);
+    JS_FreeAtomRT(rt, e->pattern);
+    JS_FreeAtomRT(rt, e->flags);
+    JS_FreeValueRT(rt, JS_MKPTR(JS_TAG_STRING, e->bytecode));
+    js_free_rt(rt, e);
+}
+
+static void js_regexp_cache_free(JSRuntime *rt)
+{
+    struct list_head *el, *el1;
+
+    list_for_each_safe(el, el1, &rt->regexp_cache_list) {
+        js_regexp_cache_remove(rt, list_entry(el, JSRegExpCacheEntry, link));
+    }
+    js_free_rt(rt, rt->regexp_cache_hash);
+    rt->regexp_cache_hash = NULL;
+}
+
+static JSRegExpCacheEntry *js_regexp_cache_find(JSRuntime *rt, JSAtom pattern,
+                                                JSAtom flags)
+{
+    JSRegExpCacheEntry *e;
+
+    if (!rt->regexp_cache_hash)
+        return NULL;
+    e = rt->regexp_cache_hash[js_regexp_cache_hash(pattern, flags)];
+    while (e != NULL) {
+        if (e->pattern == pattern && e->flags == flags)
+            return e;
+        e = e->hash_next;
+    }
+    return NULL;
+}
+
+/* nothing is added if not enough memory */
+static void js_regexp_cache_add(JSRuntime *rt, JSAtom pattern, JSAtom flags,
+                                JSValueConst bc)
+{
+    JSRegExpCacheEntry *e, **pe;
+    size_t size;
+
+    size = sizeof(*e) + JS_VALUE_GET_STRING(bc)->len;
+    if (size > JS_REGEXP_CACHE_SIZE_MAX / 4)
+        return;
+    if (!rt->regexp_cache_hash) {
+        rt->regexp_cache_hash =
+            js_mallocz_rt(rt, sizeof(rt->regexp_cache_hash[0]) <<
+                          JS_REGEXP_CACHE_HASH_BITS);
+        if (!rt->regexp_cache_hash)
+            return;
+    }
+    while (rt->regexp_cache_size + size > JS_REGEXP_CACHE_SIZE_MAX) {
+        js_regexp_cache_remove(rt, list_entry(rt->regexp_cache_list.prev,
+                                              JSRegExpCacheEntry, link));
+    }
+    e = js_malloc_rt(rt, sizeof(*e));
+    if (!e)
+        return;
+    e->pattern = JS_DupAtomRT(rt, pattern);
+    e->flags = JS_DupAtomRT(rt, flags);
+    e->bytecode = JS_VALUE_GET_STRING(JS_DupValueRT(rt, bc));
+    pe = &rt->regexp_cache_hash[js_regexp_cache_hash(pattern, flags)];
+    e->hash_next = *pe;
+    *pe = e;
+    list_add(&e->link, &rt->regexp_cache_list);
+    rt->regexp_cache_size += size;
+}
+
+static JSValue js_compile_regexp(JSContext *ctx, JSValueConst pattern,
+                                 JSValueConst flags)
+{
+    JSRuntime *rt = ctx->rt;
+    JSRegExpCacheEntry *e;
+    JSAtom pattern_atom, flags_atom;
+    JSValue bc;
+
+    /* no cache if ToString() must be called on the flags */
+    if (JS_VALUE_GET_TAG(pattern) != JS_TAG_STRING ||
+        (!JS_IsUndefined(flags) && JS_VALUE_GET_TAG(flags) != JS_TAG_STRING))
+        return js_compile_regexp1(ctx, pattern, flags);
+    pattern_atom = JS_NewAtomStr(ctx, JS_VALUE_GET_STRING(JS_DupValue(ctx, pattern)));
+    if (pattern_atom == JS_ATOM_NULL)
+        return js_compile_regexp1(ctx, pattern, flags);
+    if (JS_IsUndefined(flags)) {
+        flags_atom = JS_ATOM_empty_string;
+    } else {
+        flags_atom = JS_NewAtomStr(ctx, JS_VALUE_GET_STRING(JS_DupValue(ctx, flags)));
+        if (flags_atom == JS_ATOM_NULL) {
+            JS_FreeAtom(ctx, pattern_atom);
+            return js_compile_regexp1(ctx, pattern, flags);
+        }
+    }
+    e = js_regexp_cache_find(rt, pattern_atom, flags_atom);
+    if (e) {
+        list_del(&e->link);
+        list_add(&e->link, &rt->regexp_cache_list);
+        bc = JS_DupValue(ctx, JS_MKPTR(JS_TAG_STRING, e->bytecode));
+    } else {
+        bc = js_compile_regexp1(ctx, pattern, flags);
+        if (!JS_IsException(bc))
+            js_regexp_cache_add(rt, pattern_atom, flags_atom, bc);
+    }
+    JS_FreeAtom(ctx, pattern_atom);
+    JS_FreeAtom(ctx, flags_atom);
+    return bc;
+}
+
 /* create a RegExp object from a string containing the RegExp bytecode
    and the source pattern */
 static JSValue js_regexp_constructor_internal(JSContext *ctx, JSValueConst ctor,
@@ -43485,12 +48572,596 @@ static JSValue json_parse_value(JSParseState *s)
     return JS_EXCEPTION;
 }
 
+/* Fast reader for JSON.parse(). It accepts only the strict JSON
+   syntax: on any error or unusual construct, it gives up and the
+   input is parsed again by json_parse_value() which reports the
+   error. The strings are scanned 8 bytes at a time. The values of an
+   object or array are collected on a stack so that it is created in
+   one step with its final shape, and the shape transitions of the
+   plain keys are cached in the context so that the objects with the
+   same keys as a previous one do not hash their keys. */
+
+#define JSON_SHAPE_CACHE_SIZE 32
+
+typedef struct JSONShapeCacheEntry {
+    JSShape *sh;
+    JSShape *next_sh; /* sh + the property of the key */
+} JSONShapeCacheEntry;
+
+typedef struct JSONReader {
+    JSContext *ctx;
+    const uint8_t *p;
+    const uint8_t *end; /* *end = '\0' */
+    BOOL fallback; /* TRUE if json_parse_value() must be used */
+    JSValue *stack;
+    uint32_t stack_len;
+    uint32_t stack_size;
+} JSONReader;
+
+static void json_shape_cache_mark(JSRuntime *rt, JSContext *ctx,
+                                  JS_MarkFunc *mark_func)
+{
+    JSONShapeCacheEntry *e;
+    int i;
+
+    if (!ctx->json_shape_cache)
+        return;
+    for(i = 0; i < JSON_SHAPE_CACHE_SIZE; i++) {
+        e = &ctx->json_shape_cache[i];
+        if (e->sh) {
+            mark_func(rt, &e->sh->header);
+            mark_func(rt, &e->next_sh->header);
+        }
+    }
+}
+
+static void json_shape_cache_free(JSRuntime *rt, JSContext *ctx)
+{
+    JSONShapeCacheEntry *e;
+    int i;
+
+    if (!ctx->json_shape_cache)
+        return;
+    for(i = 0; i < JSON_SHAPE_CACHE_SIZE; i++) {
+        e = &ctx->json_shape_cache[i];
+        if (e->sh) {
+            js_free_shape(rt, e->sh);
+            js_free_shape(rt, e->next_sh);
+        }
+    }
+    js_free_rt(rt, ctx->json_shape_cache);
+    ctx->json_shape_cache = NULL;
+}
+
+static JSONShapeCacheEntry *json_shape_cache_find(JSContext *ctx,
+                                                  JSShape *sh,
+                                                  const uint8_t *key,
+                                                  int len)
+{
+    uintptr_t h;
+
+    h = (uintptr_t)sh;
+    h = (h >> 4) ^ (h >> 10) ^ (len * 7);
+    if (len > 0)
+        h ^= key[0] * 3;
+    return &ctx->json_shape_cache[h & (JSON_SHAPE_CACHE_SIZE - 1)];
+}
+
+static JSValue json_read_fallback(JSONReader *r)
+{
+    r->fallback = TRUE;
+    return JS_EXCEPTION;
+}
+
+static inline const uint8_t *json_skip_ws(JSONReader *r, const uint8_t *p)
+{
+    uint64_t v;
+
+    for(;;) {
+        switch(*p) {
+        case ' ':
+            /* indentation */
+            while (p + 8 <= r->end) {
+                memcpy(&v, p, 8);
+                if (v != JSON_ONES * ' ')
+                    break;
+                p += 8;
+            }
+            /* fall thru */
+        case '\t':
+        case '\n':
+        case '\r':
+            p++;
+            break;
+        default:
+            return p;
+        }
+    }
+}
+
+/* return the first '"', '\\', control or non-ASCII character */
+static inline const uint8_t *json_scan_string(JSONReader *r, const uint8_t *p)
+{
+    uint64_t v, m, q, bs;
+
+    while (p + 8 <= r->end) {
+        memcpy(&v, p, 8);
+        /* the high bit of a byte of m is set if it is '"', '\\',
+           < 0x20 or >= 0x80 (there can be false positives after the
+           first match, so the exact position is found below) */
+        q = v ^ (JSON_ONES * '"');
+        bs = v ^ (JSON_ONES * '\\');
+        m = ((q - JSON_ONES) & ~q) | ((bs - JSON_ONES) & ~bs) |
+            (v - JSON_ONES * 0x20) | v;
+        if (m & JSON_HIGHS)
+            break;
+        p += 8;
+    }
+    while (*p != '"' && *p != '\\' && *p >= 0x20 && *p < 0x80)
+        p++;
+    return p;
+}
+
+/* 'p' points after the opening quote and 'p1' to the first character
+   which is not in a plain ASCII string */
+static JSValue json_read_string_escaped(JSONReader *r, const uint8_t *p,
+                                        const uint8_t *p1)
+{
+    StringBuffer b_s, *b = &b_s;
+    const uint8_t *p_next;
+    uint32_t c;
+    int h, i;
+
+    if (string_buffer_init(r->ctx, b, p1 - p + 16))
+        return JS_EXCEPTION;
+    if (string_buffer_write8(b, p, p1 - p))
+        goto fail;
+    p = p1;
+    for(;;) {
+        c = *p;
+        if (c == '"')
+            break;
+        if (c == '\\') {
+            c = p[1];
+            switch(c) {
+            case '"':
+            case '\\':
+            case '/':
+                break;
+            case 'b':
+                c = '\b';
+                break;
+            case 'f':
+                c = '\f';
+                break;
+            case 'n':
+                c = '\n';
+                break;
+            case 'r':
+                c = '\r';
+                break;
+            case 't':
+                c = '\t';
+                break;
+            case 'u':
+                c = 0;
+                for(i = 0; i < 4; i++) {
+                    h = from_hex(p[2 + i]);
+                    if (h < 0)
+                        goto fallback;
+                    c = (c << 4) | h;
+                }
+                p += 4;
+                break;
+            default:
+                goto fallback;
+            }
+            p += 2;
+        } else if (c >= 0x80) {
+            c = unicode_from_utf8(p, UTF8_CHAR_LEN_MAX, &p_next);
+            if (c > 0x10FFFF)
+                goto fallback;
+            p = p_next;
+        } else if (c >= 0x20) {
+            p1 = json_scan_string(r, p);
+            if (string_buffer_write8(b, p, p1 - p))
+                goto fail;
+            p = p1;
+            continue;
+        } else {
+            goto fallback;
+        }
+        if (string_buffer_putc(b, c))
+            goto fail;
+    }
+    r->p = p + 1;
+    return string_buffer_end(b);
+ fallback:
+    r->fallback = TRUE;
+ fail:
+    string_buffer_free(b);
+    return JS_EXCEPTION;
+}
+
+/* r->p points to the opening quote */
+static JSValue json_read_string(JSONReader *r)
+{
+    const uint8_t *p, *p1;
+
+    p = r->p + 1;
+    p1 = json_scan_string(r, p);
+    if (likely(*p1 == '"')) {
+        r->p = p1 + 1;
+        return js_new_string8(r->ctx, p, p1 - p);
+    }
+    return json_read_string_escaped(r, p, p1);
+}
+
+static JSValue json_read_number(JSONReader *r)
+{
+    const uint8_t *p, *p_start;
+    uint32_t v;
+    int n;
+    JSValue val;
+
+    p = p_start = r->p;
+    if (*p == '-') {
+        p++;
+        if (!is_digit(*p))
+            return json_read_fallback(r);
+        if (*p == '0')
+            goto slow_path; /* -0 */
+    } else if (*p == '0') {
+        if (is_digit(p[1]))
+            return json_read_fallback(r);
+    }
+    v = 0;
+    for(n = 0; n < 9 && is_digit(*p); n++)
+        v = v * 10 + (*p++ - '0');
+    if (is_digit(*p) || *p == '.' || *p == 'e' || *p == 'E')
+        goto slow_path;
+    r->p = p;
+    return JS_NewInt32(r->ctx, *p_start == '-' ? -(int32_t)v : v);
+ slow_path:
+    /* same conversion as json_next_token() */
+    val = js_atof(r->ctx, (const char *)p_start, (const char **)&p, 10, 0);
+    r->p = p;
+    return val;
+}
+
+static int json_push_value(JSONReader *r, JSValue val)
+{
+    JSValue *new_stack;
+    uint32_t new_size;
+
+    if (unlikely(r->stack_len >= r->stack_size)) {
+        new_size = max_int(r->stack_size * 3 / 2, 16);
+        new_stack = js_realloc(r->ctx, r->stack,
+                               sizeof(r->stack[0]) * new_size);
+        if (!new_stack) {
+            JS_FreeValue(r->ctx, val);
+            return -1;
+        }
+        r->stack = new_stack;
+        r->stack_size = new_size;
+    }
+    r->stack[r->stack_len++] = val;
+    return 0;
+}
+
+static void json_pop_values(JSONReader *r, uint32_t base)
+{
+    while (r->stack_len > base)
+        JS_FreeValue(r->ctx, r->stack[--r->stack_len]);
+}
+
+static JSValue json_read_value(JSONReader *r);
+
+/* Return the shape 'sh' + the property 'key' of length 'len', or
+   'atom' if 'key' is NULL. If the property is already present,
+   '*pidx' is set to its index and 'sh' is returned. 'sh' and 'atom'
+   are freed. Return NULL in case of exception. */
+static JSShape *json_add_key(JSONReader *r, JSShape *sh, const uint8_t *key,
+                             int len, JSAtom atom, uint32_t *pidx)
+{
+    JSContext *ctx = r->ctx;
+    JSONShapeCacheEntry *e = NULL;
+    JSShape *next_sh;
+    JSShapeProperty *pr;
+    JSString *str;
+    intptr_t h;
+
+    if (key) {
+        e = json_shape_cache_find(ctx, sh, key, len);
+        if (e->sh == sh) {
+            pr = &e->next_sh->prop[sh->prop_count];
+            if (!__JS_AtomIsTaggedInt(pr->atom)) {
+                str = ctx->rt->atom_array[pr->atom];
+                if (str->len == len && !str->is_wide_char &&
+                    !memcmp(str->u.str8, key, len)) {
+                    *pidx = sh->prop_count;
+                    next_sh = js_dup_shape(e->next_sh);
+                    js_free_shape(ctx->rt, sh);
+                    return next_sh;
+                }
+            }
+        }
+        atom = JS_NewAtomLen(ctx, (const char *)key, len);
+        if (atom == JS_ATOM_NULL)
+            goto fail;
+    }
+
+    /* duplicate key: the last value is used */
+    h = (uintptr_t)atom & sh->prop_hash_mask;
+    h = prop_hash_end(sh)[-h - 1];
+    while (h) {
+        pr = &sh->prop[h - 1];
+        if (pr->atom == atom) {
+            *pidx = h - 1;
+            JS_FreeAtom(ctx, atom);
+            return sh;
+        }
+        h = pr->hash_next;
+    }
+
+    *pidx = sh->prop_count;
+    next_sh = find_hashed_shape_prop(ctx->rt, sh, atom, JS_PROP_C_W_E);
+    if (next_sh) {
+        next_sh = js_dup_shape(next_sh);
+    } else {
+        /* same as add_property() with a shared shape */
+        next_sh = js_clone_shape(ctx, sh);
+        if (!next_sh)
+            goto fail_atom;
+        next_sh->is_hashed = TRUE;
+        js_shape_hash_link(ctx->rt, next_sh);
+        if (add_shape_property(ctx, &next_sh, NULL, atom, JS_PROP_C_W_E)) {
+            js_free_shape(ctx->rt, next_sh);
+            goto fail_atom;
+        }
+    }
+    JS_FreeAtom(ctx, atom);
+    if (e) {
+        if (e->sh) {
+            js_free_shape(ctx->rt, e->sh);
+            js_free_shape(ctx->rt, e->next_sh);
+        }
+        e->sh = js_dup_shape(sh);
+        e->next_sh = js_dup_shape(next_sh);
+    }
+    js_free_shape(ctx->rt, sh);
+    return next_sh;
+ fail_atom:
+    JS_FreeAtom(ctx, atom);
+ fail:
+    js_free_shape(ctx->rt, sh);
+    return NULL;
+}
+
+/* r->p points to '{' */
+static JSValue json_read_object(JSONReader *r)
+{
+    JSContext *ctx = r->ctx;
+    JSObject *proto, *p;
+    JSShape *sh;
+    JSValue val, obj;
+    JSAtom atom;
+    const uint8_t *key, *key_end;
+    uint32_t base, idx, i;
+
+    base = r->stack_len;
+    proto = JS_VALUE_GET_OBJ(ctx->class_proto[JS_CLASS_OBJECT]);
+    sh = find_hashed_shape_proto(ctx->rt, proto);
+    if (likely(sh)) {
+        sh = js_dup_shape(sh);
+    } else {
+        sh = js_new_shape(ctx, proto);
+        if (!sh)
+            return JS_EXCEPTION;
+    }
+    r->p = json_skip_ws(r, r->p + 1);
+    if (*r->p != '}') {
+        for(;;) {
+            if (*r->p != '"')
+                goto fallback;
+            key = r->p + 1;
+            key_end = json_scan_string(r, key);
+            if (likely(*key_end == '"')) {
+                r->p = key_end + 1;
+                atom = JS_ATOM_NULL;
+            } else {
+                val = json_read_string_escaped(r, key, key_end);
+                if (JS_IsException(val))
+                    goto fail;
+                atom = JS_NewAtomStr(ctx, JS_VALUE_GET_STRING(val));
+                if (atom == JS_ATOM_NULL)
+                    goto fail;
+                key = NULL;
+            }
+            sh = json_add_key(r, sh, key, key ? key_end - key : 0, atom,
+                              &idx);
+            if (!sh)
+                goto fail;
+            r->p = json_skip_ws(r, r->p);
+            if (*r->p != ':')
+                goto fallback;
+            r->p++;
+            val = json_read_value(r);
+            if (JS_IsException(val))
+                goto fail;
+            if (idx < r->stack_len - base) {
+                JS_FreeValue(ctx, r->stack[base + idx]);
+                r->stack[base + idx] = val;
+            } else if (json_push_value(r, val)) {
+                goto fail;
+            }
+            r->p = json_skip_ws(r, r->p);
+            if (*r->p == '}')
+                break;
+            if (*r->p != ',')
+                goto fallback;
+            r->p = json_skip_ws(r, r->p + 1);
+        }
+    }
+    r->p++;
+    obj = JS_NewObjectFromShape(ctx, sh, JS_CLASS_OBJECT);
+    if (JS_IsException(obj)) {
+        json_pop_values(r, base);
+        return obj;
+    }
+    p = JS_VALUE_GET_OBJ(obj);
+    for(i = base; i < r->stack_len; i++)
+        p->prop[i - base].u.value = r->stack[i];
+    r->stack_len = base;
+    return obj;
+ fallback:
+    r->fallback = TRUE;
+ fail:
+    js_free_shape_null(ctx->rt, sh);
+    json_pop_values(r, base);
+    return JS_EXCEPTION;
+}
+
+/* r->p points to '[' */
+static JSValue json_read_array(JSONReader *r)
+{
+    JSContext *ctx = r->ctx;
+    JSObject *p;
+    JSValue val, obj;
+    JSValue *values;
+    uint32_t base, len;
+
+    base = r->stack_len;
+    r->p = json_skip_ws(r, r->p + 1);
+    if (*r->p != ']') {
+        for(;;) {
+            val = json_read_value(r);
+            if (JS_IsException(val))
+                goto fail;
+            if (json_push_value(r, val))
+                goto fail;
+            r->p = json_skip_ws(r, r->p);
+            if (*r->p == ']')
+                break;
+            if (*r->p != ',') {
+                r->fallback = TRUE;
+                goto fail;
+            }
+            r->p++;
+        }
+    }
+    r->p++;
+    obj = JS_NewArray(ctx);
+    if (JS_IsException(obj))
+        goto fail;
+    len = r->stack_len - base;
+    if (len > 0) {
+        values = js_malloc(ctx, sizeof(values[0]) * len);
+        if (!values) {
+            JS_FreeValue(ctx, obj);
+            goto fail;
+        }
+        memcpy(values, r->stack + base, sizeof(values[0]) * len);
+        p = JS_VALUE_GET_OBJ(obj);
+        p->u.array.u.values = values;
+        p->u.array.u1.size = len;
+        p->u.array.count = len;
+        p->prop[0].u.value = JS_NewInt32(ctx, len);
+        r->stack_len = base;
+    }
+    return obj;
+ fail:
+    json_pop_values(r, base);
+    return JS_EXCEPTION;
+}
+
+static JSValue json_read_value(JSONReader *r)
+{
+    const uint8_t *p;
+
+    if (js_check_stack_overflow(r->ctx->rt, 0))
+        return json_read_fallback(r);
+    p = r->p = json_skip_ws(r, r->p);
+    switch(*p) {
+    case '{':
+        return json_read_object(r);
+    case '[':
+        return json_read_array(r);
+    case '"':
+        return json_read_string(r);
+    case 't':
+        if (p[1] == 'r' && p[2] == 'u' && p[3] == 'e') {
+            r->p = p + 4;
+            return JS_TRUE;
+        }
+        break;
+    case 'f':
+        if (p[1] == 'a' && p[2] == 'l' && p[3] == 's' && p[4] == 'e') {
+            r->p = p + 5;
+            return JS_FALSE;
+        }
+        break;
+    case 'n':
+        if (p[1] == 'u' && p[2] == 'l' && p[3] == 'l') {
+            r->p = p + 4;
+            return JS_NULL;
+        }
+        break;
+    case '-':
+    case '0': case '1': case '2': case '3': case '4':
+    case '5': case '6': case '7': case '8': case '9':
+        return json_read_number(r);
+    default:
+        break;
+    }
+    return json_read_fallback(r);
+}
+
+/* Return JS_EXCEPTION with r->fallback = TRUE if json_parse_value()
+   must be used */
+static JSValue json_read(JSContext *ctx, JSONReader *r,
+                         const char *buf, size_t buf_len)
+{
+    JSValue val;
+
+    r->ctx = ctx;
+    r->p = (const uint8_t *)buf;
+    r->end = r->p + buf_len;
+    r->fallback = FALSE;
+    r->stack = NULL;
+    r->stack_len = 0;
+    r->stack_size = 0;
+    if (!ctx->json_shape_cache) {
+        ctx->json_shape_cache = js_mallocz(ctx, sizeof(JSONShapeCacheEntry) *
+                                           JSON_SHAPE_CACHE_SIZE);
+        if (!ctx->json_shape_cache)
+            return JS_EXCEPTION;
+    }
+    val = json_read_value(r);
+    js_free(ctx, r->stack);
+    if (JS_IsException(val))
+        return val;
+    if (json_skip_ws(r, r->p) != r->end) {
+        JS_FreeValue(ctx, val);
+        return json_read_fallback(r);
+    }
+    return val;
+}
+
 JSValue JS_ParseJSON2(JSContext *ctx, const char *buf, size_t buf_len,
                       const char *filename, int flags)
 {
     JSParseState s1, *s = &s1;
     JSValue val = JS_UNDEFINED;
 
+    if (!(flags & JS_PARSE_JSON_EXT)) {
+        JSONReader r;
+        val = json_read(ctx, &r, buf, buf_len);
+        if (!JS_IsException(val) || !r.fallback)
+            return val;
+        val = JS_UNDEFINED;
+    }
+
     js_parse_init(ctx, s, buf, buf_len, filename);
     s->ext_json = ((flags & JS_PARSE_JSON_EXT) != 0);
     if (json_next_token(s))
@@ -43620,17 +49291,78 @@ static JSValue js_json_parse(JSContext *ctx, JSValueConst this_val,
 
 typedef struct JSONStringifyContext {
     JSValueConst replacer_func;
-    JSValue stack;
+    JSObject **stack; /* objects being serialized, to detect cycles */
+    int stack_len;
+    int stack_size;
     JSValue property_list;
     JSValue gap;
     JSValue empty;
     StringBuffer *b;
 } JSONStringifyContext;
 
-static JSValue JS_ToQuotedStringFree(JSContext *ctx, JSValue val) {
-    JSValue r = JS_ToQuotedString(ctx, val);
-    JS_FreeValue(ctx, val);
-    return r;
+/* Return TRUE if 'p' is an ordinary object whose enumerable string
+   keyed properties are all data properties in creation order (no
+   array index), or a fast array, and if neither 'p' nor its
+   prototypes have a toJSON property. JSON.stringify() then reads its
+   properties directly from its shape. The answer is cached by
+   JSShape.ic_id, which changes whenever the shape is modified, and
+   the cache is emptied when a prototype is modified. */
+static BOOL js_json_is_plain(JSContext *ctx, JSObject *p)
+{
+    JSRuntime *rt = ctx->rt;
+    JSShape *sh = p->shape;
+    JSShapeProperty *prs;
+    JSObject *proto;
+    uint32_t *pid, idx;
+    int i;
+
+    /* a hashed shape is shared so that it is not modified in place
+       (see js_json_plain_object_to_str()) */
+    if (p->class_id == JS_CLASS_OBJECT) {
+        if (!sh->is_hashed)
+            return FALSE;
+    } else if (p->class_id != JS_CLASS_ARRAY || !p->fast_array) {
+        return FALSE;
+    }
+    if (unlikely(ctx->json_plain_epoch != rt->proto_epoch)) {
+        memset(ctx->json_plain_shapes, 0, sizeof(ctx->json_plain_shapes));
+        ctx->json_plain_epoch = rt->proto_epoch;
+    }
+    pid = &ctx->json_plain_shapes[sh->ic_id &
+                                  (JSON_PLAIN_SHAPE_CACHE_SIZE - 1)];
+    if (*pid == sh->ic_id)
+        return TRUE;
+    for(i = 0, prs = get_shape_prop(sh); i < sh->prop_count; i++, prs++) {
+        if (prs->atom == JS_ATOM_NULL || !(prs->flags & JS_PROP_ENUMERABLE))
+            continue;
+        if ((prs->flags & JS_PROP_TMASK) != JS_PROP_NORMAL ||
+            JS_AtomIsArrayIndex(ctx, &idx, prs->atom))
+            return FALSE;
+    }
+    if (find_own_property1(p, JS_ATOM_toJSON))
+        return FALSE;
+    for(proto = sh->proto; proto != NULL; proto = proto->shape->proto) {
+        /* the modifications of a prototype change proto_epoch */
+        if ((proto->class_id != JS_CLASS_OBJECT &&
+             proto->class_id != JS_CLASS_ARRAY) ||
+            !proto->shape->is_prototype ||
+            find_own_property1(proto, JS_ATOM_toJSON))
+            return FALSE;
+    }
+    *pid = sh->ic_id;
+    return TRUE;
+}
+
+/* return FALSE if 'val' is known to have no toJSON method */
+static BOOL js_json_may_have_tojson(JSContext *ctx, JSValueConst val)
+{
+    if (JS_IsObject(val))
+        return !js_json_is_plain(ctx, JS_VALUE_GET_OBJ(val));
+#ifdef CONFIG_BIGNUM
+    return JS_IsBigInt(ctx, val);   /* XXX: probably useless */
+#else
+    return FALSE;
+#endif
 }
 
 static JSValue js_json_check(JSContext *ctx, JSONStringifyContext *jsc,
@@ -43639,11 +49371,7 @@ static JSValue js_json_check(JSContext *ctx, JSONStringifyContext *jsc,
     JSValue v;
     JSValueConst args[2];
 
-    if (JS_IsObject(val)
-#ifdef CONFIG_BIGNUM
-    ||  JS_IsBigInt(ctx, val)   /* XXX: probably useless */
-#endif
-        ) {
+    if (js_json_may_have_tojson(ctx, val)) {
             JSValue f = JS_GetProperty(ctx, val, JS_ATOM_toJSON);
             if (JS_IsException(f))
                 goto exception;
@@ -43673,6 +49401,7 @@ static JSValue js_json_check(JSContext *ctx, JSONStringifyContext *jsc,
         if (JS_IsFunction(ctx, val))
             break;
     case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
     case JS_TAG_INT:
     case JS_TAG_FLOAT64:
 #ifdef CONFIG_BIGNUM
@@ -43696,6 +49425,70 @@ exception:
     return JS_EXCEPTION;
 }
 
+static int js_json_to_str(JSContext *ctx, JSONStringifyContext *jsc,
+                          JSValueConst holder, JSValue val,
+                          JSValueConst indent);
+
+/* serialize an object for which js_json_is_plain() is true */
+static int js_json_plain_object_to_str(JSContext *ctx,
+                                       JSONStringifyContext *jsc,
+                                       JSValueConst obj, JSValueConst indent,
+                                       JSValueConst indent1, JSValueConst sep,
+                                       JSValueConst sep1)
+{
+    JSObject *p = JS_VALUE_GET_OBJ(obj);
+    JSShape *sh;
+    JSShapeProperty *prs;
+    JSString *key;
+    JSValue v;
+    BOOL has_content;
+    int i;
+
+    /* the keys are those of the initial shape. As it is hashed, it
+       is cloned instead of being modified if a toJSON() method
+       modifies the object. */
+    sh = js_dup_shape(p->shape);
+    string_buffer_putc8(jsc->b, '{');
+    has_content = FALSE;
+    for(i = 0, prs = get_shape_prop(sh); i < sh->prop_count; i++, prs++) {
+        if (prs->atom == JS_ATOM_NULL || !(prs->flags & JS_PROP_ENUMERABLE))
+            continue;
+        key = ctx->rt->atom_array[prs->atom];
+        if (key->atom_type != JS_ATOM_TYPE_STRING)
+            continue;
+        if (likely(p->shape == sh)) {
+            v = JS_DupValue(ctx, p->prop[i].u.value);
+        } else {
+            v = JS_GetProperty(ctx, obj, prs->atom);
+            if (JS_IsException(v))
+                goto fail;
+        }
+        v = js_json_check(ctx, jsc, obj, v, JS_MKPTR(JS_TAG_STRING, key));
+        if (JS_IsException(v))
+            goto fail;
+        if (JS_IsUndefined(v))
+            continue;
+        if (has_content)
+            string_buffer_putc8(jsc->b, ',');
+        string_buffer_concat_value(jsc->b, sep);
+        string_buffer_put_quoted(jsc->b, key);
+        string_buffer_putc8(jsc->b, ':');
+        string_buffer_concat_value(jsc->b, sep1);
+        if (js_json_to_str(ctx, jsc, obj, v, indent1))
+            goto fail;
+        has_content = TRUE;
+    }
+    if (has_content && JS_VALUE_GET_STRING(jsc->gap)->len != 0) {
+        string_buffer_putc8(jsc->b, '\n');
+        string_buffer_concat_value(jsc->b, indent);
+    }
+    js_free_shape(ctx->rt, sh);
+    return string_buffer_putc8(jsc->b, '}');
+ fail:
+    js_free_shape(ctx->rt, sh);
+    return -1;
+}
+
 static int js_json_to_str(JSContext *ctx, JSONStringifyContext *jsc,
                           JSValueConst holder, JSValue val,
                           JSValueConst indent)
@@ -43705,7 +49498,8 @@ static int js_json_to_str(JSContext *ctx, JSONStringifyContext *jsc,
     int64_t i, len;
     int cl, ret;
     BOOL has_content;
-    
+    char buf[JS_DTOA_BUF_SIZE];
+
     indent1 = JS_UNDEFINED;
     sep = JS_UNDEFINED;
     sep1 = JS_UNDEFINED;
@@ -43720,10 +49514,7 @@ static int js_json_to_str(JSContext *ctx, JSONStringifyContext *jsc,
             val = JS_ToStringFree(ctx, val);
             if (JS_IsException(val))
                 goto exception;
-            val = JS_ToQuotedStringFree(ctx, val);
-            if (JS_IsException(val))
-                goto exception;
-            return string_buffer_concat_value_free(jsc->b, val);
+            goto quote_string;
         } else if (cl == JS_CLASS_NUMBER) {
             val = JS_ToNumberFree(ctx, val);
             if (JS_IsException(val))
@@ -43742,12 +49533,11 @@ static int js_json_to_str(JSContext *ctx, JSONStringifyContext *jsc,
             goto exception;
         }
 #endif
-        v = js_array_includes(ctx, jsc->stack, 1, (JSValueConst *)&val);
-        if (JS_IsException(v))
-            goto exception;
-        if (JS_ToBoolFree(ctx, v)) {
-            JS_ThrowTypeError(ctx, "circular reference");
-            goto exception;
+        for(i = 0; i < jsc->stack_len; i++) {
+            if (jsc->stack[i] == p) {
+                JS_ThrowTypeError(ctx, "circular reference");
+                goto exception;
+            }
         }
         indent1 = JS_ConcatString(ctx, JS_DupValue(ctx, indent), JS_DupValue(ctx, jsc->gap));
         if (JS_IsException(indent1))
@@ -43763,9 +49553,10 @@ static int js_json_to_str(JSContext *ctx, JSONStringifyContext *jsc,
             sep = JS_DupValue(ctx, jsc->empty);
             sep1 = JS_DupValue(ctx, jsc->empty);
         }
-        v = js_array_push(ctx, jsc->stack, 1, (JSValueConst *)&val, 0);
-        if (check_exception_free(ctx, v))
+        if (js_resize_array(ctx, (void **)&jsc->stack, sizeof(jsc->stack[0]),
+                            &jsc->stack_size, jsc->stack_len + 1))
             goto exception;
+        jsc->stack[jsc->stack_len++] = p;
         ret = JS_IsArray(ctx, val);
         if (ret < 0)
             goto exception;
@@ -43777,16 +49568,27 @@ static int js_json_to_str(JSContext *ctx, JSONStringifyContext *jsc,
                 if (i > 0)
                     string_buffer_putc8(jsc->b, ',');
                 string_buffer_concat_value(jsc->b, sep);
-                v = JS_GetPropertyInt64(ctx, val, i);
-                if (JS_IsException(v))
-                    goto exception;
-                /* XXX: could do this string conversion only when needed */
-                prop = JS_ToStringFree(ctx, JS_NewInt64(ctx, i));
-                if (JS_IsException(prop))
-                    goto exception;
-                v = js_json_check(ctx, jsc, val, v, prop);
-                JS_FreeValue(ctx, prop);
-                prop = JS_UNDEFINED;
+                /* a toJSON() method may have modified the array */
+                if (cl == JS_CLASS_ARRAY && p->fast_array &&
+                    i < p->u.array.count) {
+                    v = JS_DupValue(ctx, p->u.array.u.values[i]);
+                } else {
+                    v = JS_GetPropertyInt64(ctx, val, i);
+                    if (JS_IsException(v))
+                        goto exception;
+                }
+                if (JS_IsUndefined(jsc->replacer_func) &&
+                    !js_json_may_have_tojson(ctx, v)) {
+                    /* the key is only used by toJSON() and the replacer */
+                    v = js_json_check(ctx, jsc, val, v, JS_UNDEFINED);
+                } else {
+                    prop = JS_ToStringFree(ctx, JS_NewInt64(ctx, i));
+                    if (JS_IsException(prop))
+                        goto exception;
+                    v = js_json_check(ctx, jsc, val, v, prop);
+                    JS_FreeValue(ctx, prop);
+                    prop = JS_UNDEFINED;
+                }
                 if (JS_IsException(v))
                     goto exception;
                 if (JS_IsUndefined(v))
@@ -43799,6 +49601,12 @@ static int js_json_to_str(JSContext *ctx, JSONStringifyContext *jsc,
                 string_buffer_concat_value(jsc->b, indent);
             }
             string_buffer_putc8(jsc->b, ']');
+        } else if (JS_IsUndefined(jsc->replacer_func) &&
+                   JS_IsUndefined(jsc->property_list) &&
+                   js_json_is_plain(ctx, p)) {
+            if (js_json_plain_object_to_str(ctx, jsc, val, indent, indent1,
+                                            sep, sep1))
+                goto exception;
         } else {
             if (!JS_IsUndefined(jsc->property_list))
                 tab = JS_DupValue(ctx, jsc->property_list);
@@ -43824,13 +49632,8 @@ static int js_json_to_str(JSContext *ctx, JSONStringifyContext *jsc,
                 if (!JS_IsUndefined(v)) {
                     if (has_content)
                         string_buffer_putc8(jsc->b, ',');
-                    prop = JS_ToQuotedStringFree(ctx, prop);
-                    if (JS_IsException(prop)) {
-                        JS_FreeValue(ctx, v);
-                        goto exception;
-                    }
                     string_buffer_concat_value(jsc->b, sep);
-                    string_buffer_concat_value(jsc->b, prop);
+                    string_buffer_put_quoted(jsc->b, JS_VALUE_GET_STRING(prop));
                     string_buffer_putc8(jsc->b, ':');
                     string_buffer_concat_value(jsc->b, sep1);
                     if (js_json_to_str(ctx, jsc, val, v, indent1))
@@ -43844,8 +49647,7 @@ static int js_json_to_str(JSContext *ctx, JSONStringifyContext *jsc,
             }
             string_buffer_putc8(jsc->b, '}');
         }
-        if (check_exception_free(ctx, js_array_pop(ctx, jsc->stack, 0, NULL, 0)))
-            goto exception;
+        jsc->stack_len--;
         JS_FreeValue(ctx, val);
         JS_FreeValue(ctx, tab);
         JS_FreeValue(ctx, sep);
@@ -43853,17 +49655,27 @@ static int js_json_to_str(JSContext *ctx, JSONStringifyContext *jsc,
         JS_FreeValue(ctx, indent1);
         JS_FreeValue(ctx, prop);
         return 0;
-    case JS_TAG_STRING:
-        val = JS_ToQuotedStringFree(ctx, val);
+    case JS_TAG_STRING_ROPE:
+        val = JS_ToStringFree(ctx, val);
         if (JS_IsException(val))
             goto exception;
-        goto concat_value;
+        /* fall thru */
+    case JS_TAG_STRING:
+    quote_string:
+        ret = string_buffer_put_quoted(jsc->b, JS_VALUE_GET_STRING(val));
+        JS_FreeValue(ctx, val);
+        return ret;
     case JS_TAG_FLOAT64:
         if (!isfinite(JS_VALUE_GET_FLOAT64(val))) {
             val = JS_NULL;
+            goto concat_value;
         }
-        goto concat_value;
+        js_dtoa1(buf, JS_VALUE_GET_FLOAT64(val), 10, 0, JS_DTOA_VAR_FORMAT);
+        return string_buffer_puts8(jsc->b, buf);
     case JS_TAG_INT:
+        return string_buffer_puts8(jsc->b,
+                                   i64toa(buf + sizeof(buf),
+                                          JS_VALUE_GET_INT(val), 10));
 #ifdef CONFIG_BIGNUM
     case JS_TAG_BIG_FLOAT:
 #endif
@@ -43901,7 +49713,9 @@ JSValue JS_JSONStringify(JSContext *ctx, JSValueConst obj,
     int64_t i, j, n;
 
     jsc->replacer_func = JS_UNDEFINED;
-    jsc->stack = JS_UNDEFINED;
+    jsc->stack = NULL;
+    jsc->stack_len = 0;
+    jsc->stack_size = 0;
     jsc->property_list = JS_UNDEFINED;
     jsc->gap = JS_UNDEFINED;
     jsc->b = &b_s;
@@ -43910,9 +49724,6 @@ JSValue JS_JSONStringify(JSContext *ctx, JSValueConst obj,
     wrapper = JS_UNDEFINED;
 
     string_buffer_init(ctx, jsc->b, 0);
-    jsc->stack = JS_NewArray(ctx);
-    if (JS_IsException(jsc->stack))
-        goto exception;
     if (JS_IsFunction(ctx, replacer)) {
         jsc->replacer_func = replacer;
     } else {
@@ -43976,6 +49787,10 @@ JSValue JS_JSONStringify(JSContext *ctx, JSValueConst obj,
             JS_FreeValue(ctx, space);
             goto exception;
         }
+    } else if (JS_VALUE_GET_TAG(space) == JS_TAG_STRING_ROPE) {
+        space = JS_ToStringFree(ctx, space);
+        if (JS_IsException(space))
+            goto exception;
     }
     if (JS_IsNumber(space)) {
         int n;
@@ -43991,12 +49806,15 @@ JSValue JS_JSONStringify(JSContext *ctx, JSValueConst obj,
     JS_FreeValue(ctx, space);
     if (JS_IsException(jsc->gap))
         goto exception;
-    wrapper = JS_NewObject(ctx);
-    if (JS_IsException(wrapper))
-        goto exception;
-    if (JS_DefinePropertyValue(ctx, wrapper, JS_ATOM_empty_string,
-                               JS_DupValue(ctx, obj), JS_PROP_C_W_E) < 0)
-        goto exception;
+    /* the wrapper is only visible to the replacer */
+    if (!JS_IsUndefined(jsc->replacer_func)) {
+        wrapper = JS_NewObject(ctx);
+        if (JS_IsException(wrapper))
+            goto exception;
+        if (JS_DefinePropertyValue(ctx, wrapper, JS_ATOM_empty_string,
+                                   JS_DupValue(ctx, obj), JS_PROP_C_W_E) < 0)
+            goto exception;
+    }
     val = JS_DupValue(ctx, obj);
                            
     val = js_json_check(ctx, jsc, wrapper, val, jsc->empty);
@@ -44021,7 +49839,7 @@ done:
     JS_FreeValue(ctx, jsc->empty);
     JS_FreeValue(ctx, jsc->gap);
     JS_FreeValue(ctx, jsc->property_list);
-    JS_FreeValue(ctx, jsc->stack);
+    js_free(ctx, jsc->stack);
     return ret;
 }
 
@@ -45282,25 +51100,42 @@ static const JSCFunctionListEntry js_symbol_funcs[] = {
 
 /* Set/Map/WeakSet/WeakMap */
 
+/* The records are stored in insertion order in a dense array and
+   located with an open addressing (linear probing) index table of
+   record indexes. A deleted record stays in the array until the
+   records are compacted, which happens when the array is full or
+   mostly empty. The iterators and forEach() hold a cursor (index of
+   the next record) which is updated when the records are compacted. */
+
+#define MAP_SLOT_EMPTY   ((uint32_t)-1)
+#define MAP_SLOT_DELETED ((uint32_t)-2)
+
 typedef struct JSMapRecord {
-    int ref_count; /* used during enumeration to avoid freeing the record */
-    BOOL empty; /* TRUE if the record is deleted */
-    struct JSMapState *map;
-    struct JSMapRecord *next_weak_ref;
-    struct list_head link;
-    struct list_head hash_link;
-    JSValue key;
+    JSValue key; /* JS_UNINITIALIZED if the record is deleted */
     JSValue value;
+    uint32_t hash;
 } JSMapRecord;
 
+/* for each key of a WeakMap/WeakSet, list of the maps it belongs to */
+typedef struct JSMapWeakRef {
+    struct JSMapState *map;
+    struct JSMapWeakRef *next;
+} JSMapWeakRef;
+
+typedef struct JSMapCursor {
+    struct list_head link; /* JSMapState.cursors */
+    uint32_t pos; /* index of the next record */
+} JSMapCursor;
+
 typedef struct JSMapState {
     BOOL is_weak; /* TRUE if WeakSet/WeakMap */
-    struct list_head records; /* list of JSMapRecord.link */
-    uint32_t record_count;
-    struct list_head *hash_table;
-    uint32_t hash_size; /* must be a power of two */
-    uint32_t record_count_threshold; /* count at which a hash table
-                                        resize is needed */
+    uint32_t record_count; /* number of live records */
+    uint32_t records_used; /* records[0..records_used-1] are used */
+    uint32_t records_size; /* power of two or 0 */
+    JSMapRecord *records;
+    uint32_t *hash_table; /* record index or MAP_SLOT_x */
+    int hash_bits; /* hash table size = 2 * records_size = 1 << hash_bits */
+    struct list_head cursors; /* list of JSMapCursor.link */
 } JSMapState;
 
 #define MAGIC_SET (1 << 0)
@@ -45322,15 +51157,9 @@ static JSValue js_map_constructor(JSContext *ctx, JSValueConst new_target,
     s = js_mallocz(ctx, sizeof(*s));
     if (!s)
         goto fail;
-    init_list_head(&s->records);
+    init_list_head(&s->cursors);
     s->is_weak = is_weak;
     JS_SetOpaque(obj, s);
-    s->hash_size = 1;
-    s->hash_table = js_malloc(ctx, sizeof(s->hash_table[0]) * s->hash_size);
-    if (!s->hash_table)
-        goto fail;
-    init_list_head(&s->hash_table[0]);
-    s->record_count_threshold = 4;
 
     arr = JS_UNDEFINED;
     if (argc > 0)
@@ -45427,8 +51256,7 @@ static JSValueConst map_normalize_key(JSContext *ctx, JSValueConst key)
     return key;
 }
 
-/* XXX: better hash ? */
-static uint32_t map_hash_key(JSContext *ctx, JSValueConst key)
+static uint32_t map_hash_key(JSValueConst key)
 {
     uint32_t tag = JS_VALUE_GET_NORM_TAG(key);
     uint32_t h;
@@ -45442,19 +51270,29 @@ static uint32_t map_hash_key(JSContext *ctx, JSValueConst key)
     case JS_TAG_STRING:
         h = hash_string(JS_VALUE_GET_STRING(key), 0);
         break;
+    case JS_TAG_STRING_ROPE:
+        /* same hash as the linearized string */
+        h = hash_string_rope(key, 0);
+        tag = JS_TAG_STRING;
+        break;
     case JS_TAG_OBJECT:
     case JS_TAG_SYMBOL:
         h = (uintptr_t)JS_VALUE_GET_PTR(key) * 3163;
         break;
     case JS_TAG_INT:
-        d = JS_VALUE_GET_INT(key) * 3163;
-        goto hash_float64;
+        h = JS_VALUE_GET_INT(key);
+        break;
     case JS_TAG_FLOAT64:
         d = JS_VALUE_GET_FLOAT64(key);
+        /* same hash as the equal integer */
+        if (d >= INT32_MIN && d <= INT32_MAX && (int32_t)d == d) {
+            h = (int32_t)d;
+            tag = JS_TAG_INT;
+            break;
+        }
         /* normalize the NaN */
         if (isnan(d))
             d = JS_FLOAT64_NAN;
-    hash_float64:
         u.d = d;
         h = (u.u32[0] ^ u.u32[1]) * 3163;
         break;
@@ -45466,82 +51304,161 @@ static uint32_t map_hash_key(JSContext *ctx, JSValueConst key)
     return h;
 }
 
+/* the index is taken from the high bits of the product so that keys
+   differing only by their high bits (e.g. pointers) are spread */
+static inline uint32_t map_hash_slot(JSMapState *s, uint32_t h)
+{
+    return (h * 0x9e3779b1) >> (32 - s->hash_bits);
+}
+
+/* return the hash table slot of 'key' or -1 if not found */
+static int map_find_slot(JSContext *ctx, JSMapState *s, JSValueConst key,
+                         uint32_t h)
+{
+    uint32_t i, idx, mask;
+    JSMapRecord *mr;
+
+    if (s->record_count == 0)
+        return -1;
+    mask = (1 << s->hash_bits) - 1;
+    for(i = map_hash_slot(s, h);; i = (i + 1) & mask) {
+        idx = s->hash_table[i];
+        if (idx == MAP_SLOT_EMPTY)
+            return -1;
+        if (idx != MAP_SLOT_DELETED) {
+            mr = &s->records[idx];
+            if (mr->hash == h && js_same_value_zero(ctx, mr->key, key))
+                return i;
+        }
+    }
+}
+
 static JSMapRecord *map_find_record(JSContext *ctx, JSMapState *s,
                                     JSValueConst key)
 {
-    struct list_head *el;
-    JSMapRecord *mr;
-    uint32_t h;
-    h = map_hash_key(ctx, key) & (s->hash_size - 1);
-    list_for_each(el, &s->hash_table[h]) {
-        mr = list_entry(el, JSMapRecord, hash_link);
-        if (js_same_value_zero(ctx, mr->key, key))
-            return mr;
+    int slot;
+    slot = map_find_slot(ctx, s, key, map_hash_key(key));
+    if (slot < 0)
+        return NULL;
+    return &s->records[s->hash_table[slot]];
+}
+
+static void map_insert_slot(JSMapState *s, uint32_t h, uint32_t idx)
+{
+    uint32_t i, mask;
+
+    mask = (1 << s->hash_bits) - 1;
+    for(i = map_hash_slot(s, h);; i = (i + 1) & mask) {
+        if (s->hash_table[i] >= MAP_SLOT_DELETED)
+            break;
     }
-    return NULL;
+    s->hash_table[i] = idx;
 }
 
-static void map_hash_resize(JSContext *ctx, JSMapState *s)
+/* remove the deleted records and update the cursors */
+static void map_compact(JSMapState *s)
 {
-    uint32_t new_hash_size, i, h;
-    size_t slack;
-    struct list_head *new_hash_table, *el;
-    JSMapRecord *mr;
+    struct list_head *el;
+    JSMapCursor *c;
+    uint32_t i, j, pos;
 
-    /* XXX: no reporting of memory allocation failure */
-    if (s->hash_size == 1)
-        new_hash_size = 4;
-    else
-        new_hash_size = s->hash_size * 2;
-    new_hash_table = js_realloc2(ctx, s->hash_table,
-                                 sizeof(new_hash_table[0]) * new_hash_size, &slack);
-    if (!new_hash_table)
+    if (s->record_count == s->records_used)
         return;
-    new_hash_size += slack / sizeof(*new_hash_table);
+    list_for_each(el, &s->cursors) {
+        c = list_entry(el, JSMapCursor, link);
+        pos = min_uint32(c->pos, s->records_used);
+        j = 0;
+        for(i = 0; i < pos; i++) {
+            if (!JS_IsUninitialized(s->records[i].key))
+                j++;
+        }
+        c->pos = j;
+    }
+    j = 0;
+    for(i = 0; i < s->records_used; i++) {
+        if (!JS_IsUninitialized(s->records[i].key))
+            s->records[j++] = s->records[i];
+    }
+    s->records_used = j;
+}
 
-    for(i = 0; i < new_hash_size; i++)
-        init_list_head(&new_hash_table[i]);
+/* compact the records and resize the array to 'new_size' records */
+static int map_resize(JSRuntime *rt, JSMapState *s, uint32_t new_size)
+{
+    JSMapRecord *records;
+    uint32_t *hash_table, i;
+    int hash_bits;
 
-    list_for_each(el, &s->records) {
-        mr = list_entry(el, JSMapRecord, link);
-        if (!mr->empty) {
-            h = map_hash_key(ctx, mr->key) & (new_hash_size - 1);
-            list_add_tail(&mr->hash_link, &new_hash_table[h]);
+    hash_bits = 32 - clz32(new_size);
+    hash_table = js_malloc_rt(rt, sizeof(hash_table[0]) << hash_bits);
+    if (!hash_table)
+        return -1;
+    if (new_size > s->records_size) {
+        records = js_realloc_rt(rt, s->records, sizeof(records[0]) * new_size);
+        if (!records) {
+            js_free_rt(rt, hash_table);
+            return -1;
         }
+        s->records = records;
     }
-    s->hash_table = new_hash_table;
-    s->hash_size = new_hash_size;
-    s->record_count_threshold = new_hash_size * 2;
+    map_compact(s);
+    if (new_size < s->records_size) {
+        /* keep the larger array if the shrinking fails */
+        records = js_realloc_rt(rt, s->records, sizeof(records[0]) * new_size);
+        if (records)
+            s->records = records;
+    }
+    s->records_size = new_size;
+
+    js_free_rt(rt, s->hash_table);
+    s->hash_table = hash_table;
+    s->hash_bits = hash_bits;
+    memset(hash_table, 0xff, sizeof(hash_table[0]) << hash_bits);
+    for(i = 0; i < s->records_used; i++)
+        map_insert_slot(s, s->records[i].hash, i);
+    return 0;
 }
 
 static JSMapRecord *map_add_record(JSContext *ctx, JSMapState *s,
                                    JSValueConst key)
 {
-    uint32_t h;
+    uint32_t h, new_size;
     JSMapRecord *mr;
 
-    mr = js_malloc(ctx, sizeof(*mr));
-    if (!mr)
-        return NULL;
-    mr->ref_count = 1;
-    mr->map = s;
-    mr->empty = FALSE;
+    if (s->records_used == s->records_size) {
+        /* grow if more than half of the records are live, otherwise
+           only remove the deleted ones */
+        new_size = s->records_size;
+        if (new_size == 0)
+            new_size = 4;
+        else if (s->record_count >= new_size / 2)
+            new_size *= 2;
+        if (map_resize(ctx->rt, s, new_size)) {
+            JS_ThrowOutOfMemory(ctx);
+            return NULL;
+        }
+    }
     if (s->is_weak) {
         JSObject *p = JS_VALUE_GET_OBJ(key);
+        JSMapWeakRef *wr;
         /* Add the weak reference */
-        mr->next_weak_ref = p->first_weak_ref;
-        p->first_weak_ref = mr;
+        wr = js_malloc(ctx, sizeof(*wr));
+        if (!wr)
+            return NULL;
+        wr->map = s;
+        wr->next = p->first_weak_ref;
+        p->first_weak_ref = wr;
     } else {
         JS_DupValue(ctx, key);
     }
+    h = map_hash_key(key);
+    mr = &s->records[s->records_used];
     mr->key = (JSValue)key;
-    h = map_hash_key(ctx, key) & (s->hash_size - 1);
-    list_add_tail(&mr->hash_link, &s->hash_table[h]);
-    list_add_tail(&mr->link, &s->records);
+    mr->value = JS_UNDEFINED;
+    mr->hash = h;
+    map_insert_slot(s, h, s->records_used);
+    s->records_used++;
     s->record_count++;
-    if (s->record_count >= s->record_count_threshold) {
-        map_hash_resize(ctx, s);
-    }
     return mr;
 }
 
@@ -45549,80 +51466,81 @@ static JSMapRecord *map_add_record(JSContext *ctx, JSMapState *s,
    reference list. we don't use a doubly linked list to
    save space, assuming a given object has few weak
        references to it */
-static void delete_weak_ref(JSRuntime *rt, JSMapRecord *mr)
+static void delete_weak_ref(JSRuntime *rt, JSMapState *s, JSValueConst key)
 {
-    JSMapRecord **pmr, *mr1;
+    JSMapWeakRef **pwr, *wr;
     JSObject *p;
 
-    p = JS_VALUE_GET_OBJ(mr->key);
-    pmr = &p->first_weak_ref;
+    p = JS_VALUE_GET_OBJ(key);
+    pwr = &p->first_weak_ref;
     for(;;) {
-        mr1 = *pmr;
-        assert(mr1 != NULL);
-        if (mr1 == mr)
+        wr = *pwr;
+        assert(wr != NULL);
+        if (wr->map == s)
             break;
-        pmr = &mr1->next_weak_ref;
+        pwr = &wr->next;
     }
-    *pmr = mr1->next_weak_ref;
+    *pwr = wr->next;
+    js_free_rt(rt, wr);
 }
 
-static void map_delete_record(JSRuntime *rt, JSMapState *s, JSMapRecord *mr)
+/* the key and value of the record are returned to be freed by the
+   caller once the map is consistent */
+static void map_remove_slot(JSRuntime *rt, JSMapState *s, uint32_t slot,
+                            JSValue *pkey, JSValue *pvalue)
 {
-    if (mr->empty)
-        return;
-    list_del(&mr->hash_link);
-    if (s->is_weak) {
-        delete_weak_ref(rt, mr);
-    } else {
-        JS_FreeValueRT(rt, mr->key);
-    }
-    JS_FreeValueRT(rt, mr->value);
-    if (--mr->ref_count == 0) {
-        list_del(&mr->link);
-        js_free_rt(rt, mr);
-    } else {
-        /* keep a zombie record for iterators */
-        mr->empty = TRUE;
-        mr->key = JS_UNDEFINED;
-        mr->value = JS_UNDEFINED;
-    }
-    s->record_count--;
-}
+    JSMapRecord *mr;
 
-static void map_decref_record(JSRuntime *rt, JSMapRecord *mr)
-{
-    if (--mr->ref_count == 0) {
-        /* the record can be safely removed */
-        assert(mr->empty);
-        list_del(&mr->link);
-        js_free_rt(rt, mr);
+    mr = &s->records[s->hash_table[slot]];
+    s->hash_table[slot] = MAP_SLOT_DELETED;
+    *pkey = mr->key;
+    *pvalue = mr->value;
+    mr->key = JS_UNINITIALIZED;
+    mr->value = JS_UNDEFINED;
+    s->record_count--;
+    if (s->is_weak) {
+        delete_weak_ref(rt, s, *pkey);
+        *pkey = JS_UNDEFINED;
     }
+    /* shrink the mostly empty maps */
+    if (s->records_size > 8 && s->record_count < s->records_size / 8)
+        map_resize(rt, s, s->records_size / 4);
 }
 
 static void reset_weak_ref(JSRuntime *rt, JSObject *p)
 {
-    JSMapRecord *mr, *mr_next;
+    JSMapWeakRef *wr;
     JSMapState *s;
-    
-    /* first pass to remove the records from the WeakMap/WeakSet
-       lists */
-    for(mr = p->first_weak_ref; mr != NULL; mr = mr->next_weak_ref) {
-        s = mr->map;
+    JSMapRecord *mr;
+    uint32_t i, idx, mask;
+    JSValue value;
+
+    /* the list is read again after each value is freed because
+       freeing it may modify the list */
+    while ((wr = p->first_weak_ref) != NULL) {
+        s = wr->map;
         assert(s->is_weak);
-        assert(!mr->empty); /* no iterator on WeakMap/WeakSet */
-        list_del(&mr->hash_link);
-        list_del(&mr->link);
-    }
-    
-    /* second pass to free the values to avoid modifying the weak
-       reference list while traversing it. */
-    for(mr = p->first_weak_ref; mr != NULL; mr = mr_next) {
-        mr_next = mr->next_weak_ref;
-        JS_FreeValueRT(rt, mr->value);
-        js_free_rt(rt, mr);
+        mask = (1 << s->hash_bits) - 1;
+        for(i = map_hash_slot(s, map_hash_key(JS_MKPTR(JS_TAG_OBJECT, p)));;
+            i = (i + 1) & mask) {
+            idx = s->hash_table[i];
+            assert(idx != MAP_SLOT_EMPTY);
+            if (idx != MAP_SLOT_DELETED) {
+                mr = &s->records[idx];
+                if (JS_VALUE_GET_TAG(mr->key) == JS_TAG_OBJECT &&
+                    JS_VALUE_GET_OBJ(mr->key) == p)
+                    break;
+            }
+        }
+        p->first_weak_ref = wr->next;
+        js_free_rt(rt, wr);
+        s->hash_table[i] = MAP_SLOT_DELETED;
+        value = mr->value;
+        mr->key = JS_UNINITIALIZED;
+        mr->value = JS_UNDEFINED;
+        s->record_count--;
+        JS_FreeValueRT(rt, value);
     }
-
-    p->first_weak_ref = NULL; /* fail safe */
 }
 
 static JSValue js_map_set(JSContext *ctx, JSValueConst this_val,
@@ -45631,6 +51549,7 @@ static JSValue js_map_set(JSContext *ctx, JSValueConst this_val,
     JSMapState *s = JS_GetOpaque2(ctx, this_val, JS_CLASS_MAP + magic);
     JSMapRecord *mr;
     JSValueConst key, value;
+    JSValue old_value;
 
     if (!s)
         return JS_EXCEPTION;
@@ -45642,14 +51561,15 @@ static JSValue js_map_set(JSContext *ctx, JSValueConst this_val,
     else
         value = argv[1];
     mr = map_find_record(ctx, s, key);
-    if (mr) {
-        JS_FreeValue(ctx, mr->value);
-    } else {
+    if (!mr) {
         mr = map_add_record(ctx, s, key);
         if (!mr)
             return JS_EXCEPTION;
     }
+    /* freeing the old value may modify the map */
+    old_value = mr->value;
     mr->value = JS_DupValue(ctx, value);
+    JS_FreeValue(ctx, old_value);
     return JS_DupValue(ctx, this_val);
 }
 
@@ -45688,16 +51608,19 @@ static JSValue js_map_delete(JSContext *ctx, JSValueConst this_val,
                              int argc, JSValueConst *argv, int magic)
 {
     JSMapState *s = JS_GetOpaque2(ctx, this_val, JS_CLASS_MAP + magic);
-    JSMapRecord *mr;
     JSValueConst key;
+    JSValue old_key, old_value;
+    int slot;
 
     if (!s)
         return JS_EXCEPTION;
     key = map_normalize_key(ctx, argv[0]);
-    mr = map_find_record(ctx, s, key);
-    if (!mr)
+    slot = map_find_slot(ctx, s, key, map_hash_key(key));
+    if (slot < 0)
         return JS_FALSE;
-    map_delete_record(ctx->rt, s, mr);
+    map_remove_slot(ctx->rt, s, slot, &old_key, &old_value);
+    JS_FreeValue(ctx, old_key);
+    JS_FreeValue(ctx, old_value);
     return JS_TRUE;
 }
 
@@ -45705,15 +51628,32 @@ static JSValue js_map_clear(JSContext *ctx, JSValueConst this_val,
                             int argc, JSValueConst *argv, int magic)
 {
     JSMapState *s = JS_GetOpaque2(ctx, this_val, JS_CLASS_MAP + magic);
-    struct list_head *el, *el1;
-    JSMapRecord *mr;
+    struct list_head *el;
+    JSMapRecord *records;
+    uint32_t i, records_used;
 
     if (!s)
         return JS_EXCEPTION;
-    list_for_each_safe(el, el1, &s->records) {
-        mr = list_entry(el, JSMapRecord, link);
-        map_delete_record(ctx->rt, s, mr);
+    /* the map is emptied before the keys and values are freed */
+    records = s->records;
+    records_used = s->records_used;
+    s->records = NULL;
+    s->records_used = 0;
+    s->records_size = 0;
+    s->record_count = 0;
+    js_free(ctx, s->hash_table);
+    s->hash_table = NULL;
+    s->hash_bits = 0;
+    list_for_each(el, &s->cursors) {
+        list_entry(el, JSMapCursor, link)->pos = 0;
+    }
+    for(i = 0; i < records_used; i++) {
+        if (!JS_IsUninitialized(records[i].key)) {
+            JS_FreeValue(ctx, records[i].key);
+            JS_FreeValue(ctx, records[i].value);
+        }
     }
+    js_free(ctx, records);
     return JS_UNDEFINED;
 }
 
@@ -45725,14 +51665,27 @@ static JSValue js_map_get_size(JSContext *ctx, JSValueConst this_val, int magic)
     return JS_NewUint32(ctx, s->record_count);
 }
 
+/* return the next live record or NULL at the end */
+static JSMapRecord *map_next_record(JSMapState *s, JSMapCursor *c)
+{
+    JSMapRecord *mr;
+
+    while (c->pos < s->records_used) {
+        mr = &s->records[c->pos++];
+        if (!JS_IsUninitialized(mr->key))
+            return mr;
+    }
+    return NULL;
+}
+
 static JSValue js_map_forEach(JSContext *ctx, JSValueConst this_val,
                               int argc, JSValueConst *argv, int magic)
 {
     JSMapState *s = JS_GetOpaque2(ctx, this_val, JS_CLASS_MAP + magic);
     JSValueConst func, this_arg;
     JSValue ret, args[3];
-    struct list_head *el;
     JSMapRecord *mr;
+    JSMapCursor c;
 
     if (!s)
         return JS_EXCEPTION;
@@ -45743,33 +51696,29 @@ static JSValue js_map_forEach(JSContext *ctx, JSValueConst this_val,
         this_arg = JS_UNDEFINED;
     if (check_function(ctx, func))
         return JS_EXCEPTION;
-    /* Note: the list can be modified while traversing it, but the
-       current element is locked */
-    el = s->records.next;
-    while (el != &s->records) {
-        mr = list_entry(el, JSMapRecord, link);
-        if (!mr->empty) {
-            mr->ref_count++;
-            /* must duplicate in case the record is deleted */
-            args[1] = JS_DupValue(ctx, mr->key);
-            if (magic)
-                args[0] = args[1];
-            else
-                args[0] = JS_DupValue(ctx, mr->value);
-            args[2] = (JSValue)this_val;
-            ret = JS_Call(ctx, func, this_arg, 3, (JSValueConst *)args);
-            JS_FreeValue(ctx, args[0]);
-            if (!magic)
-                JS_FreeValue(ctx, args[1]);
-            el = el->next;
-            map_decref_record(ctx->rt, mr);
-            if (JS_IsException(ret))
-                return ret;
-            JS_FreeValue(ctx, ret);
-        } else {
-            el = el->next;
+    /* Note: the map can be modified while traversing it, the cursor
+       is updated if the records are moved */
+    c.pos = 0;
+    list_add_tail(&c.link, &s->cursors);
+    while ((mr = map_next_record(s, &c)) != NULL) {
+        /* must duplicate in case the record is deleted */
+        args[1] = JS_DupValue(ctx, mr->key);
+        if (magic)
+            args[0] = args[1];
+        else
+            args[0] = JS_DupValue(ctx, mr->value);
+        args[2] = (JSValue)this_val;
+        ret = JS_Call(ctx, func, this_arg, 3, (JSValueConst *)args);
+        JS_FreeValue(ctx, args[0]);
+        if (!magic)
+            JS_FreeValue(ctx, args[1]);
+        if (JS_IsException(ret)) {
+            list_del(&c.link);
+            return ret;
         }
+        JS_FreeValue(ctx, ret);
     }
+    list_del(&c.link);
     return JS_UNDEFINED;
 }
 
@@ -45779,23 +51728,27 @@ static void js_map_finalizer(JSRuntime *rt, JSValue val)
     JSMapState *s;
     struct list_head *el, *el1;
     JSMapRecord *mr;
+    uint32_t i;
 
     p = JS_VALUE_GET_OBJ(val);
     s = p->u.map_state;
     if (s) {
-        /* if the object is deleted we are sure that no iterator is
-           using it */
-        list_for_each_safe(el, el1, &s->records) {
-            mr = list_entry(el, JSMapRecord, link);
-            if (!mr->empty) {
+        /* During the GC sweep phase the Map iterator finalizer may be
+           called after the Map finalizer */
+        list_for_each_safe(el, el1, &s->cursors) {
+            init_list_head(el);
+        }
+        for(i = 0; i < s->records_used; i++) {
+            mr = &s->records[i];
+            if (!JS_IsUninitialized(mr->key)) {
                 if (s->is_weak)
-                    delete_weak_ref(rt, mr);
+                    delete_weak_ref(rt, s, mr->key);
                 else
                     JS_FreeValueRT(rt, mr->key);
                 JS_FreeValueRT(rt, mr->value);
             }
-            js_free_rt(rt, mr);
         }
+        js_free_rt(rt, s->records);
         js_free_rt(rt, s->hash_table);
         js_free_rt(rt, s);
     }
@@ -45805,13 +51758,13 @@ static void js_map_mark(JSRuntime *rt, JSValueConst val, JS_MarkFunc *mark_func)
 {
     JSObject *p = JS_VALUE_GET_OBJ(val);
     JSMapState *s;
-    struct list_head *el;
     JSMapRecord *mr;
+    uint32_t i;
 
     s = p->u.map_state;
     if (s) {
-        list_for_each(el, &s->records) {
-            mr = list_entry(el, JSMapRecord, link);
+        for(i = 0; i < s->records_used; i++) {
+            mr = &s->records[i];
             if (!s->is_weak)
                 JS_MarkValue(rt, mr->key, mark_func);
             JS_MarkValue(rt, mr->value, mark_func);
@@ -45824,7 +51777,7 @@ static void js_map_mark(JSRuntime *rt, JSValueConst val, JS_MarkFunc *mark_func)
 typedef struct JSMapIteratorData {
     JSValue obj;
     JSIteratorKindEnum kind;
-    JSMapRecord *cur_record;
+    JSMapCursor cursor; /* not in a list when obj is undefined */
 } JSMapIteratorData;
 
 static void js_map_iterator_finalizer(JSRuntime *rt, JSValue val)
@@ -45835,11 +51788,8 @@ static void js_map_iterator_finalizer(JSRuntime *rt, JSValue val)
     p = JS_VALUE_GET_OBJ(val);
     it = p->u.map_iterator_data;
     if (it) {
-        /* During the GC sweep phase the Map finalizer may be
-           called before the Map iterator finalizer */
-        if (JS_IsLiveObject(rt, it->obj) && it->cur_record) {
-            map_decref_record(rt, it->cur_record);
-        }
+        if (!JS_IsUndefined(it->obj))
+            list_del(&it->cursor.link);
         JS_FreeValueRT(rt, it->obj);
         js_free_rt(rt, it);
     }
@@ -45880,7 +51830,8 @@ static JSValue js_create_map_iterator(JSContext *ctx, JSValueConst this_val,
     }
     it->obj = JS_DupValue(ctx, this_val);
     it->kind = kind;
-    it->cur_record = NULL;
+    it->cursor.pos = 0;
+    list_add_tail(&it->cursor.link, &s->cursors);
     JS_SetOpaque(enum_obj, it);
     return enum_obj;
  fail:
@@ -45894,7 +51845,6 @@ static JSValue js_map_iterator_next(JSContext *ctx, JSValueConst this_val,
     JSMapIteratorData *it;
     JSMapState *s;
     JSMapRecord *mr;
-    struct list_head *el;
 
     it = JS_GetOpaque2(ctx, this_val, JS_CLASS_MAP_ITERATOR + magic);
     if (!it) {
@@ -45905,34 +51855,17 @@ static JSValue js_map_iterator_next(JSContext *ctx, JSValueConst this_val,
         goto done;
     s = JS_GetOpaque(it->obj, JS_CLASS_MAP + magic);
     assert(s != NULL);
-    if (!it->cur_record) {
-        el = s->records.next;
-    } else {
-        mr = it->cur_record;
-        el = mr->link.next;
-        map_decref_record(ctx->rt, mr); /* the record can be freed here */
-    }
-    for(;;) {
-        if (el == &s->records) {
-            /* no more record  */
-            it->cur_record = NULL;
-            JS_FreeValue(ctx, it->obj);
-            it->obj = JS_UNDEFINED;
-        done:
-            /* end of enumeration */
-            *pdone = TRUE;
-            return JS_UNDEFINED;
-        }
-        mr = list_entry(el, JSMapRecord, link);
-        if (!mr->empty)
-            break;
-        /* get the next record */
-        el = mr->link.next;
+    mr = map_next_record(s, &it->cursor);
+    if (!mr) {
+        /* no more record  */
+        list_del(&it->cursor.link);
+        JS_FreeValue(ctx, it->obj);
+        it->obj = JS_UNDEFINED;
+    done:
+        /* end of enumeration */
+        *pdone = TRUE;
+        return JS_UNDEFINED;
     }
-
-    /* lock the record so that it won't be freed */
-    mr->ref_count++;
-    it->cur_record = mr;
     *pdone = FALSE;
 
     if (it->kind == JS_ITERATOR_KIND_KEY) {
@@ -48920,6 +54853,7 @@ static JSValue JS_ToBigIntCtorFree(JSContext *ctx, JSValue val)
             break;
         goto redo;
     case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
         val = JS_StringToBigIntErr(ctx, val);
         break;
     case JS_TAG_OBJECT:
@@ -49474,6 +55408,7 @@ static JSValue js_bigfloat_constructor(JSContext *ctx,
                 break;
             goto redo;
         case JS_TAG_STRING:
+        case JS_TAG_STRING_ROPE:
             {
                 const char *str, *p;
                 size_t len;
@@ -50152,6 +56087,7 @@ static JSValue JS_ToBigDecimalFree(JSContext *ctx, JSValue val,
             break;
         goto redo;
     case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
         {
             const char *str, *p;
             size_t len;
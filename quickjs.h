@@ -72,6 +72,7 @@ enum {
     JS_TAG_BIG_FLOAT   = -9,
     JS_TAG_SYMBOL      = -8,
     JS_TAG_STRING      = -7,
+    JS_TAG_STRING_ROPE = -6, /* lazy concatenation of strings */
     JS_TAG_MODULE      = -3, /* used internally */
     JS_TAG_FUNCTION_BYTECODE = -2, /* used internally */
     JS_TAG_OBJECT      = -1,
@@ -307,6 +308,10 @@ static inline JS_BOOL JS_VALUE_IS_NAN(JSValue v)
 #define JS_EVAL_FLAG_COMPILE_ONLY (1 << 5)
 /* don't include the stack frames before this eval in the Error() backtraces */
 #define JS_EVAL_FLAG_BACKTRACE_BARRIER (1 << 6)
+/* only pre-parse the body of the functions: their bytecode is
+   generated when they are called for the first time and syntax errors
+   inside them are reported at that time. Ignored in 'strip' mode. */
+#define JS_EVAL_FLAG_LAZY     (1 << 7)
 
 typedef JSValue JSCFunction(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv);
 typedef JSValue JSCFunctionMagic(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv, int magic);
@@ -335,12 +340,34 @@ void JS_SetMemoryLimit(JSRuntime *rt, size_t limit);
 void JS_SetGCThreshold(JSRuntime *rt, size_t gc_threshold);
 void JS_SetMaxStackSize(JSRuntime *rt, size_t stack_size);
 JSRuntime *JS_NewRuntime2(const JSMallocFunctions *mf, void *opaque);
+/* size class pool allocator for the small blocks: 'pool' must be
+   given as opaque to JS_NewRuntime2() and freed after the runtime */
+typedef struct JSMallocPool JSMallocPool;
+JSMallocPool *JS_NewMallocPool(void);
+/* allocate all the memory in [base, base + size) (see JS_SaveHeapImage()) */
+JSMallocPool *JS_NewMallocPoolRegion(void *base, size_t size);
+void JS_FreeMallocPool(JSMallocPool *pool);
+const JSMallocFunctions *JS_GetMallocPoolFunctions(void);
+/* heap image (warm start): the heap of a runtime allocated with
+   JS_NewMallocPoolRegion() is saved and loaded later at the same
+   address by the same executable, identified by 'build_id' (e.g. the
+   SHA-256 of the executable) */
+#define JS_HEAP_IMAGE_BUILD_ID_MAX 32
+typedef int JSHeapImageWriteFunc(void *opaque, const void *buf, size_t len);
+int JS_SaveHeapImage(JSContext *ctx, const void *build_id,
+                     size_t build_id_len, JSHeapImageWriteFunc *write_func,
+                     void *opaque);
+JSContext *JS_LoadHeapImage(void *base, size_t size,
+                            const void *buf, size_t buf_len,
+                            const void *build_id, size_t build_id_len);
 void JS_FreeRuntime(JSRuntime *rt);
 void *JS_GetRuntimeOpaque(JSRuntime *rt);
 void JS_SetRuntimeOpaque(JSRuntime *rt, void *opaque);
 typedef void JS_MarkFunc(JSRuntime *rt, JSGCObjectHeader *gp);
 void JS_MarkValue(JSRuntime *rt, JSValueConst val, JS_MarkFunc *mark_func);
 void JS_RunGC(JSRuntime *rt);
+void JS_RunGCStep(JSRuntime *rt, int budget_us);
+void JS_SetDeferredFree(JSRuntime *rt, JS_BOOL enable);
 JS_BOOL JS_IsLiveObject(JSRuntime *rt, JSValueConst obj);
 
 JSContext *JS_NewContext(JSRuntime *rt);
@@ -392,6 +419,12 @@ void *js_mallocz(JSContext *ctx, size_t size);
 char *js_strdup(JSContext *ctx, const char *str);
 char *js_strndup(JSContext *ctx, const char *s, size_t n);
 
+#define JS_MALLOC_POOL_CLASS_COUNT 21
+
+typedef struct JSMallocPoolClassUsage {
+    int64_t block_size, chunk_count, block_count, used_count;
+} JSMallocPoolClassUsage;
+
 typedef struct JSMemoryUsage {
     int64_t malloc_size, malloc_limit, memory_used_size;
     int64_t malloc_count;
@@ -406,10 +439,19 @@ typedef struct JSMemoryUsage {
     int64_t c_func_count, array_count;
     int64_t fast_array_count, fast_array_elements;
     int64_t binary_object_count, binary_object_size;
+    /* only set if the runtime uses JS_GetMallocPoolFunctions() */
+    int64_t pool_chunk_count, pool_size;
+    JSMallocPoolClassUsage pool_classes[JS_MALLOC_POOL_CLASS_COUNT];
 } JSMemoryUsage;
 
 void JS_ComputeMemoryUsage(JSRuntime *rt, JSMemoryUsage *s);
 void JS_DumpMemoryUsage(FILE *fp, const JSMemoryUsage *s, JSRuntime *rt);
+/* write the GC objects and the strings they reference in the
+   .heapsnapshot format of Chrome DevTools. Return < 0 if error. */
+int JS_WriteHeapSnapshot(JSRuntime *rt, FILE *f);
+/* only available if compiled with CONFIG_OPCODE_STATS: dump the count
+   and cycles of the executed opcodes and the most frequent pairs */
+void JS_DumpOpcodeStats(FILE *fp, JSRuntime *rt);
 
 /* atom support */
 #define JS_ATOM_NULL 0
@@ -610,7 +652,8 @@ static inline JS_BOOL JS_IsUninitialized(JSValueConst v)
 
 static inline JS_BOOL JS_IsString(JSValueConst v)
 {
-    return JS_VALUE_GET_TAG(v) == JS_TAG_STRING;
+    return JS_VALUE_GET_TAG(v) == JS_TAG_STRING ||
+        JS_VALUE_GET_TAG(v) == JS_TAG_STRING_ROPE;
 }
 
 static inline JS_BOOL JS_IsSymbol(JSValueConst v)
@@ -838,6 +881,37 @@ void JS_SetHostPromiseRejectionTracker(JSRuntime *rt, JSHostPromiseRejectionTrac
 /* return != 0 if the JS code needs to be interrupted */
 typedef int JSInterruptHandler(JSRuntime *rt, void *opaque);
 void JS_SetInterruptHandler(JSRuntime *rt, JSInterruptHandler *cb, void *opaque);
+
+/* Sampling profiler: the JS stack is sampled about every 'interval_us'
+   microseconds while JS code is running. JS_StartProfiler()
+   discards the previous samples. */
+#define JS_PROFILE_FOLDED     0 /* 'f1 (file:line);f2 (file:line) count' lines */
+#define JS_PROFILE_CPUPROFILE 1 /* Chrome DevTools .cpuprofile JSON */
+/* return < 0 on error */
+typedef int JSProfileWriteFunc(void *opaque, const void *buf, size_t len);
+int JS_StartProfiler(JSRuntime *rt, int interval_us);
+void JS_StopProfiler(JSRuntime *rt);
+/* return < 0 if no profile or write error */
+int JS_WriteProfile(JSRuntime *rt, int format,
+                    JSProfileWriteFunc *write_func, void *opaque);
+
+/* Allocation profiler: an allocation is sampled every 'sample_bytes'
+   bytes (0 or 1 for all of them) and attributed to its JS function
+   and line. The samples are kept until the blocks are freed.
+   JS_StartAllocationProfiler() discards the previous data. */
+int JS_StartAllocationProfiler(JSRuntime *rt, size_t sample_bytes);
+/* stop sampling, the frees are still tracked */
+void JS_StopAllocationProfiler(JSRuntime *rt);
+void JS_FreeAllocationProfiler(JSRuntime *rt);
+/* return the snapshot index of the live memory or -1 */
+int JS_TakeAllocationSnapshot(JSRuntime *rt);
+/* write the live memory per site of 'to_snapshot' minus the one of
+   'from_snapshot' as text. -1 is the current state for 'to_snapshot'
+   and nothing for 'from_snapshot'. Return < 0 if error. */
+int JS_WriteAllocationProfile(JSRuntime *rt, int from_snapshot,
+                              int to_snapshot,
+                              JSProfileWriteFunc *write_func, void *opaque);
+
 /* if can_block is TRUE, Atomics.wait() can be used */
 void JS_SetCanBlock(JSRuntime *rt, JS_BOOL can_block);
 /* set the [IsHTMLDDA] internal slot */
@@ -626,6 +626,81 @@ function set_collection_add(n)
     return n * len;
 }
 
+/* registry of 'len' devices, shared by the map_collection tests */
+var map_registry;
+
+function get_map_registry(len)
+{
+    var i;
+    if (!map_registry) {
+        map_registry = new Map();
+        for(i = 0; i < len; i++)
+            map_registry.set("dev" + i, i);
+    }
+    return map_registry;
+}
+
+function map_collection_set(n)
+{
+    var m, i, j, len = 1000;
+    for(j = 0; j < n; j++) {
+        m = new Map();
+        for(i = 0; i < len; i++) {
+            m.set(i, i);
+        }
+    }
+    global_res = m;
+    return n * len;
+}
+
+function map_collection_get(n)
+{
+    var m, i, j, sum, len = 20000;
+    var keys = [];
+    m = get_map_registry(len);
+    for(i = 0; i < 100; i++)
+        keys[i] = "dev" + ((i * 7919) % len);
+    for(j = 0; j < n; j++) {
+        sum = 0;
+        for(i = 0; i < 100; i++) {
+            sum += m.get(keys[i]);
+        }
+        global_res = sum;
+    }
+    return n * 100;
+}
+
+function map_collection_delete(n)
+{
+    var m, i, j, len = 100;
+    m = get_map_registry(20000);
+    for(j = 0; j < n; j++) {
+        for(i = 0; i < len; i++) {
+            m.set(i, i);
+        }
+        for(i = 0; i < len; i++) {
+            m.delete(i);
+        }
+    }
+    return n * len;
+}
+
+function map_collection_for_of(n)
+{
+    var m, i, j, sum, len = 1000;
+    m = new Map();
+    for(i = 0; i < len; i++)
+        m.set(i, i);
+    for(j = 0; j < n; j++) {
+        sum = 0;
+        for(var e of m) {
+            sum += e[1];
+        }
+        global_res = sum;
+    }
+    return n * len;
+}
+
 function array_for(n)
 {
     var r, i, j, sum;
@@ -913,13 +988,92 @@ function string_to_int(n)
 }
 
 function string_to_float(n)
+{
+    var tab, r, j;
+    /* short, shortest round trip, large and denormal numbers */
+    tab = [ "12345.6", "0.30000000000000004", "6.02214076e23",
+            "4.9406564584124654e-324" ];
+    r = 0;
+    for(j = 0; j < n; j++) {
+        r -= tab[j & 3];
+    }
+    global_res = r;
+    return n;
+}
+
+/* the first two regexps use the backtracking engine, the next ones
+   the Pike VM */
+function regexp_literal(n)
+{
+    var s, r, j;
+    s = "INFO: 12 ".repeat(30) + "ERROR: 345";
+    r = 0;
+    for(j = 0; j < n; j++) {
+        r += /ERROR: (\d+)/.exec(s).index;
+    }
+    global_res = r;
+    return n;
+}
+
+function regexp_capture(n)
+{
+    var s, r, j;
+    s = "date: 2020-11-08";
+    r = 0;
+    for(j = 0; j < n; j++) {
+        r += /(\d+)-(\d+)-(\d+)/.exec(s)[2].length;
+    }
+    global_res = r;
+    return n;
+}
+
+function regexp_alternation(n)
+{
+    var s, r, j;
+    s = "127.0.0.1 - PUT /api/v1/users/42 HTTP/1.1";
+    r = 0;
+    for(j = 0; j < n; j++) {
+        r += /(GET|POST|PUT) ((?:\/\w+)+) HTTP/.exec(s)[2].length;
+    }
+    global_res = r;
+    return n;
+}
+
+function regexp_nested_quant(n)
+{
+    var s, r, j;
+    /* exponential time with backtracking */
+    s = "a".repeat(18);
+    r = 0;
+    for(j = 0; j < n; j++) {
+        if (/(a+)+b/.test(s))
+            r++;
+    }
+    global_res = r;
+    return n;
+}
+
+function regexp_no_match(n)
 {
     var s, r, j;
+    /* long input: rejected by the lazy DFA */
+    s = "version 1.2.3 build 45.6 ".repeat(20);
     r = 0;
-    s = "12345.6";
+    for(j = 0; j < n; j++) {
+        if (/(?:\d+\.)+\d+ ms/.test(s))
+            r++;
+    }
+    global_res = r;
+    return n;
+}
+
+function regexp_construct(n)
+{
+    var r, j;
+    /* the same source is compiled only once */
     r = 0;
     for(j = 0; j < n; j++) {
-        r -= s;
+        r += new RegExp("^/users/(\\d+)/(\\w+)$", "i").lastIndex;
     }
     global_res = r;
     return n;
@@ -979,6 +1133,10 @@ function main(argc, argv, g)
         int_arith,
         float_arith,
         set_collection_add,
+        map_collection_set,
+        map_collection_get,
+        map_collection_delete,
+        map_collection_for_of,
         array_for,
         array_for_in,
         array_for_of,
@@ -992,6 +1150,12 @@ function main(argc, argv, g)
         float_to_string,
         string_to_int,
         string_to_float,
+        regexp_literal,
+        regexp_capture,
+        regexp_alternation,
+        regexp_nested_quant,
+        regexp_no_match,
+        regexp_construct,
     ];
     var tests = [];
     var i, j, n, f, name;
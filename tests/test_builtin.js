@@ -304,6 +304,52 @@ function test_string()
     assert("abc".padStart(Infinity, ""), "abc");
 }
 
+/* long concatenations are kept as ropes until the characters are needed */
+function test_string_rope()
+{
+    var a, b, c, i, m;
+
+    a = "";
+    for(i = 0; i < 10000; i++)
+        a += "ab" + i;
+    assert(typeof a, "string");
+    assert(a.length, 58890);
+    assert(a[2], "0");
+    assert(a.charAt(58889), "9");
+    assert(a.slice(-6), "ab9999");
+    assert(a.indexOf("ab5000"), a.lastIndexOf("ab5000"));
+
+    b = "";
+    for(i = 0; i < 10000; i++)
+        b = "x" + i + b;
+    assert(b.slice(0, 10), "x9999x9998");
+    assert(b.length, 48890);
+
+    a = "a".repeat(1000) + "b".repeat(1000);
+    b = "a".repeat(500) + ("a".repeat(500) + "b".repeat(1000));
+    c = a.split("").join("");
+    assert(a === b && b === c && a == c);
+    assert(a + "c" > b && b < a + "c" && !(a < b));
+    assert(a !== b + "d");
+    assert(a + "\u20ac" === b + "\u20ac");
+    assert((a + "\u20ac").charCodeAt(2000), 0x20ac);
+    assert(!!(a + ""));
+    assert(JSON.stringify(a), '"' + c + '"');
+    assert(JSON.parse(JSON.stringify({ a: a })).a, c);
+
+    m = new Map();
+    m.set(a, 1);
+    assert(m.get(b), 1);
+    assert(m.get(c), 1);
+    assert(m.has(c + "x"), false);
+
+    assert(new String(a).length, 2000);
+    assert(Object(b) instanceof String);
+    assert(b.valueOf(), c);
+    assert(a.toUpperCase().length, 2000);
+    assert([ b ].indexOf(c), 0);
+}
+
 function test_math()
 {
     var a;
@@ -344,6 +390,183 @@ function test_number()
     assert((-1.125).toFixed(2), "-1.13");
 }
 
+/* exact decimal expansion of |d| (finite): [digits, position of the point] */
+function exact_decimal(d)
+{
+    var dv = new DataView(new ArrayBuffer(8)), m, e, s;
+    dv.setFloat64(0, Math.abs(d));
+    e = (dv.getUint32(0) >>> 20) & 0x7ff;
+    m = BigInt(dv.getUint32(0) & 0xfffff) * 2n ** 32n + BigInt(dv.getUint32(4));
+    if (e == 0)
+        e = 1;
+    else
+        m += 2n ** 52n;
+    e -= 1075;
+    if (e >= 0)
+        return [String(m << BigInt(e)), 0];
+    s = String(m * 5n ** BigInt(-e));
+    return [s, -e];
+}
+
+/* round the digits 'a' to 'n' digits, ties away from zero */
+function round_digits(a, n)
+{
+    var r;
+    if (n >= a.length)
+        return a + "0".repeat(n - a.length);
+    r = BigInt(a.slice(0, n) || "0");
+    if (a.charCodeAt(n) >= 0x35)
+        r++;
+    return String(r).padStart(n, "0");
+}
+
+function to_fixed_exact(d, f)
+{
+    var [s, point] = exact_decimal(d), r;
+    s = s.padStart(point + 1, "0");
+    r = round_digits(s, s.length - point + f).padStart(f + 1, "0");
+    if (f > 0)
+        r = r.slice(0, r.length - f) + "." + r.slice(r.length - f);
+    return (d < 0 ? "-" : "") + r;
+}
+
+function to_exponential_exact(d, f)
+{
+    var [s, point] = exact_decimal(d), i, r, e;
+    i = s.search(/[1-9]/);
+    e = s.length - point - i - 1;
+    r = round_digits(s.slice(i), f + 1);
+    if (r.length > f + 1) {
+        r = r.slice(0, f + 1);
+        e++;
+    }
+    if (f > 0)
+        r = r[0] + "." + r.slice(1);
+    return (d < 0 ? "-" : "") + r + "e" + (e < 0 ? "-" : "+") + Math.abs(e);
+}
+
+function test_number_to_string()
+{
+    var dv = new DataView(new ArrayBuffer(8)), seed = 1, i, d, s, k, f;
+    function rnd() {
+        seed = (seed * 1103515245 + 12345) >>> 0;
+        return seed >>> 8;
+    }
+
+    assert(String(0.1), "0.1");
+    assert(String(1 / 3), "0.3333333333333333");
+    assert(String(5e-324), "5e-324");
+    assert(String(1.7976931348623157e308), "1.7976931348623157e+308");
+    assert(String(2 ** -1022), "2.2250738585072014e-308");
+    assert(String(9007199254740993), "9007199254740992");
+    assert(String(1e23), "1e+23");
+    assert(String(123e-20), "1.23e-18");
+    assert((1.005).toFixed(2), "1.00");
+    assert((0.5).toFixed(0), "1");
+    assert((-0.0001).toFixed(2), "-0.00");
+    assert((1e20).toFixed(2), "100000000000000000000.00");
+    assert((1e-10).toFixed(20), "0.00000000010000000000");
+    assert((123.456).toPrecision(4), "123.5");
+    assert((0.000123).toPrecision(2), "0.00012");
+    assert((5e-324).toExponential(3), "4.941e-324");
+
+    for(i = 0; i < 2000; i++) {
+        if (i & 1) {
+            dv.setUint32(0, rnd() * 256 + (rnd() & 0xff));
+            dv.setUint32(4, rnd() * 256 + (rnd() & 0xff));
+            d = dv.getFloat64(0);
+            if (!isFinite(d))
+                continue;
+        } else {
+            d = (rnd() % 100000) / 10 ** (rnd() % 10);
+        }
+        /* shortest digits which give back d, and the closest ones */
+        s = d.toExponential();
+        assert(Number(s), d);
+        k = s.replace(/^-|e.*$|\./g, "").length;
+        assert(String(d).replace(/^-|e.*$|\./g, "").replace(/^0+|0+$/g, ""),
+               s.replace(/^-|e.*$|\./g, "").replace(/0+$/, ""), s);
+        if (k > 1)
+            assert(Number(d.toExponential(k - 2)) !== d, true, s);
+        if (d != 0)
+            assert(Number(d.toExponential(k - 1)), d, s);
+        if (typeof BigInt == "function") {
+            f = rnd() % 25;
+            assert(d.toExponential(f), to_exponential_exact(d, f), s);
+            if (Math.abs(d) < 1e21)
+                assert(d.toFixed(f), to_fixed_exact(d, f), s);
+        }
+    }
+}
+
+function test_string_to_number()
+{
+    var dv = new DataView(new ArrayBuffer(8)), seed = 7, i, d, d1, e, m, s, p;
+    function rnd() {
+        seed = (seed * 1103515245 + 12345) >>> 0;
+        return seed >>> 8;
+    }
+
+    assert(Number("0.1"), 0.1);
+    assert(Number("-0"), -0);
+    assert(Number("0.000"), 0);
+    assert(Number("00012.50e2"), 1250);
+    assert(Number("9007199254740993"), 9007199254740992);
+    assert(Number("9007199254740993.0000000000000001"), 9007199254740994);
+    assert(Number("18446744073709551615"), 18446744073709552000);
+    assert(Number("320855618565821400000"), 320855618565821400000);
+    assert(Number("123456789012345678901234567890"), 1.2345678901234568e29);
+    assert(Number("1.7976931348623157e308"), 1.7976931348623157e308);
+    assert(Number("1.7976931348623158e308"), 1.7976931348623157e308);
+    assert(Number("1.7976931348623159e308"), Infinity);
+    assert(Number("1e309"), Infinity);
+    assert(Number("2.2250738585072011e-308"), 2.225073858507201e-308);
+    assert(Number("4.9e-324"), 5e-324);
+    assert(Number("2.4703282292062327e-324"), 0);
+    assert(Number("2.4703282292062328e-324"), 5e-324);
+    assert(Number("1" + "0".repeat(400) + "e-400"), 1);
+    assert(Number("0." + "0".repeat(400) + "1e400"), 0.1);
+    assert(parseFloat("1.00000000000000011102230246251565404236316680908203125"), 1);
+    assert(parseFloat("1.00000000000000011102230246251565404236316680908203126"), 1.0000000000000002);
+    assert(JSON.parse("[8.41e21, -1e23]").toString(), "8.41e+21,-1e+23");
+    assert(1.00000000000000033306690738754696212708950042724609375, 1.0000000000000004);
+
+    if (typeof BigInt != "function")
+        return;
+    /* exact middle of two consecutive doubles and its neighbours */
+    for(i = 0; i < 300; i++) {
+        dv.setUint32(0, (rnd() * 256 + (rnd() & 0xff)) & 0x7fefffff);
+        dv.setUint32(4, rnd() * 256 + (rnd() & 0xff));
+        d = dv.getFloat64(0);
+        dv.setUint32(4, dv.getUint32(4) + 1);
+        if (dv.getUint32(4) == 0)
+            dv.setUint32(0, dv.getUint32(0) + 1);
+        d1 = dv.getFloat64(0);
+        dv.setFloat64(0, d);
+        e = (dv.getUint32(0) >>> 20) & 0x7ff;
+        m = BigInt(dv.getUint32(0) & 0xfffff) * 2n ** 32n + BigInt(dv.getUint32(4));
+        if (e == 0)
+            e = 1;
+        else
+            m += 2n ** 52n;
+        e -= 1076;
+        m = 2n * m + 1n;
+        if (e >= 0) {
+            s = String(m << BigInt(e));
+            p = 0;
+        } else {
+            s = String(m * 5n ** BigInt(-e));
+            p = -e;
+        }
+        assert(Number(s + "e-" + p), (m & 2n) ? d1 : d, s);
+        assert(Number(s + "1e-" + (p + 1)), d1, s);
+        assert(Number(String(BigInt(s) * 10n - 1n) + "e-" + (p + 1)), d, s);
+        d = d * (rnd() & 0xffff);
+        if (isFinite(d))
+            assert(Number(String(d)), d);
+    }
+}
+
 function test_eval2()
 {
     var g_call_count = 0;
@@ -451,7 +674,7 @@ function test_typed_array()
 
 function test_json()
 {
-    var a, s;
+    var a, s, i;
     s = '{"x":1,"y":true,"z":null,"a":[1,2,3],"s":"str"}';
     a = JSON.parse(s);
     assert(a.x, 1);
@@ -459,6 +682,48 @@ function test_json()
     assert(a.z, null);
     assert(JSON.stringify(a), s);
 
+    /* objects with the same keys share their shape transitions */
+    for(i = 0; i < 3; i++) {
+        a = JSON.parse(' { "x" : 1, "y" : [ -0, 1.5e3, 12345678901 ], "x": 2 } ');
+        assert(Object.keys(a).join(), "x,y");
+        assert(a.x, 2);
+        assert(Object.is(a.y[0], -0) && a.y[1] === 1500 && a.y[2] === 12345678901);
+        a.z = 3;
+        delete a.x;
+    }
+    assert(JSON.stringify(JSON.parse('{"x":1,"y":2}')), '{"x":1,"y":2}');
+    assert(Object.keys(JSON.parse('{"b":1,"1":2,"a":3,"0":4}')).join(), "0,1,b,a");
+    assert(Object.getPrototypeOf(JSON.parse('{"__proto__":[]}')), Object.prototype);
+    assert(JSON.parse('"a\\"b\\u00e9\\ud83d\\ude00\\/' + "x".repeat(20) + '"'),
+           "a\"b\u00e9\ud83d\ude00/" + "x".repeat(20));
+    assert(JSON.parse('{"\\u0061\u00e9":1}')["a\u00e9"], 1);
+
+    /* the errors are reported by the generic parser */
+    for (s of ['[1,]', '{"a":1,}', '01', '"\\u00g0"', '"\u0001"', 'truex', '[1]x']) {
+        assert_throws(SyntaxError, () => JSON.parse(s));
+    }
+
+    assert(JSON.stringify({a:"\"\\\n\u0001\u00e9" + "x".repeat(20) + "\ud800\ud83d\ude00",
+                           b:[1.5,-0,NaN,undefined,() => 1], c:undefined}),
+           '{"a":"\\"\\\\\\n\\u0001\u00e9' + "x".repeat(20) +
+           '\\ud800\ud83d\ude00","b":[1.5,0,null,null,null]}');
+    /* toJSON() is looked up again after a prototype is modified */
+    a = {x:{y:1}};
+    assert(JSON.stringify(a), '{"x":{"y":1}}');
+    Object.prototype.toJSON = function(k) { return "P" + k; };
+    assert(JSON.stringify(a), '"P"');
+    delete Object.prototype.toJSON;
+    assert(JSON.stringify(a), '{"x":{"y":1}}');
+    /* the keys are those of the object when its serialization starts */
+    a = {x:1, y:{toJSON() { delete a.z; a.w = 3; a.v = 4; return 2; }},
+         z:5, v:6};
+    assert(JSON.stringify(a), '{"x":1,"y":2,"v":4}');
+    a = [1, {toJSON() { a.length = 2; a.push(5); return 2; }}, 3, 4];
+    assert(JSON.stringify(a), '[1,2,5,null]');
+    a = {x:1};
+    a.y = [a];
+    assert_throws(TypeError, () => JSON.stringify(a));
+
     /* indentation test */
     assert(JSON.stringify([[{x:1,y:{},z:[]},2,3]],undefined,1),
 `[
@@ -500,7 +765,7 @@ function test_date()
 
 function test_regexp()
 {
-    var a, str;
+    var a, str, i;
     str = "abbbbbc";
     a = /(b+)c/.exec(str);
     assert(a[0], "bbbbbc");
@@ -534,6 +799,77 @@ function test_regexp()
     assert(/{1a}/.toString(), "/{1a}/");
     a = /a{1+/.exec("a{11");
     assert(a, ["a{11"] );
+
+    /* start positions skipped with a literal prefix, the first chars
+       or an anchor */
+    str = "INFO: 1\nERROR: 22\nERROR: 333";
+    a = /ERROR: (\d+)/g;
+    assert(a.exec(str)[1], "22");
+    assert(a.exec(str)[1], "333");
+    assert(a.exec(str), null);
+    assert(/ERROR: (\d+)/.exec(str + "\u0100").index, 8);
+    assert(/R: 3/.exec("ERROR: 3\u0100").index, 4);
+    assert(/\u0100b/.exec("a\u0100b").index, 1);
+    assert(/\u0100b/.exec("a\xffb"), null);
+    assert(str.replace(/(?:INFO|ERROR)(?=:)/g, "x"), "x: 1\nx: 22\nx: 333");
+    assert("xAbyaB".replace(/ab/gi, "-"), "x-y-");
+    assert("k\u212a".replace(/k/giu, "-"), "--");
+    assert("abcab".replace(/\bab?c?/g, "-"), "-ab");
+    a = /^a/g;
+    a.lastIndex = 1;
+    assert(a.exec("aa"), null);
+    assert("a\na".replace(/^a/gm, "-"), "-\n-");
+    assert("\ud83d\ude00\ude00".replace(/\ude00/gu, "-"),
+           "\ud83d\ude00-");
+    a = /\ude00/u;
+    a.lastIndex = 1;
+    assert(a.exec("\ud83d\ude00"), null);
+    a = /\ude00/gu;
+    a.lastIndex = 1;
+    assert(a.exec("\ud83d\ude00").index, 1);
+
+    /* nested quantifiers run in linear time */
+    str = "a".repeat(40);
+    assert(/(a+)+b/.exec(str), null);
+    assert(/(a+)+b/.exec(str + "b")[1], str);
+    assert(/^(\w+\s?)*$/.test("a long sentence of words ".repeat(4) + "!"),
+           false);
+    assert(/(GET|POST) ((?:\/\w+)+) H/.exec("- POST /a/b1 HTTP")[2], "/a/b1");
+    assert("x aab AB".replace(/(?:a|b)+/gi, "-"), "x - -");
+    assert(/^(?:a+)+$/m.exec("b\naaa\nc")[0], "aaa");
+    a = /(?:a+)+b/y;
+    a.lastIndex = 1;
+    assert(a.exec("xaab")[0], "aab");
+    assert(/(z)((a+)?(b+)?(c))*/.exec("zaacbbbcac"),
+           ["zaacbbbcac", "z", "ac", "a", undefined, "c"]);
+    str = "1.2.3 ".repeat(100);
+    assert(/(?:\d+\.)+\d+ ms/.exec(str), null);
+    assert(/(?:\d+\.)+\d+ ms/.exec(str + "4.5 ms").index, 600);
+    /* loop bodies which can be empty */
+    str = "a".repeat(40) + "!";
+    assert(/(a*)*b/.exec(str), null);
+    assert(/(a*)*b/.exec("aab"), ["aab", ""]);
+    assert(/(\w*\s*)+$/.exec(str), ["", ""]);
+    assert(/(\w*\s*)+$/.exec("ab cd"), ["ab cd", ""]);
+    assert(/((?:[ab]{0,2}))*$/y.exec("aaaaa"), ["aaaaa", ""]);
+
+    /* the bytecode is shared by the regexps with the same source and
+       flags */
+    a = [];
+    for(i = 0; i < 2; i++)
+        a.push(new RegExp("(a)b", "g"));
+    a[0].lastIndex = 2;
+    assert(a[1].lastIndex, 0);
+    assert(a[1].exec("xab")[1], "a");
+    assert(a[0].exec("xab"), null);
+    for(i = 0; i < 2; i++) {
+        assert_throws(SyntaxError, () => new RegExp("(", "g"));
+        assert_throws(SyntaxError, () => new RegExp("a", "gg"));
+    }
+    assert(new RegExp("a", { toString() { return "i"; } }).flags, "i");
+    for(i = 0; i < 2000; i++)
+        assert(new RegExp("x" + i + "$", "m").test("ax" + i + "\n"), true);
+    assert(new RegExp("x1$", "m").source, "x1$");
 }
 
 function test_symbol()
@@ -597,6 +933,55 @@ function test_map()
     assert(a.size, 0);
 }
 
+function test_map_iterator()
+{
+    var a, i, it, tab, r;
+
+    /* deletion and insertion during forEach(), with the records
+       compacted by the insertions */
+    a = new Map();
+    for(i = 0; i < 100; i++)
+        a.set(i, i);
+    tab = [];
+    a.forEach(function (v, k) {
+        tab.push(k);
+        a.delete(k + 1);
+        if (k == 50) {
+            for(i = 0; i < 1000; i++) {
+                a.set("x", i);
+                a.delete("x");
+            }
+            a.set("last", 0);
+        }
+    });
+    assert(tab.length, 51);
+    assert(tab[50], "last");
+    assert(a.size, 51);
+
+    /* live iterator across compaction, shrinking and clear() */
+    a = new Map();
+    for(i = 0; i < 1000; i++)
+        a.set(i, i);
+    it = a.keys();
+    assert(it.next().value, 0);
+    for(i = 0; i < 990; i++)
+        a.delete(i);
+    assert(it.next().value, 990);
+    a.clear();
+    a.set("a", 1);
+    r = it.next();
+    assert(r.value === "a" && !r.done);
+    assert(it.next().done);
+
+    /* same key for equal numbers */
+    a = new Set([1, 0.5 + 0.5, -0, 0, NaN, 0 / 0, 2 ** 40, 2 ** 40]);
+    assert(a.size, 4);
+    assert(a.has(1.0) && a.has(+0) && a.has(NaN) && a.has(2 ** 40));
+    a.delete(1);
+    a.add(1);
+    assert([...a].join(), "0,NaN,1099511627776,1");
+}
+
 function test_weak_map()
 {
     var a, i, n, tab, o, v, n2;
@@ -667,8 +1052,11 @@ test_function();
 test_enum();
 test_array();
 test_string();
+test_string_rope();
 test_math();
 test_number();
+test_number_to_string();
+test_string_to_number();
 test_eval();
 test_typed_array();
 test_json();
@@ -676,5 +1064,6 @@ test_date();
 test_regexp();
 test_symbol();
 test_map();
+test_map_iterator();
 test_weak_map();
 test_generator();
@@ -212,6 +212,47 @@ function test_eval_const()
     assert(success);
 }
 
+/* also run with 'qjs --lazy' where the function bodies are compiled
+   at their first call */
+function test_lazy()
+{
+    var a = 1, r;
+    function f1(b) { return a + b; }
+    function f2() { return f2; }
+    var f3 = function f4() { return f4; };
+    var f5 = function () {
+        if (a) /}/.test("}");
+        return [ (a + 1) / 2, { x: a }.x / 2, `${ { y: a }.y }` ];
+    };
+    var o = { m: function (k) { return this.v + k; }, v: 2 };
+
+    assert(f1(2), 3);
+    a = 10;
+    assert(f1(2), 12);
+    assert(f1.length, 1);
+    assert(f1.name, "f1");
+    assert(f1.toString(), "function f1(b) { return a + b; }");
+
+    /* a declaration references its binding, not itself */
+    r = f2;
+    f2 = 1;
+    assert(r(), 1);
+    assert(f3(), f3);
+    assert(f5().toString(), "5.5,5,10");
+    assert(o.m(1), 3);
+
+    with ({ w: 3 }) {
+        r = function () { return w; };
+    }
+    assert(r(), 3);
+
+    class C {
+        #x = 42;
+        m() { var self = this; return function () { return self.#x; }; }
+    }
+    assert(new C().m()(), 42);
+}
+
 test_closure1();
 test_closure2();
 test_closure3();
@@ -219,3 +260,4 @@ test_arrow_function();
 test_with();
 test_eval_closure();
 test_eval_const();
+test_lazy();
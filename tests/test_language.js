@@ -258,6 +258,82 @@ function test_prototype()
     assert(g.prototype.constructor, g, "prototype");
 }
 
+function test_inline_cache()
+{
+    var a, b, i, tab;
+    function get_x(o) { return o.x; }
+    function put_x(o, v) { o.x = v; }
+
+    a = { x: 1, y: 2 };
+    for(i = 0; i < 3; i++)
+        assert(get_x(a), 1);
+    delete a.x;
+    assert(get_x(a), undefined);
+    a.x = 3;
+    assert(get_x(a), 3);
+    Object.defineProperty(a, "x", { get: function() { return 4; } });
+    assert(get_x(a), 4);
+
+    b = { x: 1 };
+    put_x(b, 2);
+    put_x(b, 3);
+    assert(b.x, 3);
+    Object.defineProperty(b, "x", { writable: false });
+    put_x(b, 4);
+    assert(b.x, 3);
+
+    /* polymorphic site */
+    tab = [ { x: 0 }, { y: 0, x: 1 }, { z: 0, y: 0, x: 2 }, { w: 0, x: 3 },
+            { v: 0, x: 4 } ];
+    for(i = 0; i < 2 * tab.length; i++)
+        assert(get_x(tab[i % tab.length]), i % tab.length);
+
+    /* compacted shape */
+    a = {};
+    for(i = 0; i < 32; i++)
+        a["p" + i] = i;
+    a.x = 5;
+    assert(get_x(a), 5);
+    for(i = 0; i < 32; i++)
+        delete a["p" + i];
+    assert(get_x(a), 5);
+
+    /* prototype chain */
+    class A { f() { return 1; } }
+    class B extends A { }
+    function call_f(o) { return o.f(); }
+    a = new A();
+    b = new B();
+    for(i = 0; i < 3; i++) {
+        assert(call_f(a), 1);
+        assert(call_f(b), 1);
+    }
+    A.prototype.f = function() { return 2; };
+    assert(call_f(b), 2);
+    B.prototype.f = function() { return 3; };
+    assert(call_f(b), 3);
+    assert(call_f(a), 2);
+    delete B.prototype.f;
+    assert(call_f(b), 2);
+    Object.setPrototypeOf(B.prototype, { f() { return 4; } });
+    assert(call_f(b), 4);
+    Object.defineProperty(A.prototype, "f", { get: function() { return () => 5; } });
+    assert(call_f(a), 5);
+    b.f = function() { return 6; };
+    assert(call_f(b), 6);
+
+    /* a typed array may share the shape of a plain object but hides
+       the canonical numeric names of its prototypes */
+    function get_inf(o) { return o.Infinity; }
+    Uint8Array.prototype.Infinity = 5;
+    a = Object.create(Uint8Array.prototype);
+    b = new Uint8Array(2);
+    assert(get_inf(b), undefined);
+    assert(get_inf(a), 5);
+    assert(get_inf(b), undefined);
+    delete Uint8Array.prototype.Infinity;
+}
+
 function test_arguments()
 {
     function f2() {
@@ -533,6 +609,7 @@ test_inc_dec();
 test_op2();
 test_delete();
 test_prototype();
+test_inline_cache();
 test_arguments();
 test_class();
 test_template();
@@ -74,6 +74,37 @@ function test_for()
     assert(c === 3 && j === 3);
 }
 
+function test_for_compare()
+{
+    var i, c, o;
+
+    /* integer and non integer operands of the fused compare and branch */
+    c = 0;
+    for(i = 0; i <= 3; i++) c++;
+    assert(c === 4 && i === 4);
+    c = 0;
+    for(i = 3; i > 0.5; i--) c++;
+    assert(c === 3);
+    c = 0;
+    for(i = 0.5; i < 3; i++) c++;
+    assert(c === 3 && i === 3.5);
+    c = 0;
+    for(i = "a"; i >= "a" && c < 5; i = i + "a") c++;
+    assert(c === 5);
+    c = 0;
+    for(i = 0; i < NaN; i++) c++;
+    assert(c === 0);
+    o = { valueOf() { c++; return 2; } };
+    c = 0;
+    for(i = 0; i < o; i++);
+    assert(c === 3 && i === 2);
+
+    /* increment overflow */
+    c = 0;
+    for(i = 0x7ffffffe; i < 0x80000001; i++) c++;
+    assert(c === 3 && i === 0x80000001);
+}
+
 function test_for_in()
 {
     var i, tab, a, b;
@@ -352,6 +383,7 @@ test_while();
 test_while_break();
 test_do_while();
 test_for();
+test_for_compare();
 test_for_break();
 test_switch1();
 test_switch2();
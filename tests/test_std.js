@@ -270,6 +270,38 @@ function test_timer()
         os.clearTimeout(th[i]);
 }
 
+function test_gc()
+{
+    var keep, i, a;
+
+    /* incremental steps interleaved with the creation of cycles: the
+       live objects must not be collected */
+    keep = [];
+    for(i = 0; i < 2000; i++) {
+        let a = { n: i };
+        let b = { a: a };
+        let m = new Map([[a, b]]);
+        a.b = b;
+        a.get = function () { return m.get(a); };
+        if ((i % 50) == 0)
+            keep.push(a);
+        if ((i % 100) == 0)
+            std.gc(50);
+    }
+    for(i = 0; i < 100; i++)
+        std.gc(1000);
+    assert(keep.length, 40);
+    for(i = 0; i < keep.length; i++) {
+        a = keep[i];
+        assert(a.n, i * 50);
+        assert(a.b.a === a, true);
+        assert(a.get() === a.b, true);
+    }
+    keep = null;
+    std.gc(1000);
+    std.gc();
+}
+
 test_printf();
 test_file1();
 test_file2();
@@ -279,3 +311,4 @@ test_os();
 test_os_exec();
 test_timer();
 test_ext_json();
+test_gc();